@@ -24,6 +24,11 @@ CC = g++
 SAGE_CFLAGS = -Wno-deprecated -Wno-deprecated-declarations -fPIC
 SAGE_LDFLAGS =
 
+# clock_nanosleep for the frame pacing (in libc with newer glibc)
+ifeq ($(MACHINE), Linux)
+RT_LDFLAGS = -lrt
+endif
+
 # SDL
 SDL_CFLAGS = `sdl-config --cflags`
 SDL_LDFLAGS = `sdl-config --libs`
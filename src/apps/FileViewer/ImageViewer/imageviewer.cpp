@@ -49,6 +49,8 @@
 #include "sail.h"
 #include "misc.h"
 
+#include "pyramid.h"
+
 
 
 // #if MagickLibVersion >= 0x645
@@ -410,6 +412,141 @@ bool dxtFileExists(string fileName)
 
 // -----------------------------------------------------------------------------
 
+// pyramid mode: how far the view can be magnified
+#define PYRAMID_MAX_ZOOM   8.0
+// default view size if none is given on the command line
+#define PYRAMID_VIEW_WIDTH   1920
+#define PYRAMID_VIEW_HEIGHT  1080
+
+// streams a window-sized view of the image pyramid and pans/zooms it
+// on EVT_PAN/EVT_ZOOM, so the size of the image doesn't matter
+int showPyramid(string fileName, const char *cacheDir, int viewW, int viewH)
+{
+  imagePyramid pyramid;
+  if (pyramid.open(fileName.c_str(), cacheDir) < 0)
+    return -1;
+
+  double width = pyramid.getWidth();
+  double height = pyramid.getHeight();
+
+  // fit the image into the default view, keeping its aspect ratio
+  if (viewW <= 0 || viewH <= 0) {
+    double fit = PYRAMID_VIEW_WIDTH / width;
+    if (PYRAMID_VIEW_HEIGHT / height < fit)
+      fit = PYRAMID_VIEW_HEIGHT / height;
+    if (fit > 1.0)
+      fit = 1.0;
+    viewW = (int)(width * fit);
+    viewH = (int)(height * fit);
+    if (viewW < 1) viewW = 1;
+    if (viewH < 1) viewH = 1;
+  }
+
+  SAGE_PRINTLOG("ImageViewer> pyramid of %d levels, %dx%d view", pyramid.getLevelNum(), viewW, viewH);
+
+  sail sageInf;
+  sailConfig scfg;
+
+  char *tmpconf = getenv("SAGE_APP_CONFIG");
+  if (tmpconf)
+    scfg.init(tmpconf);
+  else
+    scfg.init((char*)"imageviewer.conf");
+
+  scfg.setAppName((char*)"imageviewer");
+  scfg.resX = viewW;
+  scfg.resY = viewH;
+  if (scfg.winWidth == -1 || scfg.winHeight == -1) {
+    scfg.winWidth = viewW;
+    scfg.winHeight = viewH;
+  }
+  scfg.pixFmt = PIXFMT_888;
+  scfg.rowOrd = TOP_TO_BOTTOM;
+  sageInf.init(scfg);
+
+  // level-0 pixels per view pixel for the whole image
+  double fitScale = width / viewW;
+  if (height / viewH > fitScale)
+    fitScale = height / viewH;
+
+  double scale = fitScale;
+  double cx = width / 2.0, cy = height / 2.0;
+  int redraw = 2;   // fill both SAIL buffers
+
+  while (1)
+  {
+    if (redraw > 0) {
+      pyramid.render((byte*)sageInf.getBuffer(), viewW, viewH, cx, cy, scale);
+      sageInf.swapBuffer();
+      redraw--;
+      continue;
+    }
+
+    sageMessage msg;
+    if (sageInf.checkMsg(msg, false) <= 0) {
+      usleep(10000);
+      continue;
+    }
+
+    int code = msg.getCode();
+    int deviceId;
+    float x, y, dx, dy, dz;
+
+    switch (code) {
+    case EVT_PAN:
+      // position and motion normalized to the window, y going up
+      if (sscanf((char *)msg.getData(), "%d %f %f %f %f %f", &deviceId, &x, &y, &dx, &dy, &dz) == 6) {
+        cx -= dx * viewW * scale;
+        cy += dy * viewH * scale;
+        redraw = 2;
+      }
+      break;
+
+    case EVT_ZOOM:
+      if (sscanf((char *)msg.getData(), "%d %f %f %f %f %f", &deviceId, &x, &y, &dx, &dy, &dz) == 6) {
+        double zoom = 1.0 + dx;
+        if (zoom < 0.5) zoom = 0.5;
+        if (zoom > 2.0) zoom = 2.0;
+
+        double newScale = scale / zoom;
+        if (newScale < 1.0 / PYRAMID_MAX_ZOOM) newScale = 1.0 / PYRAMID_MAX_ZOOM;
+        if (newScale > fitScale * 2.0) newScale = fitScale * 2.0;
+
+        // keep the image point under the pointer in place
+        double px = cx + (x - 0.5) * viewW * scale;
+        double py = cy + (0.5 - y) * viewH * scale;
+        cx = px - (x - 0.5) * viewW * newScale;
+        cy = py - (0.5 - y) * viewH * newScale;
+        scale = newScale;
+        redraw = 2;
+      }
+      break;
+
+    case EVT_DOUBLE_CLICK:
+      scale = fitScale;
+      cx = width / 2.0;
+      cy = height / 2.0;
+      redraw = 2;
+      break;
+
+    case APP_QUIT:
+      sageInf.shutdown();
+      exit(1);
+      break;
+    }
+
+    // keep the center of the view on the image
+    if (cx < 0) cx = 0;
+    if (cx > width) cx = width;
+    if (cy < 0) cy = 0;
+    if (cy > height) cy = height;
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+
 
 
 int main(int argc,char **argv)
@@ -419,6 +556,8 @@ int main(int argc,char **argv)
   byte *rgba = NULL;
   unsigned int width, height;  // image size
   unsigned int window_width=-1, window_height=-1;  // sage window size
+  bool usePyramid = false;   // stream views of a tiled pyramid instead
+  char *cacheDir = NULL;
 
 #ifdef USE_CAIRO
   cairo_surface_t *surface;
@@ -430,7 +569,7 @@ int main(int argc,char **argv)
 
   // parse command line arguments
   if (argc < 2){
-    fprintf(stderr, "\n\nUSAGE: imageviewer filename [width] [height] [-show_original]");
+    fprintf(stderr, "\n\nUSAGE: imageviewer filename [width] [height] [-show_original] [-pyramid [-cache dir]]");
     return 0;
   }
   for (int argNum=2; argNum<argc; argNum++)
@@ -438,6 +577,12 @@ int main(int argc,char **argv)
     if (strcmp(argv[argNum], "-show_original") == 0) {
       loadDXT = false;
     }
+    else if (strcmp(argv[argNum], "-pyramid") == 0) {
+      usePyramid = true;
+    }
+    else if (strcmp(argv[argNum], "-cache") == 0 && argNum+1 < argc) {
+      cacheDir = argv[++argNum];
+    }
     else if(atoi(argv[argNum]) != 0 && atoi(argv[argNum+1]) != 0) {
       window_width = atoi( argv[argNum] );
       window_height = atoi( argv[argNum+1] );
@@ -451,6 +596,9 @@ int main(int argc,char **argv)
   fileName = string(argv[1]);
   fileExt = fileName.substr(fileName.rfind("."));
 
+  if (usePyramid)
+    return showPyramid(fileName, cacheDir, (int)window_width, (int)window_height);
+
   // if image is in DXT load it directly, otherwise compress and load
   if(fileExt.compare(".dxt") == 0)   // DXT
 #ifndef USE_DXT
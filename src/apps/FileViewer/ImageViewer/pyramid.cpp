@@ -0,0 +1,388 @@
+/*****************************************************************************************
+ * imageviewer: tiled multi-resolution pyramid for very large images
+ *
+ * Copyright (C) 2007 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc to www.evl.uic.edu/cavern/forum
+ *
+ *****************************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <vector>
+#include <wand/magick-wand.h>
+
+#include "pyramid.h"
+
+// tiles start on a page boundary after the header
+#define PYRAMID_DATA_ALIGN 4096
+
+
+imagePyramid::imagePyramid() : fd(-1), map(NULL), mapSize(0), hdr(NULL)
+{
+  tileBytes = PYRAMID_TILE_SIZE * PYRAMID_TILE_SIZE * 3;
+}
+
+imagePyramid::~imagePyramid()
+{
+  closeFile();
+}
+
+void imagePyramid::closeFile()
+{
+  if (map)
+    munmap(map, mapSize);
+  if (fd >= 0)
+    close(fd);
+
+  map = NULL;
+  hdr = NULL;
+  mapSize = 0;
+  fd = -1;
+}
+
+int imagePyramid::open(const char *fileName, const char *cacheDir)
+{
+  srcName = fileName;
+
+  struct stat st;
+  if (stat(fileName, &st) != 0) {
+    fprintf(stderr, "imagePyramid: can't find %s\n", fileName);
+    return -1;
+  }
+
+  if (cacheDir) {
+    std::string base = srcName;
+    size_t slash = base.rfind('/');
+    if (slash != std::string::npos)
+      base = base.substr(slash+1);
+    pyrName = std::string(cacheDir) + "/" + base + ".pyr";
+  }
+  else
+    pyrName = srcName + ".pyr";
+
+  if (openFile((long long)st.st_mtime))
+    return 0;
+
+  // no usable pyramid yet: build it from the source image
+  MagickWand *wand = NewMagickWand();
+  if (MagickPingImage(wand, fileName) == MagickFalse) {
+    fprintf(stderr, "imagePyramid: can't read %s\n", fileName);
+    DestroyMagickWand(wand);
+    return -1;
+  }
+  unsigned int w = MagickGetImageWidth(wand);
+  unsigned int h = MagickGetImageHeight(wand);
+  DestroyMagickWand(wand);
+
+  fprintf(stderr, "imagePyramid: building %s for %ux%u image\n", pyrName.c_str(), w, h);
+
+  // build under a temporary name so that an interrupted build is never used
+  std::string finalName = pyrName;
+  char suffix[32];
+  sprintf(suffix, ".%d.tmp", (int)getpid());
+  pyrName += suffix;
+
+  if (createFile(w, h, (long long)st.st_mtime) < 0 || buildBaseLevel() < 0) {
+    closeFile();
+    unlink(pyrName.c_str());
+    return -1;
+  }
+
+  for (unsigned int l=1; l<hdr->levelNum; l++) {
+    pyramidLevel &lv = hdr->levels[l];
+    for (unsigned int ty=0; ty<lv.tilesY; ty++)
+      for (unsigned int tx=0; tx<lv.tilesX; tx++)
+        buildTile(l, tx, ty);
+
+    // the level below won't be read again: write it out and drop it
+    pyramidLevel &prev = hdr->levels[l-1];
+    size_t len = (size_t)prev.tilesX * prev.tilesY * tileBytes;
+    msync(map + prev.offset, len, MS_SYNC);
+    madvise(map + prev.offset, len, MADV_DONTNEED);
+  }
+
+  hdr->complete = 1;
+  msync(map, mapSize, MS_SYNC);
+
+  if (rename(pyrName.c_str(), finalName.c_str()) != 0)
+    fprintf(stderr, "imagePyramid: can't rename %s\n", pyrName.c_str());
+  pyrName = finalName;
+
+  return 0;
+}
+
+bool imagePyramid::openFile(long long srcTime)
+{
+  fd = ::open(pyrName.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(pyramidHeader)) {
+    closeFile();
+    return false;
+  }
+
+  mapSize = st.st_size;
+  void *m = mmap(NULL, mapSize, PROT_READ, MAP_SHARED, fd, 0);
+  if (m == MAP_FAILED) {
+    map = NULL;
+    closeFile();
+    return false;
+  }
+  map = (byte *)m;
+  hdr = (pyramidHeader *)map;
+
+  bool valid = hdr->magic == PYRAMID_MAGIC && hdr->complete && hdr->srcTime == srcTime &&
+    hdr->tileSize == PYRAMID_TILE_SIZE && hdr->levelNum > 0 && hdr->levelNum <= PYRAMID_MAX_LEVELS;
+
+  if (valid) {
+    pyramidLevel &last = hdr->levels[hdr->levelNum-1];
+    unsigned long long end = last.offset + (unsigned long long)last.tilesX * last.tilesY * tileBytes;
+    valid = end <= mapSize;
+  }
+
+  if (!valid) {
+    closeFile();
+    return false;
+  }
+
+  return true;
+}
+
+int imagePyramid::createFile(unsigned int w, unsigned int h, long long srcTime)
+{
+  pyramidHeader head;
+  memset(&head, 0, sizeof(head));
+  head.magic = PYRAMID_MAGIC;
+  head.width = w;
+  head.height = h;
+  head.tileSize = PYRAMID_TILE_SIZE;
+  head.srcTime = srcTime;
+
+  // halve the image until it fits in a single tile
+  unsigned long long offset = (sizeof(pyramidHeader) + PYRAMID_DATA_ALIGN - 1) /
+    PYRAMID_DATA_ALIGN * PYRAMID_DATA_ALIGN;
+  unsigned int lw = w, lh = h;
+
+  for (int l=0; l<PYRAMID_MAX_LEVELS; l++) {
+    pyramidLevel &lv = head.levels[l];
+    lv.width = lw;
+    lv.height = lh;
+    lv.tilesX = (lw + PYRAMID_TILE_SIZE - 1) / PYRAMID_TILE_SIZE;
+    lv.tilesY = (lh + PYRAMID_TILE_SIZE - 1) / PYRAMID_TILE_SIZE;
+    lv.offset = offset;
+    offset += (unsigned long long)lv.tilesX * lv.tilesY * tileBytes;
+    head.levelNum++;
+
+    if (lw <= PYRAMID_TILE_SIZE && lh <= PYRAMID_TILE_SIZE)
+      break;
+    lw = (lw + 1) / 2;
+    lh = (lh + 1) / 2;
+  }
+
+  fd = ::open(pyrName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    fprintf(stderr, "imagePyramid: can't create %s\n", pyrName.c_str());
+    return -1;
+  }
+
+  if (ftruncate(fd, (off_t)offset) != 0) {
+    fprintf(stderr, "imagePyramid: can't allocate %llu bytes for %s\n", offset, pyrName.c_str());
+    return -1;
+  }
+
+  mapSize = (size_t)offset;
+  void *m = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (m == MAP_FAILED) {
+    fprintf(stderr, "imagePyramid: can't map %s\n", pyrName.c_str());
+    return -1;
+  }
+
+  map = (byte *)m;
+  hdr = (pyramidHeader *)map;
+  memcpy(hdr, &head, sizeof(head));
+
+  return 0;
+}
+
+int imagePyramid::buildBaseLevel()
+{
+  // ImageMagick keeps very large images in its disk pixel cache, so only
+  // one tile of pixels is held here at a time
+  MagickWand *wand = NewMagickWand();
+  if (MagickReadImage(wand, srcName.c_str()) == MagickFalse) {
+    fprintf(stderr, "imagePyramid: can't read %s\n", srcName.c_str());
+    DestroyMagickWand(wand);
+    return -1;
+  }
+
+  int ts = PYRAMID_TILE_SIZE;
+  pyramidLevel &lv = hdr->levels[0];
+  byte *tmp = (byte *)malloc(tileBytes);
+
+  for (unsigned int ty=0; ty<lv.tilesY; ty++) {
+    for (unsigned int tx=0; tx<lv.tilesX; tx++) {
+      byte *tile = getTile(0, tx, ty);
+      int tw = lv.width - tx*ts < (unsigned int)ts ? lv.width - tx*ts : ts;
+      int th = lv.height - ty*ts < (unsigned int)ts ? lv.height - ty*ts : ts;
+
+      if (tw == ts) {
+        MagickExportImagePixels(wand, tx*ts, ty*ts, tw, th, "RGB", CharPixel, tile);
+      }
+      else {
+        // partial tile at the right edge: pad the rows to the tile width
+        MagickExportImagePixels(wand, tx*ts, ty*ts, tw, th, "RGB", CharPixel, tmp);
+        for (int y=0; y<th; y++)
+          memcpy(tile + y*ts*3, tmp + y*tw*3, tw*3);
+      }
+    }
+
+    // write out the finished band of tiles to keep the resident set small
+    byte *band = getTile(0, 0, ty);
+    size_t len = (size_t)lv.tilesX * tileBytes;
+    msync(band, len, MS_SYNC);
+    madvise(band, len, MADV_DONTNEED);
+  }
+
+  free(tmp);
+  DestroyMagickWand(wand);
+
+  return 0;
+}
+
+// box-filters the four tiles of the level below into one tile
+void imagePyramid::buildTile(int level, int tx, int ty)
+{
+  int ts = PYRAMID_TILE_SIZE;
+  int half = ts / 2;
+  pyramidLevel &prev = hdr->levels[level-1];
+  byte *dst = getTile(level, tx, ty);
+
+  for (int qy=0; qy<2; qy++) {
+    for (int qx=0; qx<2; qx++) {
+      unsigned int ctx = 2*tx + qx;
+      unsigned int cty = 2*ty + qy;
+      if (ctx >= prev.tilesX || cty >= prev.tilesY)
+        continue;
+
+      byte *src = getTile(level-1, ctx, cty);
+      int cw = prev.width - ctx*ts < (unsigned int)ts ? prev.width - ctx*ts : ts;
+      int ch = prev.height - cty*ts < (unsigned int)ts ? prev.height - cty*ts : ts;
+
+      for (int y=0; y<(ch+1)/2; y++) {
+        byte *s0 = src + 2*y*ts*3;
+        byte *s1 = src + (2*y+1 < ch ? 2*y+1 : ch-1)*ts*3;
+        byte *d = dst + ((qy*half + y)*ts + qx*half)*3;
+
+        for (int x=0; x<(cw+1)/2; x++) {
+          int x0 = 2*x*3;
+          int x1 = (2*x+1 < cw ? 2*x+1 : cw-1)*3;
+          for (int c=0; c<3; c++)
+            d[x*3+c] = (s0[x0+c] + s0[x1+c] + s1[x0+c] + s1[x1+c] + 2) >> 2;
+        }
+      }
+    }
+  }
+}
+
+byte* imagePyramid::getTile(int level, int tx, int ty)
+{
+  pyramidLevel &lv = hdr->levels[level];
+  return map + lv.offset + ((size_t)ty * lv.tilesX + tx) * tileBytes;
+}
+
+void imagePyramid::render(byte *dst, int viewW, int viewH, double cx, double cy, double scale)
+{
+  int ts = hdr->tileSize;
+
+  // coarsest level that still has at least one pixel per view pixel
+  int level = 0;
+  double factor = 1.0;
+  while (level+1 < (int)hdr->levelNum && factor*2.0 <= scale) {
+    factor *= 2.0;
+    level++;
+  }
+
+  pyramidLevel &lv = hdr->levels[level];
+  double step = scale / factor;
+  double x0 = (cx - viewW*scale/2.0) / factor;
+  double y0 = (cy - viewH*scale/2.0) / factor;
+
+  // source column of every view column, -1 outside of the image
+  std::vector<int> colTile(viewW), colOff(viewW);
+  for (int x=0; x<viewW; x++) {
+    double lx = floor(x0 + (x+0.5)*step);
+    if (lx < 0 || lx >= lv.width) {
+      colTile[x] = -1;
+    }
+    else {
+      colTile[x] = (int)lx / ts;
+      colOff[x] = ((int)lx % ts) * 3;
+    }
+  }
+
+  for (int y=0; y<viewH; y++) {
+    byte *row = dst + (size_t)y*viewW*3;
+    double ly = floor(y0 + (y+0.5)*step);
+    if (ly < 0 || ly >= lv.height) {
+      memset(row, 0, viewW*3);
+      continue;
+    }
+
+    int ty = (int)ly / ts;
+    int rowOff = ((int)ly % ts) * ts * 3;
+    int lastTile = -1;
+    byte *src = NULL;
+
+    for (int x=0; x<viewW; x++) {
+      if (colTile[x] < 0) {
+        row[x*3] = row[x*3+1] = row[x*3+2] = 0;
+        continue;
+      }
+      if (colTile[x] != lastTile) {
+        lastTile = colTile[x];
+        src = getTile(level, lastTile, ty) + rowOff;
+      }
+      byte *p = src + colOff[x];
+      row[x*3]   = p[0];
+      row[x*3+1] = p[1];
+      row[x*3+2] = p[2];
+    }
+  }
+}
@@ -0,0 +1,118 @@
+/*****************************************************************************************
+ * imageviewer: tiled multi-resolution pyramid for very large images
+ *
+ * Copyright (C) 2007 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc to www.evl.uic.edu/cavern/forum
+ *
+ *****************************************************************************************/
+
+
+#ifndef IMAGEVIEWER_PYRAMID_H
+#define IMAGEVIEWER_PYRAMID_H
+
+#include <sys/types.h>
+#include <string>
+
+typedef unsigned char byte;
+
+#define PYRAMID_MAGIC       0x50595231   // "PYR1"
+#define PYRAMID_TILE_SIZE   256
+#define PYRAMID_MAX_LEVELS  32
+
+/**
+ * RGB mip pyramid of an image stored as fixed size tiles in a
+ * memory-mapped file (the image name with a .pyr extension).
+ *
+ * The file is built once, streaming the source image a band of tiles at a
+ * time, and reused on later runs. Rendering a view only touches the tiles
+ * of the level matching the zoom factor, so memory use and pan/zoom cost
+ * depend on the window size and not on the size of the image.
+ */
+class imagePyramid {
+private:
+  struct pyramidLevel {
+    unsigned int width, height;
+    unsigned int tilesX, tilesY;
+    unsigned long long offset;   // of the first tile in the file
+  };
+
+  struct pyramidHeader {
+    unsigned int magic;
+    unsigned int width;
+    unsigned int height;
+    unsigned int tileSize;
+    unsigned int levelNum;
+    unsigned int complete;       // set once every level has been written
+    long long    srcTime;        // modification time of the source image
+    pyramidLevel levels[PYRAMID_MAX_LEVELS];
+  };
+
+  std::string srcName;
+  std::string pyrName;
+  int fd;
+  byte *map;
+  size_t mapSize;
+  pyramidHeader *hdr;
+
+  int tileBytes;
+
+  bool openFile(long long srcTime);
+  int  createFile(unsigned int w, unsigned int h, long long srcTime);
+  int  buildBaseLevel();
+  void buildTile(int level, int tx, int ty);
+  void closeFile();
+
+public:
+  imagePyramid();
+  ~imagePyramid();
+
+  /**
+   * maps the pyramid of the image, building it first if it doesn't exist
+   * or is older than the image. The pyramid is written to cacheDir if
+   * given, otherwise next to the image. Returns -1 on error.
+   */
+  int open(const char *fileName, const char *cacheDir = NULL);
+
+  /**
+   * renders the view of (viewW x viewH) RGB pixels centered on level-0
+   * pixel (cx, cy), with scale level-0 pixels per view pixel
+   */
+  void render(byte *dst, int viewW, int viewH, double cx, double cy, double scale);
+
+  byte* getTile(int level, int tx, int ty);
+
+  inline unsigned int getWidth()  { return hdr->width; }
+  inline unsigned int getHeight() { return hdr->height; }
+  inline int getLevelNum() { return hdr->levelNum; }
+  inline int getTileSize() { return hdr->tileSize; }
+};
+
+#endif
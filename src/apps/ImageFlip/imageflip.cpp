@@ -50,9 +50,9 @@
 #include "appWidgets.h"
 #include "misc.h"
 #include "util.h"
+#include "prefetch.h"
 
 typedef unsigned char byte;
-#define memalign(x,y) malloc((y))
 
 
 // Set of filenames
@@ -71,6 +71,16 @@ int isPlaying = 0;
 sail sageInf; // sail object
 byte *rgbBuffer = NULL;
 
+// decode-ahead pipeline
+imagePrefetcher *prefetcher = NULL;
+int decodeThreads = 2;
+int decodeAhead = 8;
+char *cacheDir = NULL;
+
+// time spent waiting for decoded frames and streaming them (in seconds)
+double waitTime = 0.0, streamTime = 0.0;
+int shownFrames = 0;
+
 // widgets
 label *pageNum= new label;
 //char wlabel[256];
@@ -151,6 +161,41 @@ void swapBuffer()
   sageInf.swapBuffer();
 }
 
+// -----------------------------------------------------------------------------
+
+// show image number current (1-based) from the decode-ahead pipeline,
+// decoded frames are copied straight into the SAIL buffer
+void showImage()
+{
+  byte* sageBuffer = (byte*)sageInf.getBuffer();
+  waitTime += prefetcher->copyFrame(current-1, sageBuffer);
+
+  double t0 = aTime();
+  sageInf.swapBuffer();
+  streamTime += aTime() - t0;
+  shownFrames++;
+}
+
+// print the decode vs. stream time every few seconds
+void reportPerformance(double elapsed)
+{
+  double decodeSec;
+  int decoded, cached;
+  prefetcher->getStats(decodeSec, decoded, cached);
+
+  if (shownFrames > 0) {
+    int done = decoded + cached;
+    fprintf(stderr, "imageflip: %.2f fps, decode %.2f ms/frame (%d decoded, %d from cache, %d threads), "
+            "wait %.2f ms/frame, stream %.2f ms/frame\n",
+            shownFrames / elapsed, done > 0 ? 1000.0 * decodeSec / done : 0.0,
+            decoded, cached, decodeThreads,
+            1000.0 * waitTime / shownFrames, 1000.0 * streamTime / shownFrames);
+  }
+
+  waitTime = streamTime = 0.0;
+  shownFrames = 0;
+}
+
 // -----------------------------------------------------------------------------
 // --  SAGE UI Callbacks -------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -162,12 +207,9 @@ void onHomeBtn(int eventId, button *btnObj)
   iter = Names.begin();
   current = 1;
 
-  // Get some pixels
+  // Get some pixels and send the picture
   cerr << "Getting " << *iter << "\n";  // endl;
-  getRGB(*iter, rgbBuffer, width, height);
-
-  // Send the picture
-  swapBuffer();
+  showImage();
 
   // Update UI
   //memset(wlabel, 0, 256);
@@ -184,12 +226,9 @@ void onEndBtn(int eventId, button *btnObj)
   iter--;
   current = Names.size();
 
-  // Get some pixels
+  // Get some pixels and send the picture
   cerr << "Getting " << *iter << "\n";  // endl;
-  getRGB(*iter, rgbBuffer, width, height);
-
-  // Send the picture
-  swapBuffer();
+  showImage();
 
   // Update UI
   //memset(wlabel, 0, 256);
@@ -214,12 +253,9 @@ void onPrevBtn(int eventId, button *btnObj)
   else {
     current--;
   }
-  // Get some pixels
+  // Get some pixels and send the picture
   cerr << "Getting " << *iter << "\n";  // endl;
-  getRGB(*iter, rgbBuffer, width, height);
-
-  // Send the picture
-  swapBuffer();
+  showImage();
 
   // Update UI
   //memset(wlabel, 0, 256);
@@ -243,12 +279,9 @@ void onNextBtn(int eventId, button *btnObj)
   else {
     current++;
   }
-  // Get some pixels
+  // Get some pixels and send the picture
   cerr << "Getting " << *iter << "\n";  // endl;
-  getRGB(*iter, rgbBuffer, width, height);
-
-  // Send the picture
-  swapBuffer();
+  showImage();
 
   // Update UI
   //memset(wlabel, 0, 256);
@@ -440,7 +473,7 @@ int main(int argc,char **argv)
 
   // parse command line arguments
   if (argc < 2){
-    fprintf(stderr, "\n\nUSAGE: imageflip directory [fps]\n");
+    fprintf(stderr, "\n\nUSAGE: imageflip directory [fps] [decode threads] [cache directory]\n");
     return 0;
   }
 
@@ -449,8 +482,12 @@ int main(int argc,char **argv)
   dirName = string(argv[1]);
 
   float fps = 1.0f;
-  if (argc==3)
+  if (argc>=3)
     fps = atof(argv[2]);
+  if (argc>=4)
+    decodeThreads = atoi(argv[3]);
+  if (argc>=5)
+    cacheDir = argv[4];
 
 
   // Populate the filename list
@@ -500,23 +537,27 @@ int main(int argc,char **argv)
   rgbBuffer = (byte*)malloc(width*height*3);
   memset(rgbBuffer, 0, width*height*3);
 
+  // start decoding ahead of the playback
+  std::vector<std::string> files(Names.begin(), Names.end());
+  prefetcher = new imagePrefetcher(files, width, height, decodeThreads, decodeAhead, cacheDir);
+
   makeWidgets();
 
   // Initialization
   sageInf.init(scfg);
 
 
-  // Get some pixels
-  current = 1;
-  getRGB(firstname, rgbBuffer, width, height);
-  swapBuffer();
-
   // Rewind
   iter = Names.begin();
 
+  // Get some pixels
+  current = 1;
+  showImage();
+
   // Wait the end
   sageMessage msg;
   double lt = 0.0;
+  double reportTime = aTime();
   while (1)
   {
     // Process SAGE messages
@@ -524,6 +565,7 @@ int main(int argc,char **argv)
       switch (msg.getCode()) {
       case APP_QUIT:
         cout << "\nDone\n\n";
+        delete prefetcher;
         sageInf.shutdown();
         exit(1);
         break;
@@ -544,14 +586,21 @@ int main(int argc,char **argv)
         else {
           current++;
         }
-        // Get some pixels
-        cerr << "Getting " << *iter << "\r";  // endl;
-        getRGB(*iter, rgbBuffer, width, height);
-        // Send the picture
-        swapBuffer();
+        // Get some pixels and send the picture
+        showImage();
 
         lt = aTime();
       }
+
+      if (aTime() - reportTime > 5.0) {
+        reportPerformance(aTime() - reportTime);
+        reportTime = aTime();
+      }
+    }
+    else {
+      reportTime = aTime();
+      shownFrames = 0;
+      waitTime = streamTime = 0.0;
     }
 
   }
@@ -0,0 +1,381 @@
+/*****************************************************************************************
+ * imageflip: decode-ahead pipeline for image sequences
+ *
+ * Copyright (C) 2007 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc to www.evl.uic.edu/cavern/forum
+ *
+ *****************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <wand/magick-wand.h>
+
+#include "prefetch.h"
+#include "util.h"
+
+// header of a cached raw frame
+struct cacheHeader {
+  unsigned int magic;
+  unsigned int width;
+  unsigned int height;
+  unsigned int pad;
+  long long srcSize;    // of the image the frame was decoded from
+  long long srcMtime;
+};
+
+
+imagePrefetcher::imagePrefetcher(std::vector<std::string> &names, unsigned int w, unsigned int h,
+                                 int threads, int ahead, const char *cache) :
+  files(names), width(w), height(h), depth(ahead), base(0), workerNum(threads), running(true),
+  decodeTime(0.0), decodedFrames(0), cachedFrames(0)
+{
+  frameSize = (size_t)width * height * 3;
+
+  if (cache)
+    cacheDir = cache;
+
+  if (depth < 1)
+    depth = 1;
+  if (workerNum < 1)
+    workerNum = 1;
+
+  pthread_mutex_init(&lock, NULL);
+  pthread_cond_init(&workCond, NULL);
+  pthread_cond_init(&readyCond, NULL);
+
+  // one spare slot so the frame on screen can be copied out
+  // while the whole window is being decoded
+  slots = new frameSlot[depth+1];
+  for (int i=0; i<=depth; i++) {
+    slots[i].index = -1;
+    slots[i].state = SLOT_EMPTY;
+    slots[i].pinned = 0;
+    slots[i].pixels = (byte*)memalign(16, frameSize);
+  }
+
+  workers = new pthread_t[workerNum];
+  for (int i=0; i<workerNum; i++) {
+    if (pthread_create(&workers[i], NULL, workerThread, (void*)this) != 0) {
+      fprintf(stderr, "imagePrefetcher: can't create decode thread\n");
+      workerNum = i;
+      break;
+    }
+  }
+}
+
+imagePrefetcher::~imagePrefetcher()
+{
+  pthread_mutex_lock(&lock);
+  running = false;
+  pthread_cond_broadcast(&workCond);
+  pthread_mutex_unlock(&lock);
+
+  for (int i=0; i<workerNum; i++)
+    pthread_join(workers[i], NULL);
+  delete [] workers;
+
+  for (int i=0; i<=depth; i++)
+    memfree(slots[i].pixels);
+  delete [] slots;
+
+  pthread_cond_destroy(&readyCond);
+  pthread_cond_destroy(&workCond);
+  pthread_mutex_destroy(&lock);
+}
+
+void* imagePrefetcher::workerThread(void *args)
+{
+  imagePrefetcher *This = (imagePrefetcher *)args;
+  This->workerLoop();
+
+  pthread_exit(NULL);
+  return NULL;
+}
+
+// frames are played in a loop, so the window wraps around
+bool imagePrefetcher::inWindow(int index)
+{
+  int num = (int)files.size();
+  int dist = (index - base + num) % num;
+  return dist < depth;
+}
+
+int imagePrefetcher::findSlot(int index)
+{
+  for (int i=0; i<=depth; i++)
+    if (slots[i].index == index && slots[i].state != SLOT_EMPTY)
+      return i;
+
+  return -1;
+}
+
+int imagePrefetcher::claimSlot()
+{
+  // prefer empty slots, then frames that fell out of the window
+  for (int i=0; i<=depth; i++)
+    if (slots[i].state == SLOT_EMPTY)
+      return i;
+
+  for (int i=0; i<=depth; i++)
+    if (slots[i].state == SLOT_READY && !slots[i].pinned && !inWindow(slots[i].index))
+      return i;
+
+  return -1;
+}
+
+// called with lock held
+bool imagePrefetcher::nextJob(int &slot, int &index)
+{
+  int num = (int)files.size();
+  int ahead = depth < num ? depth : num;
+
+  // decode in playback order from the start of the window
+  for (int k=0; k<ahead; k++) {
+    int idx = (base + k) % num;
+    if (findSlot(idx) >= 0)
+      continue;
+
+    slot = claimSlot();
+    if (slot < 0)
+      return false;
+
+    index = idx;
+    return true;
+  }
+
+  return false;
+}
+
+void imagePrefetcher::workerLoop()
+{
+  pthread_mutex_lock(&lock);
+
+  while (running) {
+    int slot, index;
+    if (!nextJob(slot, index)) {
+      pthread_cond_wait(&workCond, &lock);
+      continue;
+    }
+
+    frameSlot &s = slots[slot];
+    s.index = index;
+    s.state = SLOT_DECODING;
+    pthread_mutex_unlock(&lock);
+
+    double t0 = aTime();
+    // taken before decoding, a change while decoding shows on the next run
+    struct stat src;
+    bool known = (stat(files[index].c_str(), &src) == 0);
+    bool cached = known && readCache(index, s.pixels, src);
+    if (!cached) {
+      decode(index, s.pixels);
+      if (known)
+        writeCache(index, s.pixels, src);
+    }
+    double t1 = aTime();
+
+    pthread_mutex_lock(&lock);
+    s.state = SLOT_READY;
+    decodeTime += t1 - t0;
+    if (cached)
+      cachedFrames++;
+    else
+      decodedFrames++;
+    pthread_cond_broadcast(&readyCond);
+    pthread_cond_broadcast(&workCond);
+  }
+
+  pthread_mutex_unlock(&lock);
+}
+
+double imagePrefetcher::copyFrame(int index, byte *dst)
+{
+  double t0 = aTime();
+
+  pthread_mutex_lock(&lock);
+
+  // move the window and let the workers refill it
+  base = index;
+  pthread_cond_broadcast(&workCond);
+
+  int slot = findSlot(index);
+  while (slot < 0 || slots[slot].state != SLOT_READY) {
+    pthread_cond_wait(&readyCond, &lock);
+    slot = findSlot(index);
+  }
+
+  // keep the slot from being recycled while copying
+  slots[slot].pinned++;
+  pthread_mutex_unlock(&lock);
+
+  double wait = aTime() - t0;
+
+  memcpy(dst, slots[slot].pixels, frameSize);
+
+  pthread_mutex_lock(&lock);
+  slots[slot].pinned--;
+  pthread_cond_broadcast(&workCond);
+  pthread_mutex_unlock(&lock);
+
+  return wait;
+}
+
+void imagePrefetcher::getStats(double &decodeSec, int &decoded, int &cached)
+{
+  pthread_mutex_lock(&lock);
+  decodeSec = decodeTime;
+  decoded = decodedFrames;
+  cached = cachedFrames;
+  decodeTime = 0.0;
+  decodedFrames = cachedFrames = 0;
+  pthread_mutex_unlock(&lock);
+}
+
+std::string imagePrefetcher::cachePath(int index)
+{
+  // images of the same name in different directories get their own file
+  char full[PATH_MAX];
+  std::string path = files[index];
+  if (realpath(path.c_str(), full))
+    path = full;
+
+  // 64-bit FNV-1a
+  unsigned long long hash = 14695981039346656037ULL;
+  for (size_t i=0; i<path.size(); i++) {
+    hash ^= (unsigned char)path[i];
+    hash *= 1099511628211ULL;
+  }
+
+  std::string name = path;
+  size_t slash = name.rfind('/');
+  if (slash != std::string::npos)
+    name = name.substr(slash+1);
+
+  char key[32];
+  sprintf(key, "-%016llx.rgb", hash);
+
+  return cacheDir + "/" + name + key;
+}
+
+bool imagePrefetcher::readCache(int index, byte *dst, struct stat &src)
+{
+  if (cacheDir.empty())
+    return false;
+
+  std::string path = cachePath(index);
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  size_t len = sizeof(cacheHeader) + frameSize;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size != len) {
+    close(fd);
+    return false;
+  }
+
+  void *map = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return false;
+
+  bool valid = false;
+  cacheHeader *hdr = (cacheHeader *)map;
+  if (hdr->magic == PREFETCH_CACHE_MAGIC && hdr->width == width && hdr->height == height &&
+      hdr->srcSize == (long long)src.st_size && hdr->srcMtime == (long long)src.st_mtime) {
+    madvise(map, len, MADV_SEQUENTIAL);
+    memcpy(dst, (byte *)map + sizeof(cacheHeader), frameSize);
+    valid = true;
+  }
+
+  munmap(map, len);
+
+  return valid;
+}
+
+void imagePrefetcher::writeCache(int index, byte *src, struct stat &st)
+{
+  if (cacheDir.empty())
+    return;
+
+  // write to a temporary file first so that a concurrent run
+  // never maps a partially written frame
+  std::string path = cachePath(index);
+  char tmpPath[1024];
+  sprintf(tmpPath, "%s.%d.tmp", path.c_str(), (int)getpid());
+
+  FILE *f = fopen(tmpPath, "wb");
+  if (!f) {
+    fprintf(stderr, "imagePrefetcher: can't write cache file %s\n", tmpPath);
+    return;
+  }
+
+  cacheHeader hdr;
+  hdr.magic = PREFETCH_CACHE_MAGIC;
+  hdr.width = width;
+  hdr.height = height;
+  hdr.pad = 0;
+  hdr.srcSize = (long long)st.st_size;
+  hdr.srcMtime = (long long)st.st_mtime;
+
+  bool ok = (fwrite(&hdr, sizeof(hdr), 1, f) == 1) &&
+    (fwrite(src, frameSize, 1, f) == 1);
+  fclose(f);
+
+  if (!ok || rename(tmpPath, path.c_str()) != 0)
+    unlink(tmpPath);
+}
+
+void imagePrefetcher::decode(int index, byte *dst)
+{
+  MagickWand *wand = NewMagickWand();
+
+  if (MagickReadImage(wand, files[index].c_str()) == MagickFalse) {
+    fprintf(stderr, "imagePrefetcher: can't read %s\n", files[index].c_str());
+    memset(dst, 0, frameSize);
+  }
+  else {
+    // images of a different size are cropped/padded to the series size
+    unsigned int w = MagickGetImageWidth(wand);
+    unsigned int h = MagickGetImageHeight(wand);
+    if (w != width || h != height)
+      memset(dst, 0, frameSize);
+    MagickExportImagePixels(wand, 0, 0, width, height, "RGB", CharPixel, dst);
+  }
+
+  DestroyMagickWand(wand);
+}
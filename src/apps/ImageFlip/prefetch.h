@@ -0,0 +1,124 @@
+/*****************************************************************************************
+ * imageflip: decode-ahead pipeline for image sequences
+ *
+ * Copyright (C) 2007 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc to www.evl.uic.edu/cavern/forum
+ *
+ *****************************************************************************************/
+
+#ifndef IMAGEFLIP_PREFETCH_H
+#define IMAGEFLIP_PREFETCH_H
+
+#include <pthread.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+
+typedef unsigned char byte;
+
+// magic number at the start of a cached raw frame
+#define PREFETCH_CACHE_MAGIC 0x53524732   // "SRG2"
+
+/**
+ * Decodes the frames following the current one with a pool of worker
+ * threads into a bounded ring of RGB buffers, so that flipping to the
+ * next image only costs a copy into the SAIL buffer.
+ *
+ * If a cache directory is given, every decoded frame is also written there
+ * as raw RGB and memory-mapped instead of decoded on later runs. Cache files
+ * are named after a hash of the image's full path and hold its size and
+ * modification time, so a changed image is decoded again.
+ */
+class imagePrefetcher {
+private:
+  enum slotState { SLOT_EMPTY, SLOT_DECODING, SLOT_READY };
+
+  struct frameSlot {
+    int index;       // frame held by the slot, -1 if none
+    slotState state;
+    int pinned;      // being copied out by the player
+    byte *pixels;
+  };
+
+  std::vector<std::string> files;
+  unsigned int width, height;
+  size_t frameSize;
+  std::string cacheDir;
+
+  frameSlot *slots;
+  int depth;         // number of frames decoded ahead
+  int base;          // first frame of the decode-ahead window
+
+  pthread_t *workers;
+  int workerNum;
+  bool running;
+  pthread_mutex_t lock;
+  pthread_cond_t  workCond;   // window moved or a slot was freed
+  pthread_cond_t  readyCond;  // a frame was decoded
+
+  // statistics, protected by lock
+  double decodeTime;
+  int decodedFrames;
+  int cachedFrames;
+
+  static void* workerThread(void *args);
+  void workerLoop();
+  bool inWindow(int index);
+  int findSlot(int index);
+  int claimSlot();
+  bool nextJob(int &slot, int &index);
+
+  std::string cachePath(int index);
+  bool readCache(int index, byte *dst, struct stat &src);
+  void writeCache(int index, byte *src, struct stat &st);
+  void decode(int index, byte *dst);
+
+public:
+  imagePrefetcher(std::vector<std::string> &names, unsigned int w, unsigned int h,
+                  int threads, int ahead, const char *cache = NULL);
+  ~imagePrefetcher();
+
+  /**
+   * copies frame index (0-based) into dst, waiting for it if it isn't
+   * decoded yet, and moves the decode-ahead window to start there
+   */
+  double copyFrame(int index, byte *dst);
+
+  /**
+   * returns the decode time spent by the workers (in seconds) and the
+   * number of frames decoded or read from the cache since the last call
+   */
+  void getStats(double &decodeSec, int &decoded, int &cached);
+
+  inline int getFrameNum() { return (int)files.size(); }
+};
+
+#endif
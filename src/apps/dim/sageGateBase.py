@@ -58,6 +58,8 @@
         Rotate Window                   1018
         Push to Back                    1019
         Save Screenshot                 1020
+        Record Wall                     1021
+        Record Stream                   1022
   
 	SAGE Shutdown                   1100
 	Add Object                      1200
@@ -630,6 +632,28 @@ class SageGateBase:
 		return self.sendmsg(data, 1020)
 
 
+	####################################	
+	# record the wall to per-tile images at a low rate
+	# 1021 path to directory where to record (or "stop"), interval in ms
+	##################################################################
+	def recordWall(self, path, interval=1000):
+		if not self.connected: return 0
+
+		data = path + " " + str(int(interval))
+		return self.sendmsg(data, 1021)
+
+
+	####################################	
+	# record the pixel stream of an app on every display node
+	# 1022 app-inst-ID path to directory where to record (or "stop")
+	##################################################################
+	def recordStream(self, appId, path):
+		if not self.connected: return 0
+
+		data = str(appId) + " " + path
+		return self.sendmsg(data, 1022)
+
+
 	####################################	
 	# Change App Properties
 	# 1011 appId, fsmIP, fsmPort, appConfigNum	
@@ -40,6 +40,7 @@ extern "C" {
 // headers for SAGE
 #include "sail.h"
 #include "misc.h"
+#include "sagePixelConvert.h"
 #include "appWidgets.h"
 
 // sail object
@@ -672,31 +673,9 @@ static int draw_frame(uint8_t *src[])
     else {
       if (image_format==IMGFMT_RGB24 && stereo_mode==1) {
         // memcpy(rgbBuffer, (unsigned char *)ImageData, image_width*image_height*3);
-        int stride = image_width/2;
-        int bpp = 6;
-        if (rightfirst)
-          for (int i=0;i<image_height;i++) {
-            for (int j=0;j<stride;j++) {
-              rgbBuffer[i*stride*bpp + j*bpp + 0] = ImageData[i*image_width*3 + j*3 + 0]; // Red   left
-              rgbBuffer[i*stride*bpp + j*bpp + 1] = ImageData[i*image_width*3 + j*3 + 1]; // Green left
-              rgbBuffer[i*stride*bpp + j*bpp + 2] = ImageData[i*image_width*3 + j*3 + 2]; // Blue  left
-              rgbBuffer[i*stride*bpp + j*bpp + 3] = ImageData[i*image_width*3 + stride*3 + j*3 + 0]; // Red   right
-              rgbBuffer[i*stride*bpp + j*bpp + 4] = ImageData[i*image_width*3 + stride*3 + j*3 + 1]; // Green right
-              rgbBuffer[i*stride*bpp + j*bpp + 5] = ImageData[i*image_width*3 + stride*3 + j*3 + 2]; // Blue  right
-            }
-          }
-        else
-          for (int i=0;i<image_height;i++) {
-            for (int j=0;j<stride;j++) {
-              rgbBuffer[i*stride*bpp + j*bpp + 3] = ImageData[i*image_width*3 + j*3 + 0]; // Red   left
-              rgbBuffer[i*stride*bpp + j*bpp + 4] = ImageData[i*image_width*3 + j*3 + 1]; // Green left
-              rgbBuffer[i*stride*bpp + j*bpp + 5] = ImageData[i*image_width*3 + j*3 + 2]; // Blue  left
-              rgbBuffer[i*stride*bpp + j*bpp + 0] = ImageData[i*image_width*3 + stride*3 + j*3 + 0]; // Red   right
-              rgbBuffer[i*stride*bpp + j*bpp + 1] = ImageData[i*image_width*3 + stride*3 + j*3 + 1]; // Green right
-              rgbBuffer[i*stride*bpp + j*bpp + 2] = ImageData[i*image_width*3 + stride*3 + j*3 + 2]; // Blue  right
-            }
-          }
-
+        // left and right halves interleaved pixel by pixel, the left one first with rightfirst
+        sageConvertImage(ImageData, CONVFMT_RGB_SBS, rgbBuffer, PIXFMT_RGBS3D, image_width/2, image_height,
+                         false, rightfirst ? 0 : CONV_SWAP_EYES);
       } else {
         // not yet implemented
       }
@@ -40,11 +40,6 @@ void* pBits = NULL;
 int IsLion = 0;  // Assume it's not MacOSX Lion, by default
 CGDirectDisplayID *displays; // displays[] Quartz display ID's
 long displaysIndex = 0; // default display
-
-#include "pixfc-sse.h"
-struct PixFcSSE *       pixfc;
-PixFcPixelFormat        output_format = PixFcUYVY;
-PixFcPixelFormat        input_format  = PixFcBGRA;
 #endif
 
 // headers for SAGE
@@ -53,6 +48,12 @@ PixFcPixelFormat        input_format  = PixFcBGRA;
 // Compression
 #include "libdxt.h"
 
+// the capture interval (in ms) backs off up to this while the screen doesn't change
+#define IDLE_INTERVAL 200
+
+// damage below 1/SMALL_DAMAGE of the screen is captured at up to twice the frame rate
+#define SMALL_DAMAGE  16
+
 // headers for SAGE
 GLubyte *rgbBuffer = NULL;
 GLubyte *yuvBuffer = NULL;
@@ -95,6 +96,11 @@ CaptureWindow::CaptureWindow(QWidget *parent) : QMainWindow(parent)
   showcursor = true;
   //showcursor = false;
   ui.checkBox_2->setChecked(showcursor);
+  fullFrame = true;
+  interval = 1000/fps;
+  frame = NULL;
+  dxtTile = dxtBlocks = NULL;
+  lastCursor.x = lastCursor.y = lastCursor.w = lastCursor.h = 0;
 
 #if defined(__APPLE__)
   // Determine the OS version
@@ -191,13 +197,6 @@ CaptureWindow::CaptureWindow(QWidget *parent) : QMainWindow(parent)
 
     displaysIndex = 0;
     fprintf(stderr, "display number: %d - %d\n", dspCount, displays[displaysIndex]);
-
-    // Create struct pixfc
-    //if (create_pixfc(&pixfc, input_format, output_format, WW, HH, PixFcFlag_BT709Conversion) != 0) {
-    if (create_pixfc(&pixfc, input_format, output_format, WW, HH, WW*4, PixFcFlag_BT709Conversion) != 0) {
-      fprintf(stderr, "Error creating struct pixfc\n");
-    }
-
   }
   /////////////////////////
 #endif
@@ -302,6 +301,9 @@ CaptureWindow::CaptureWindow(QWidget *parent) : QMainWindow(parent)
   x11grab->y_off = 0;
   x11grab->image = image;
   x11grab->use_shm = use_shm;
+
+  // only the parts of the screen that changed are captured
+  tracker = new damageTracker(dpy);
 #endif
 
 #if defined(WIN32)
@@ -322,6 +324,8 @@ CaptureWindow::CaptureWindow(QWidget *parent) : QMainWindow(parent)
   SelectObject(hCaptureDC,hCaptureBitmap);
 #endif
 
+  lastDirty = new damageRegion(WW, HH);
+
   // Enables buttons
   ui.pushButton->setEnabled(true);
   ui.pushButton_2->setEnabled(false);
@@ -402,7 +406,12 @@ void CaptureWindow::fsIP(QString f)
 void CaptureWindow::update()
 {
   if (sageInf && started) {
+    bool changed = true;
+    int area = WW*HH;
 
+#if defined(__linux__)
+    changed = captureDamage(area);
+#else
     // Capture the desktop pixels
 #if defined(__APPLE__)
     if ( IsLion ) {
@@ -425,23 +434,36 @@ void CaptureWindow::update()
     }
 
     swapBuffer(sageInf);
+#endif
 
 
     processMessages(sageInf,NULL,NULL,NULL);
 
+    if (!changed) {
+      // nothing to send, look again a bit later each time
+      interval = MIN(IDLE_INTERVAL, 2*interval);
+      timer->start(interval);
+      return;
+    }
+
+    // small areas, like a moving window or a video, are updated faster
+    interval = 1000/fps;
+    if (area*SMALL_DAMAGE < WW*HH)
+      interval = MAX(1000/60, interval/2);
+
     QString str;
     double nowt = dxt_aTime();
     //qDebug() << "now " << nowt << "   startt" << startt;
     double dfps = 1.0 / (nowt - startt);
-    str = QString("%1 ms / %2 fps/ # %3 / DXT %4 / %5x%6").arg(nowt-startt,5,'f',1).arg(dfps,5,'f',1).arg(count++).arg(dxt).arg(WW).arg(HH);
+    str = QString("%1 ms / %2 fps/ # %3 / DXT %4 / %5x%6 / damage %7%").arg(nowt-startt,5,'f',1).arg(dfps,5,'f',1).arg(count++).arg(dxt).arg(WW).arg(HH).arg(area*100/(WW*HH));
     ui.statusBar->showMessage( str, 0 );
 
 #if 1
-    if (dfps < fps) {
-      timer->start( MAX(0, (2*(1000/fps)-(1000/dfps) ) ) );
+    if (dfps < 1000/interval) {
+      timer->start( MAX(0, (2*interval-(1000/dfps) ) ) );
     }
     else
-      timer->start(1000/fps);
+      timer->start(interval);
 #else
     timer->start(0);
 #endif
@@ -449,6 +471,161 @@ void CaptureWindow::update()
   }
 }
 
+#if defined(__linux__)
+
+/**
+ * captures the parts of the screen that changed since the last call and
+ * sends them. Returns false if nothing changed, nothing is sent then
+ */
+bool CaptureWindow::captureDamage(int &area)
+{
+  damageRegion dirty(WW, HH);
+
+  if (!tracker->collect(dirty) || fullFrame)
+    dirty.addAll();
+  fullFrame = false;
+
+  // the cursor is drawn by us: redraw where it was and where it is now,
+  // and when the screen changed under it
+  damageRect cur = cursorRect();
+  if (cur.x != lastCursor.x || cur.y != lastCursor.y || cur.w != lastCursor.w) {
+    dirty.add(lastCursor);
+    dirty.add(cur);
+  }
+  else if (cur.w > 0 && dirty.intersects(cur))
+    dirty.add(cur);
+  lastCursor = cur;
+
+  area = dirty.area();
+
+  // the SAIL buffer we get next still misses what was sent last time
+  if (dirty.empty() && lastDirty->empty())
+    return false;
+
+  int nbytes = dxt ? 4 : 3;
+  for (int i=0; i<dirty.size(); i++)
+    grabRect(dirty[i], frame, nbytes);
+
+  if (!dirty.empty())
+    drawCursor((char*)frame, nbytes);
+
+  damageRegion toSend(WW, HH);
+  toSend.add(dirty);
+  toSend.add(*lastDirty);
+
+  unsigned char *buffer = nextBuffer(sageInf);
+  for (int i=0; i<toSend.size(); i++) {
+    if (dxt)
+      compressRect(toSend[i], buffer);
+    else
+      copyRect(toSend[i], buffer, nbytes);
+  }
+
+  swapBuffer(sageInf);
+
+  *lastDirty = dirty;
+
+  return true;
+}
+
+/**
+ * reads a screen area from the X server into dst, upside-down and
+ * converted from BGRA to RGB (nbytes 3) or RGBA (nbytes 4)
+ */
+void CaptureWindow::grabRect(const damageRect &r, unsigned char *dst, int nbytes)
+{
+  Display *dpy = x11grab->dpy;
+  Window root = RootWindow(dpy, DefaultScreen(dpy));
+  XImage *image;
+
+  if (x11grab->use_shm) {
+    int scr = DefaultScreen(dpy);
+    image = XShmCreateImage(dpy, DefaultVisual(dpy, scr), DefaultDepth(dpy, scr), ZPixmap,
+                            x11grab->shminfo.shmaddr, &x11grab->shminfo, r.w, r.h);
+    if (!image)
+      return;
+
+    if (!XShmGetImage(dpy, root, image, r.x, r.y, AllPlanes)) {
+      SAGE_PRINTLOG("QSHARE> XShmGetImage() failed");
+      image->data = NULL;
+      image->obdata = NULL;
+      XDestroyImage(image);
+      return;
+    }
+  }
+  else {
+    image = XGetImage(dpy, root, r.x, r.y, r.w, r.h, AllPlanes, ZPixmap);
+    if (!image) {
+      SAGE_PRINTLOG("QSHARE> XGetImage() failed");
+      return;
+    }
+  }
+
+  for (int i = 0 ; i < r.h; i++) {
+    unsigned char *src = (unsigned char*)image->data + i*image->bytes_per_line;
+    unsigned char *out = dst + ((HH-1-(r.y+i))*WW + r.x) * nbytes;
+    for (int j = 0 ; j < r.w; j++, src += 4, out += nbytes) {
+      out[0] = src[2];
+      out[1] = src[1];
+      out[2] = src[0];
+      if (nbytes == 4)
+        out[3] = 255;
+    }
+  }
+
+  // the shared memory segment belongs to x11grab
+  if (x11grab->use_shm) {
+    image->data = NULL;
+    image->obdata = NULL;
+  }
+  XDestroyImage(image);
+}
+
+void CaptureWindow::copyRect(const damageRect &r, unsigned char *dst, int nbytes)
+{
+  for (int row = HH - r.y - r.h; row < HH - r.y; row++) {
+    int offset = (row*WW + r.x) * nbytes;
+    memcpy(dst + offset, frame + offset, r.w * nbytes);
+  }
+}
+
+/**
+ * compresses a 4x4-aligned area of the frame and puts its DXT1 blocks at
+ * their place in the compressed image dst
+ */
+void CaptureWindow::compressRect(const damageRect &r, unsigned char *dst)
+{
+  int top = HH - r.y - r.h;
+  for (int i = 0; i < r.h; i++)
+    memcpy(dxtTile + i*r.w*4, frame + ((top+i)*WW + r.x)*4, r.w*4);
+
+  int nbytes = 0;
+  CompressImageDXT1(dxtTile, dxtBlocks, r.w, r.h, nbytes);
+
+  // DXT1 stores 8 bytes per block, one row of blocks after the other
+  int rowBytes = (r.w/4) * 8;
+  for (int i = 0; i < r.h/4; i++)
+    memcpy(dst + ((top/4 + i)*(WW/4) + r.x/4)*8, dxtBlocks + i*rowBytes, rowBytes);
+}
+
+#endif
+
+damageRect CaptureWindow::cursorRect()
+{
+  damageRect r;
+  r.x = r.y = r.w = r.h = 0;
+
+  if (showcursor && screenHasCursor()) {
+    QPoint pt = QCursor::pos();
+    r.x = pt.x();
+    r.y = pt.y();
+    r.w = cursor_icon->width();
+    r.h = cursor_icon->height();
+  }
+
+  return r;
+}
+
 bool CaptureWindow::screenHasCursor()
 {
 #if defined(__linux__)
@@ -515,8 +692,8 @@ void CaptureWindow::capture(char* m_pFrameRGB,int x,int y,int cx,int cy)
 
     drawCursor((char*)rgbBuffer, 4, 0);
 
-    // Do conversion
-    pixfc->convert(pixfc, rgbBuffer, m_pFrameRGB);
+    // BGRA into the UYVY of the stream
+    sageConvertImage(rgbBuffer, CONVFMT_BGRA, m_pFrameRGB, PIXFMT_YUV, WW, HH);
 
     // Free stuff
     CFRelease(dref);
@@ -540,23 +717,13 @@ void CaptureWindow::capture(char* m_pFrameRGB,int x,int y,int cx,int cy)
 #endif
 
 #if defined(__linux__)
-  if (x11grab->use_shm) {
-    if (!XShmGetImage(x11grab->dpy, RootWindow(x11grab->dpy, DefaultScreen(x11grab->dpy)),
-                      x11grab->image, 0, 0, AllPlanes)) {
-      SAGE_PRINTLOG("QSHARE> XShmGetImage() failed");
-    }
-    else {
-      // Upside-down and RGBA-to-RGB conversion
-      for (int i = 0 ; i < cy; i++) {
-        for (int j = 0 ; j < cx; j++) {
-          m_pFrameRGB [ (i*cx+j) * 3 + 0 ] = x11grab->image->data [ ((cy-i-1)*cx+j) * 4 + 2 ];
-          m_pFrameRGB [ (i*cx+j) * 3 + 1 ] = x11grab->image->data [ ((cy-i-1)*cx+j) * 4 + 1 ];
-          m_pFrameRGB [ (i*cx+j) * 3 + 2 ] = x11grab->image->data [ ((cy-i-1)*cx+j) * 4 + 0 ];
-        }
-      }
-      drawCursor(m_pFrameRGB, 3);
-    }
-  }
+  damageRect all;
+  all.x = x;
+  all.y = y;
+  all.w = cx;
+  all.h = cy;
+  grabRect(all, (unsigned char*)m_pFrameRGB, 3);
+  drawCursor(m_pFrameRGB, 3);
 #endif
 
 #if defined(WIN32)
@@ -625,6 +792,23 @@ void CaptureWindow::onStart()
 #endif
     }
 
+#if defined(__linux__)
+    // copy of the desktop the damaged areas are captured into
+    if (frame) free(frame);
+    frame = (unsigned char*)memalign(16, WW*HH*4);
+    memset(frame, 0, WW*HH*4);
+
+    if (dxt) {
+      if (dxtTile) free(dxtTile);
+      if (dxtBlocks) free(dxtBlocks);
+      dxtTile   = (unsigned char*)memalign(16, WW*HH*4);
+      dxtBlocks = (unsigned char*)memalign(16, WW*HH/2);
+    }
+#endif
+    fullFrame = true;
+    lastDirty->clear();
+    interval = 1000/fps;
+
     timer->setSingleShot(true);
     timer->start(1000/fps);
     //timer->start();
@@ -673,6 +857,7 @@ void CaptureWindow::onPause()
   else {
     qDebug() << "UnPause";
     started = true;
+    fullFrame = true;
     timer->start(1000/fps);
   }
 }
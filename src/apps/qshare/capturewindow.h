@@ -10,6 +10,7 @@
 #include <QPainter>
 #include <QDesktopWidget>
 #include "ui_capturewindow.h"
+#include "damage.h"
 
 #if defined(__APPLE__)
 // Mac Headers
@@ -53,6 +54,17 @@ private:
   int WW, HH;
   QString fsip;
 
+  // incremental capture
+  bool fullFrame;            // next capture grabs the whole screen
+  int interval;              // current capture interval in ms
+  damageRegion *lastDirty;   // areas sent in the previous frame
+  damageRect lastCursor;
+  unsigned char *frame;      // last captured desktop, bottom-to-top
+  unsigned char *dxtTile, *dxtBlocks;
+#if defined(__linux__)
+  damageTracker *tracker;
+#endif
+
 #if defined(__APPLE__)
   CGLContextObj  glContextObj;
 #endif
@@ -61,6 +73,13 @@ private:
   void capture(char* m_pFrameRGB,int x,int y,int cx,int cy);
   void drawCursor(char *pixels, int nbytes, int flip = 1);
   bool screenHasCursor();
+  damageRect cursorRect();
+#if defined(__linux__)
+  bool captureDamage(int &area);
+  void grabRect(const damageRect &r, unsigned char *dst, int nbytes);
+  void copyRect(const damageRect &r, unsigned char *dst, int nbytes);
+  void compressRect(const damageRect &r, unsigned char *dst);
+#endif
 };
 
 #endif // CAPTUREWINDOW_H
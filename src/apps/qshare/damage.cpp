@@ -0,0 +1,136 @@
+#include "damage.h"
+
+// headers for SAGE
+#include "libsage.h"
+
+bool damageRegion::overlap(const damageRect &a, const damageRect &b)
+{
+  return a.x < b.x+b.w && b.x < a.x+a.w && a.y < b.y+b.h && b.y < a.y+a.h;
+}
+
+damageRect damageRegion::unite(const damageRect &a, const damageRect &b)
+{
+  damageRect r;
+  r.x = MIN(a.x, b.x);
+  r.y = MIN(a.y, b.y);
+  r.w = MAX(a.x+a.w, b.x+b.w) - r.x;
+  r.h = MAX(a.y+a.h, b.y+b.h) - r.y;
+  return r;
+}
+
+void damageRegion::add(int x, int y, int w, int h)
+{
+  // grow to whole blocks and clip to the screen
+  int x0 = MAX(0, x) / DAMAGE_ALIGN * DAMAGE_ALIGN;
+  int y0 = MAX(0, y) / DAMAGE_ALIGN * DAMAGE_ALIGN;
+  int x1 = MIN(width,  (x + w + DAMAGE_ALIGN - 1) / DAMAGE_ALIGN * DAMAGE_ALIGN);
+  int y1 = MIN(height, (y + h + DAMAGE_ALIGN - 1) / DAMAGE_ALIGN * DAMAGE_ALIGN);
+
+  if (x1 <= x0 || y1 <= y0)
+    return;
+
+  damageRect r;
+  r.x = x0;
+  r.y = y0;
+  r.w = x1 - x0;
+  r.h = y1 - y0;
+
+  // merge with the rectangles it overlaps, so no pixel is captured twice
+  for (int i=0; i<(int)rects.size(); ) {
+    if (overlap(rects[i], r)) {
+      r = unite(rects[i], r);
+      rects.erase(rects.begin() + i);
+      i = 0;
+    }
+    else
+      i++;
+  }
+
+  rects.push_back(r);
+
+  if ((int)rects.size() > DAMAGE_MAX_RECTS) {
+    damageRect box = rects[0];
+    for (int i=1; i<(int)rects.size(); i++)
+      box = unite(box, rects[i]);
+    rects.clear();
+    rects.push_back(box);
+  }
+}
+
+void damageRegion::add(const damageRegion &region)
+{
+  for (int i=0; i<(int)region.rects.size(); i++)
+    add(region.rects[i]);
+}
+
+bool damageRegion::intersects(const damageRect &r)
+{
+  for (int i=0; i<(int)rects.size(); i++)
+    if (overlap(rects[i], r))
+      return true;
+
+  return false;
+}
+
+int damageRegion::area()
+{
+  int sum = 0;
+  for (int i=0; i<(int)rects.size(); i++)
+    sum += rects[i].w * rects[i].h;
+
+  return sum;
+}
+
+#if defined(__linux__)
+
+damageTracker::damageTracker(Display *d) : dpy(d), damage(0), region(0), available(false)
+{
+  if (!dpy)
+    return;
+
+  if (!XDamageQueryExtension(dpy, &eventBase, &errorBase)) {
+    SAGE_PRINTLOG("QSHARE> XDamage extension not found, capturing the whole screen");
+    return;
+  }
+
+  int major = 1, minor = 1;
+  XDamageQueryVersion(dpy, &major, &minor);
+  SAGE_PRINTLOG("QSHARE> XDamage extension %d.%d found", major, minor);
+
+  damage = XDamageCreate(dpy, RootWindow(dpy, DefaultScreen(dpy)), XDamageReportNonEmpty);
+  region = XFixesCreateRegion(dpy, NULL, 0);
+  available = true;
+}
+
+damageTracker::~damageTracker()
+{
+  if (available) {
+    XFixesDestroyRegion(dpy, region);
+    XDamageDestroy(dpy, damage);
+  }
+}
+
+bool damageTracker::collect(damageRegion &dirty)
+{
+  if (!available)
+    return false;
+
+  // drop the notify events, the damage is read from the server below
+  XEvent event;
+  while (XPending(dpy))
+    XNextEvent(dpy, &event);
+
+  XDamageSubtract(dpy, damage, None, region);
+
+  int num = 0;
+  XRectangle *rects = XFixesFetchRegion(dpy, region, &num);
+  for (int i=0; i<num; i++)
+    dirty.add(rects[i].x, rects[i].y, rects[i].width, rects[i].height);
+
+  if (rects)
+    XFree(rects);
+
+  return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+#include <vector>
+
+#if defined(__linux__)
+#include <X11/Xlib.h>
+#include <X11/extensions/Xdamage.h>
+#endif
+
+// damaged areas are captured and compressed in 4x4 pixel blocks (DXT)
+#define DAMAGE_ALIGN     4
+
+// more rectangles than that are merged into their bounding box
+#define DAMAGE_MAX_RECTS 32
+
+struct damageRect {
+  int x, y, w, h;
+};
+
+/**
+ * list of changed areas of the screen, in screen coordinates.
+ * Rectangles are aligned to DAMAGE_ALIGN, clipped to the screen and
+ * overlapping ones are merged
+ */
+class damageRegion {
+private:
+  std::vector<damageRect> rects;
+  int width, height;
+
+  static bool overlap(const damageRect &a, const damageRect &b);
+  static damageRect unite(const damageRect &a, const damageRect &b);
+
+public:
+  damageRegion(int w, int h) : width(w), height(h) {}
+
+  void add(int x, int y, int w, int h);
+  void add(const damageRect &r) { add(r.x, r.y, r.w, r.h); }
+  void add(const damageRegion &region);
+  void addAll() { add(0, 0, width, height); }
+  bool intersects(const damageRect &r);
+
+  void clear() { rects.clear(); }
+  bool empty() { return rects.empty(); }
+  int size() { return (int)rects.size(); }
+  const damageRect& operator[](int i) { return rects[i]; }
+
+  /** number of pixels in the region */
+  int area();
+};
+
+#if defined(__linux__)
+
+/**
+ * reports which parts of the root window changed, using the XDamage
+ * extension of the X server
+ */
+class damageTracker {
+private:
+  Display *dpy;
+  Damage damage;
+  XserverRegion region;
+  int eventBase, errorBase;
+  bool available;
+
+public:
+  damageTracker(Display *d);
+  ~damageTracker();
+
+  inline bool isAvailable() { return available; }
+
+  /**
+   * adds the areas changed since the last call to dirty. Returns false if
+   * XDamage isn't available, the caller should then assume everything changed
+   */
+  bool collect(damageRegion &dirty);
+};
+
+#endif
+
+#endif // DAMAGE_H
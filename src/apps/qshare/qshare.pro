@@ -26,14 +26,15 @@ FORMS = capturewindow.ui
 SOURCES = \
 main.cpp \
 capturewindow.cpp \
+damage.cpp \
 FastDXT/libdxt.cpp \
 FastDXT/dxt.cpp \
 FastDXT/util.cpp \
 FastDXT/intrinsic.cpp
 
-HEADERS += capturewindow.h
+HEADERS += capturewindow.h damage.h
 
-INCLUDEPATH += FastDXT pixfc-sse
+INCLUDEPATH += FastDXT
 
 QMAKE_CXXFLAGS += -DDXT_INTR
 
@@ -41,11 +42,11 @@ RC_FILE = qsharerc.rc
 
 macx { 
     INCLUDEPATH += ../../include
-    LIBS += -Lpixfc-sse/macosx64 -lpixfc-sse -L/Users/luc/Dev/SVN/sage-new/lib -lsail -framework OpenGL -framework Cocoa -framework IOKit -lobjc -lm
+    LIBS += -L/Users/luc/Dev/SVN/sage-new/lib -lsail -framework OpenGL -framework Cocoa -framework IOKit -lobjc -lm
 }
 unix:!macx { 
     INCLUDEPATH += $$SRC_DIR/sage
-    LIBS += -L$$LIB_DIR -lsail -lquanta -lXext -lX11
+    LIBS += -L$$LIB_DIR -lsail -lquanta -lXdamage -lXfixes -lXext -lX11
 }
 win32 {
     QMAKE_CXXFLAGS += -D_CRT_SECURE_NO_WARNINGS
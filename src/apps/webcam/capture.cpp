@@ -32,14 +32,12 @@
 
 /////////////////////
 // headers for SAGE
-#include "pixfc-sse.h"
 #include "libsage.h"
 sail *sageInf; // sail object
 int winWidth, winHeight;
 
-PixFcPixelFormat                src_fmt = PixFcYUYV;
-PixFcPixelFormat                dst_fmt = PixFcRGB24;
-struct PixFcSSE *               pixfc = NULL;
+// layout of the captured frames, converted into RGB by SAIL
+sageConvFmt camFmt = CONVFMT_YUYV;
 ////////////////////
 
 static void stop_capturing(void);
@@ -90,19 +88,12 @@ void appQuit(sail* si)
   stop_capturing ();
   uninit_device ();
   close_device ();
-  destroy_pixfc(pixfc);
 }
 
 static void
 process_image(const void *p)
 {
-#if 0
-  void *buffer = nextBuffer(sageInf);
-  pixfc->convert(pixfc, (void*)p, buffer);
-  swapBuffer(sageInf);
-#else
-  swapWithBuffer(sageInf, (unsigned char*)p);
-#endif
+  convertWithBuffer(sageInf, (unsigned char*)p, camFmt);
 
   processMessages(sageInf,NULL,NULL,NULL);
 }
@@ -637,13 +628,22 @@ init_device                     (void)
   fmt.type                = V4L2_BUF_TYPE_VIDEO_CAPTURE;
   fmt.fmt.pix.width       = winWidth;
   fmt.fmt.pix.height      = winHeight;
-  fmt.fmt.pix.pixelformat = V4L2_PIX_FMT_RGB24; // V4L2_PIX_FMT_YUYV;
+  fmt.fmt.pix.pixelformat = V4L2_PIX_FMT_YUYV;
   fmt.fmt.pix.field       = V4L2_FIELD_NONE;    // V4L2_FIELD_ANY;
 
   // if (-1 == xioctl (fd, VIDIOC_S_FMT, &fmt))
   //   errno_exit ("VIDIOC_S_FMT");
   xioctl (fd, VIDIOC_S_FMT, &fmt);
 
+  // cameras without YUYV : let libv4l2 convert into RGB
+  if (fmt.fmt.pix.pixelformat != V4L2_PIX_FMT_YUYV) {
+    fmt.fmt.pix.width       = winWidth;
+    fmt.fmt.pix.height      = winHeight;
+    fmt.fmt.pix.pixelformat = V4L2_PIX_FMT_RGB24;
+    xioctl (fd, VIDIOC_S_FMT, &fmt);
+    camFmt = CONVFMT_RGB;
+  }
+
   /* Note VIDIOC_S_FMT may change width and height. */
 
   /* Buggy driver paranoia. */
@@ -800,14 +800,7 @@ main (int                    argc,
   // SAGE
   /////////////////////////////
   sageInf = createSAIL("webcam", winWidth, winHeight, PIXFMT_888, NULL, TOP_TO_BOTTOM);
-  SAGE_PRINTLOG("SAGE Initialized: %dx%d", winWidth, winHeight);
-
-  uint32_t code;
-  code = create_pixfc(&pixfc, src_fmt, dst_fmt, winWidth, winHeight, PixFcFlag_Default);
-  if (code !=0) {
-    fprintf (stderr, "Error create_pixfc: %d\n", code);
-    exit (EXIT_FAILURE);
-  }
+  SAGE_PRINTLOG("SAGE Initialized: %dx%d, capturing %s", winWidth, winHeight, sageConvFmtName(camFmt));
   /////////////////////////////
 
   start_capturing ();
@@ -820,8 +813,6 @@ main (int                    argc,
 
   close_device ();
 
-  destroy_pixfc(pixfc);
-
   exit (EXIT_SUCCESS);
 
   return 0;
@@ -47,6 +47,9 @@
 
 extern int verbose;
 
+/* io_uring submission queue size; reads beyond it are submitted in batches */
+#define BP_URING_ENTRIES  256
+
 static bpbuf_t *bpbufinit( bpbuf_t *bpb, bpio_t *bpio, int nbufs )
 {
   int pagesize = getpagesize();
@@ -65,7 +68,7 @@ static bpbuf_t *bpbufinit( bpbuf_t *bpb, bpio_t *bpio, int nbufs )
   bpb->filepos = 0LL;   /* probably changed later by bpopen() */
   bpb->wrappos = 0LL;   /* filled in later by bpstart */
   bpb->eofpos  = 0LL;
-  bpb->wp = bpb->rp = 0;  /* initially empty */
+  bpb->wp = bpb->rp = bpb->sp = 0;  /* initially empty */
 
   bpb->bufsize = bpio->bufsize;
   bpb->readsize = bpio->readsize;
@@ -89,6 +92,25 @@ static bpbuf_t *bpbufinit( bpbuf_t *bpb, bpio_t *bpio, int nbufs )
   bpb->doloop = 0;
   bpb->fd = -1;
   bpb->filling = 0;
+  bpb->uring = 0;
+
+#ifdef BP_URING
+  /* Keep reads for all free buffers in flight if the kernel lets us,
+   * else fall back to one blocking read() at a time.
+   */
+  bpb->pending = (int *)calloc( nbufs, sizeof(int) );
+  bpb->inflight = 0;
+  bpb->done = NULL;
+  bpb->ndone = 0;
+  if(io_uring_queue_init( BP_URING_ENTRIES, &bpb->ring, 0 ) == 0) {
+    bpb->uring = 1;
+    bpb->ringup = 1;
+    pthread_create( &bpb->bthread, NULL, bpuringfiller, (void *)bpb );
+    return bpb;
+  }
+  if(verbose)
+    fprintf(stderr, "bpio: io_uring unavailable, using read()\n");
+#endif
 
   /* Start the thread.  It will realize that filling==0 and go to sleep.
    */
@@ -136,9 +158,16 @@ int bpbempty( bpbuf_t *bpb )
   return bpb->wp == bpb->rp;
 }
 
+/* More data coming?  Still filling, or buffers rp..sp-1 still being read */
+int bpbmore( bpbuf_t *bpb )
+{
+  return bpb->filling || bpb->rp != bpb->sp;
+}
+
+/* Full when the next buffer to fill is the one being drained (shown) */
 int bpbfull( bpbuf_t *bpb )
 {
-  return (bpb->wp+1) % bpb->nbufs == bpb->rp;
+  return (bpb->rp+1) % bpb->nbufs == bpb->wp;
 }
 
 void bpbstop( bpbuf_t *bpb )
@@ -150,13 +179,47 @@ void bpbstop( bpbuf_t *bpb )
     pthread_cond_signal( &bpb->bdrainwait );
 }
 
+/* Wrap filepos around the loop range, or stop at its ends.  Called locked. */
+static void bpbwrap( bpbuf_t *bpb )
+{
+  if(bpb->filepos >= bpb->eofpos) {
+    if(!bpb->doloop || bpb->wrappos >= bpb->eofpos) {
+      bpb->filling = 0;
+    } else {
+      /* Going forwards beyond EOF, need to wrap backwards */
+      bpb->filepos = bpb->wrappos + (bpb->filepos - bpb->eofpos);
+    }
+
+  } else if(bpb->filepos < bpb->wrappos) {
+    if(!bpb->doloop || bpb->wrappos >= bpb->eofpos) {
+      bpb->filling = 0;
+    } else {
+      /* Going backwards, need to wrap forwards */
+      bpb->filepos = bpb->eofpos + (bpb->filepos - bpb->wrappos);
+    }
+  }
+}
+
+/* Part e of each buffer to read: offset and length */
+static int bpextent( bpbuf_t *bpb, int e, off_t *off )
+{
+  bpio_t *bpio = bpb->bpio;
+
+  if(bpio->nextents <= 0) {
+    *off = 0;
+    return bpb->bufsize;
+  }
+  *off = bpio->extoff[e];
+  return bpio->extlen[e];
+}
+
 /* file-reader (bpb-queue-filler) thread */
 void *bpfiller( void *vbpb )
 {
   bpbuf_t *bpb = (bpbuf_t *)vbpb;
-  int want;
-  unsigned char *p;
-  off_t filepos;
+  int want, e, next;
+  unsigned char *p, *base;
+  off_t filepos, off;
   int normaleof;
 
   pthread_mutex_lock( &bpb->bmut );
@@ -176,25 +239,10 @@ void *bpfiller( void *vbpb )
     /* Now we fill bpb->bufs[ bpb->rp ] */
     /* It's all ours now, so run unlocked */
 
-    want = bpb->bufsize;
-    p = bpb->bufs[ bpb->rp ];
+    base = bpb->bufs[ bpb->rp ];
+    next = bpb->bpio->nextents > 0 ? bpb->bpio->nextents : 1;
 
-    if(bpb->filepos >= bpb->eofpos) {
-      if(!bpb->doloop || bpb->wrappos >= bpb->eofpos) {
-        bpb->filling = 0;
-      } else {
-        /* Going forwards beyond EOF, need to wrap backwards */
-        bpb->filepos = bpb->wrappos + (bpb->filepos - bpb->eofpos);
-      }
-
-    } else if(bpb->filepos < bpb->wrappos) {
-      if(!bpb->doloop || bpb->wrappos >= bpb->eofpos) {
-        bpb->filling = 0;
-      } else {
-        /* Going backwards, need to wrap forwards */
-        bpb->filepos = bpb->eofpos + (bpb->filepos - bpb->wrappos);
-      }
-    }
+    bpbwrap( bpb );
 
     if(bpb->filepos <0||verbose>=3)
       printf("T%02d r%02d w%02d: rpos %02lld -> %lld\n",
@@ -205,40 +253,238 @@ void *bpfiller( void *vbpb )
     bpb->curpos[ bpb->rp ] = bpb->filepos;
     filepos = bpb->filepos;
     bpb->filepos += bpb->incrpos;
+    bpb->sp = (bpb->rp + 1) % bpb->nbufs;
     bpb->busy = 1;
 
     pthread_mutex_unlock( &bpb->bmut );
 
-    lseek( bpb->fd, filepos, 0 );
-
     normaleof = 0;
-    while(want > 0 && bpb->filling) {
-      int now = want < bpb->readsize ? want : bpb->readsize;
-      int got = read( bpb->fd, p, now );
-      if(got < 0 && errno == EINTR)
-        continue;
-      if(got <= 0) {
-        /* 0-fill remainder of this buffer and stop reading. */
-        memset(p, 0, want);
-        bpbstop( bpb );
-        if(got == 0) normaleof = 1;
-        break;
-
-      } else {
-        want -= got;
-        p += got;
+    for(e = 0; e < next && bpb->filling; e++) {
+      want = bpextent( bpb, e, &off );
+      p = base + off;
+      while(want > 0 && bpb->filling) {
+        int now = want < bpb->readsize ? want : bpb->readsize;
+        int got = pread( bpb->fd, p, now, filepos + off );
+        if(got < 0 && errno == EINTR)
+          continue;
+        if(got <= 0) {
+          /* 0-fill remainder of this buffer and stop reading. */
+          memset(p, 0, want);
+          bpbstop( bpb );
+          if(got == 0) normaleof = 1;
+          break;
+
+        } else {
+          want -= got;
+          p += got;
+          off += got;
+        }
       }
     }
 
     pthread_mutex_lock( &bpb->bmut );
 
     if(bpb->filling || normaleof) {
-      bpb->rp = (bpb->rp + 1) % bpb->nbufs;
+      bpb->rp = bpb->sp;
     } else {
       bpb->curpos[ bpb->rp] = -1LL; /* mark buffer as invalid */
+      bpb->sp = bpb->rp;
+      bpb->busy = 0;
+    }
+
+    if(bpb->drainwaiting) /* is drainer waiting for data? */
+      pthread_cond_signal( &bpb->bdrainwait );
+  }
+
+  /* In case anyone ever 'break's from above loop */
+  pthread_mutex_unlock( &bpb->bmut );
+  return NULL;
+}
+
+#ifdef BP_URING
+
+static void bpuringreap( bpbuf_t *bpb, int wait );
+
+/* Queue the reads that fill buffer b from file offset filepos. */
+static void bpuringprep( bpbuf_t *bpb, int b, off_t filepos )
+{
+  int e, len;
+  int next = bpb->bpio->nextents > 0 ? bpb->bpio->nextents : 1;
+  off_t off;
+
+  if(bpb->ndone < bpb->nbufs * next) {
+    bpb->ndone = bpb->nbufs * next;
+    bpb->done = (int *)realloc( bpb->done, bpb->ndone * sizeof(int) );
+  }
+
+  for(e = 0; e < next; e++) {
+    struct io_uring_sqe *sqe = io_uring_get_sqe( &bpb->ring );
+    if(sqe == NULL) {
+      /* submission queue is full -- push it to the kernel and go on */
+      io_uring_submit( &bpb->ring );
+      sqe = io_uring_get_sqe( &bpb->ring );
+    }
+    if(sqe == NULL && bpb->inflight > 0) {
+      /* the kernel is backed up -- collect the completions already
+       * there to make room.  We hold bmut, so don't wait for more.
+       */
+      bpuringreap( bpb, 0 );
+      io_uring_submit( &bpb->ring );
+      sqe = io_uring_get_sqe( &bpb->ring );
+    }
+    if(sqe == NULL) {
+      /* give up on the rest of this buffer, as on a read error */
+      if(verbose)
+        fprintf(stderr, "bpio: io_uring submission queue full\n");
+      bpb->curpos[b] = -1LL; /* mark buffer as invalid */
+      bpbstop( bpb );
+      return;
+    }
+    len = bpextent( bpb, e, &off );
+    io_uring_prep_read( sqe, bpb->fd, bpb->bufs[b] + off, len, filepos + off );
+    io_uring_sqe_set_data( sqe, (void *)(long)(b * next + e) );
+    bpb->done[ b * next + e ] = 0;
+    bpb->pending[b]++;
+    bpb->inflight++;
+  }
+}
+
+/*
+ * Collect the reads that have completed, first waiting for at least one
+ * if wait is set.  Only the filler touches pending[] and inflight, so
+ * this runs unlocked; it may be called locked only without waiting.
+ */
+static void bpuringreap( bpbuf_t *bpb, int wait )
+{
+  struct io_uring_cqe *cqe = NULL;
+  int next = bpb->bpio->nextents > 0 ? bpb->bpio->nextents : 1;
+  int status = wait ? io_uring_wait_cqe( &bpb->ring, &cqe )
+                    : io_uring_peek_cqe( &bpb->ring, &cqe );
+
+  while(status == 0 && cqe != NULL) {
+    long id = (long)io_uring_cqe_get_data( cqe );
+    int b = id / next, e = id % next;
+    int res = cqe->res;
+    off_t off;
+    int want = bpextent( bpb, e, &off );
+
+    io_uring_cqe_seen( &bpb->ring, cqe );
+
+    if(res > 0)
+      bpb->done[id] += res;
+    off += bpb->done[id];
+    want -= bpb->done[id];
+
+    if(res > 0 && want > 0) {
+      /* short read -- go back for the rest with the same id */
+      struct io_uring_sqe *sqe = io_uring_get_sqe( &bpb->ring );
+      if(sqe != NULL) {
+        io_uring_prep_read( sqe, bpb->fd, bpb->bufs[b] + off, want,
+                            bpb->curpos[b] + off );
+        io_uring_sqe_set_data( sqe, (void *)id );
+        io_uring_submit( &bpb->ring );
+        status = io_uring_peek_cqe( &bpb->ring, &cqe );
+        continue;
+      }
+    }
+
+    if(want > 0) {
+      /* EOF or error: 0-fill remainder of this buffer and stop reading. */
+      memset( bpb->bufs[b] + off, 0, want );
+      if(res < 0) {
+        if(verbose)
+          fprintf(stderr, "bpio: read error %d\n", -res);
+        bpb->curpos[b] = -1LL; /* mark buffer as invalid */
+      }
+      bpbstop( bpb );
+    }
+
+    bpb->pending[b]--;
+    bpb->inflight--;
+
+    status = io_uring_peek_cqe( &bpb->ring, &cqe );
+  }
+}
+
+/* Pass completed buffers on to the drainer, in order.  Called locked. */
+static void bpuringpass( bpbuf_t *bpb )
+{
+  while(bpb->rp != bpb->sp && bpb->pending[ bpb->rp ] == 0) {
+    if(bpb->curpos[ bpb->rp ] < 0) {
+      bpb->sp = bpb->rp; /* drop the failed buffer and the rest */
+      break;
+    }
+    bpb->rp = (bpb->rp + 1) % bpb->nbufs;
+  }
+}
+
+/*
+ * file-reader thread using io_uring: rather than one blocking read() at a
+ * time, keeps reads for every free buffer in flight and hands buffers to
+ * the drainer in order as they complete.
+ * Buffers rp..sp-1 are being read, wp..rp-1 are ready to be drained.
+ */
+void *bpuringfiller( void *vbpb )
+{
+  bpbuf_t *bpb = (bpbuf_t *)vbpb;
+  off_t filepos;
+  int nsub;
+
+  pthread_mutex_lock( &bpb->bmut );
+
+  for(;;) {
+
+    /* Start reading into every free buffer */
+    nsub = 0;
+    while(bpb->filling && (bpb->sp+1) % bpb->nbufs != bpb->wp) {
+      bpbwrap( bpb );
+      if(!bpb->filling)
+        break;
+
+      if(verbose>=3)
+        printf("T%02d s%02d w%02d: rpos %02lld -> %lld\n",
+               (int) (bpb - bpb->bpio->bpb), bpb->sp, bpb->wp,
+               (long long)(bpb->filepos / bpb->bufsize), (long long)bpb->filepos);
+
+      filepos = bpb->filepos;
+      bpb->curpos[ bpb->sp ] = filepos;
+      bpb->filepos += bpb->incrpos;
+      bpuringprep( bpb, bpb->sp, filepos );
+      bpb->sp = (bpb->sp + 1) % bpb->nbufs;
+      nsub++;
+    }
+
+    if(bpb->inflight == 0) {
+      /* A buffer given up on before any of its reads went out */
+      bpuringpass( bpb );
+      if(bpb->drainwaiting)
+        pthread_cond_signal( &bpb->bdrainwait );
+
+      /* Nothing to wait for: sleep until started or a buffer is drained */
+      bpb->fillwaiting = 1;
       bpb->busy = 0;
+      pthread_cond_wait( &bpb->bfillwait, &bpb->bmut );
+      bpb->fillwaiting = 0;
+      continue;
     }
 
+    bpb->busy = 1;
+    pthread_mutex_unlock( &bpb->bmut );
+
+    if(nsub > 0)
+      io_uring_submit( &bpb->ring );
+    bpuringreap( bpb, 1 );
+
+    /* If we've been stopped, let everything in flight land
+     * before bpseek() et al. get to reuse the buffers.
+     */
+    while(!bpb->filling && bpb->inflight > 0)
+      bpuringreap( bpb, 1 );
+
+    pthread_mutex_lock( &bpb->bmut );
+
+    bpuringpass( bpb );
+
     if(bpb->drainwaiting) /* is drainer waiting for data? */
       pthread_cond_signal( &bpb->bdrainwait );
   }
@@ -248,13 +494,23 @@ void *bpfiller( void *vbpb )
   return NULL;
 }
 
+#endif /* BP_URING */
+
 void bpclose( bpio_t *bpio )
 {
   int i;
 
+  bpstop( bpio );
+  bpsync( bpio );   /* let the reads in flight land */
+
   for(i = 0; i < bpio->nfillers; i++) {
     bpbuf_t *bpb = &bpio->bpb[i];
-    bpbstop( bpb );
+#ifdef BP_URING
+    if(bpb->uring && bpb->ringup) {
+      io_uring_queue_exit( &bpb->ring );
+      bpb->ringup = 0;
+    }
+#endif
     if(bpb->fd >= 0) {
       close(bpb->fd);
       bpb->fd = -1;
@@ -281,6 +537,15 @@ int bpopen( bpio_t *bpio, char *fname )
       perror(fname);
       return -1;
     }
+#ifdef BP_URING
+    if(bpb->uring && !bpb->ringup) {
+      if(io_uring_queue_init( BP_URING_ENTRIES, &bpb->ring, 0 ) != 0) {
+        fprintf(stderr, "bpio: can't set up io_uring for %s\n", fname);
+        return -1;
+      }
+      bpb->ringup = 1;
+    }
+#endif
     /* Request direct I/O in Solaris' way too, but don't worry if we can't */
 #ifdef DIRECTIO_ON
     directio( bpb->fd, DIRECTIO_ON );
@@ -329,7 +594,7 @@ void bpseek( bpio_t *bpio, off_t pos )
 
     bpbstop( bpb );
 
-    bpb->rp = bpb->wp = 0;
+    bpb->rp = bpb->wp = bpb->sp = 0;
     for(b = 0; b < bpb->nbufs; b++)
       bpb->curpos[b] = -1LL;
 
@@ -363,6 +628,57 @@ void bprange( bpio_t *bpio, off_t from, off_t to )
   }
 }
 
+/*
+ * Read only the given parts of each buffer, e.g. the visible tiles of a
+ * tiled movie; the rest of the buffer is left as it was.  Extents must be
+ * in increasing order; they're widened to page boundaries (for O_DIRECT)
+ * and merged where they touch.  n = 0 reads whole buffers again.
+ * Call while stopped, e.g. before bpstart().
+ */
+void bpextents( bpio_t *bpio, int n, off_t *offs, int *lens )
+{
+  int pagesize = getpagesize();
+  int i, k = 0;
+
+  bpstop( bpio );
+  bpsync( bpio );
+
+  free( bpio->extoff );
+  free( bpio->extlen );
+  bpio->extoff = NULL;
+  bpio->extlen = NULL;
+  bpio->nextents = 0;
+
+  if(n <= 0)
+    return;
+
+  bpio->extoff = (off_t *)malloc( n * sizeof(off_t) );
+  bpio->extlen = (int *)malloc( n * sizeof(int) );
+
+  for(i = 0; i < n; i++) {
+    off_t from = offs[i] & ~(off_t)(pagesize - 1);
+    off_t to = (offs[i] + lens[i] + pagesize - 1) & ~(off_t)(pagesize - 1);
+    if(to > bpio->bufsize)
+      to = bpio->bufsize;
+    if(from >= to)
+      continue;
+
+    if(k > 0 && from <= bpio->extoff[k-1] + bpio->extlen[k-1]) {
+      /* overlaps or touches the previous one */
+      if(to > bpio->extoff[k-1] + bpio->extlen[k-1])
+        bpio->extlen[k-1] = (int)(to - bpio->extoff[k-1]);
+    } else {
+      bpio->extoff[k] = from;
+      bpio->extlen[k] = (int)(to - from);
+      k++;
+    }
+  }
+  bpio->nextents = k;
+
+  if(verbose >= 2)
+    printf("reading %d extents per buffer\n", k);
+}
+
 void bpstart( bpio_t *bpio, int wrap )
 {
   int i;
@@ -416,15 +732,16 @@ int bpdrain( bpio_t *bpio, int (*sink)( unsigned char *, int, void * ), void *ar
   for(;;) {
     bpbuf_t *bpb = &bpio->bpb[ bpio->drain ];
 
-    if(!bpb->filling) /* if EOF or bpstop() or etc. */
-      break;
-
     pthread_mutex_lock( &bpb->bmut );
-    while(bpbempty( bpb )) {
+    while(bpbempty( bpb ) && bpbmore( bpb )) {
       bpb->drainwaiting = 1;
       pthread_cond_wait( &bpb->bdrainwait, &bpb->bmut );
       bpb->drainwaiting = 0;
     }
+    if(bpbempty( bpb )) { /* if EOF or bpstop() or etc. -- and all drained */
+      pthread_mutex_unlock( &bpb->bmut );
+      break;
+    }
     pthread_mutex_unlock( &bpb->bmut );
 
     /* Make use of bpb->bufs[ bpb->wp ] someday */
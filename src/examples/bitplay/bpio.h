@@ -44,6 +44,10 @@
 #include <fcntl.h>
 #include <pthread.h>
 
+#ifdef BP_URING
+#include <liburing.h>
+#endif
+
 typedef struct bpbuf_s bpbuf_t;
 
 typedef struct bpio_s {
@@ -54,6 +58,10 @@ typedef struct bpio_s {
   int drain;    /* next bpbuf_t to drain (dynamic, but owned by drain thread) */
   int fwd;    /* bpb->incrpos = fwd * nfillers * bufsize */
 
+  int nextents; /* parts of each buffer to read, 0 = the whole buffer */
+  off_t *extoff;  /* extoff[0..nextents-1] -- page-aligned offsets in buffer */
+  int *extlen;  /* extlen[0..nextents-1] -- page-rounded lengths */
+
 } bpio_t;
 
 /* Is someone waiting on our condition-variable?  Why? */
@@ -85,6 +93,17 @@ struct bpbuf_s {
   volatile off_t  filepos;/* file offset for next buffer to be filled*/
   volatile int  wp; /* next-buffer-to-be-drained (to display) index */
   volatile int  rp; /* next-buffer-to-be-filled (from file) index */
+  volatile int  sp; /* buffers rp..sp-1 are being read */
+
+  int     uring;  /* reading through io_uring rather than read()? */
+#ifdef BP_URING
+  struct io_uring ring;
+  int     ringup; /* ring set up? (torn down by bpclose, again by bpopen) */
+  int     *pending; /* pending[0..nbufs-1] -- reads in flight per buffer */
+  int     inflight; /* total reads in flight */
+  int     *done;  /* done[buffer*nextents + extent] -- bytes read so far */
+  int     ndone;  /* allocated size of done[] */
+#endif
 
   pthread_t      bthread;
   pthread_mutex_t  bmut;
@@ -97,6 +116,7 @@ extern void bpclose( bpio_t *bpio );
 extern int bpopen( bpio_t *bpio, char *fname );
 extern int bpbfull( bpbuf_t *bpb );
 extern int bpbempty( bpbuf_t *bpb );
+extern int bpbmore( bpbuf_t *bpb );
 extern bpio_t *bpinit( bpio_t *bpio, int nfillers, int bufsize, int readsize, int nbufseach );
 extern void bpseek( bpio_t *bpio, off_t pos );
 extern unsigned char *bpcurbuf( bpio_t *bpio );
@@ -105,8 +125,12 @@ extern void bpstart( bpio_t *bpio, int wrap );
 extern void bpstop( bpio_t *bpio );
 extern void bpforward( bpio_t *bpio, int fwd );
 extern void bprange( bpio_t *bpio, off_t from, off_t to );
+extern void bpextents( bpio_t *bpio, int n, off_t *offs, int *lens );
 
 extern void *bpfiller( void *vbpb );
+#ifdef BP_URING
+extern void *bpuringfiller( void *vbpb );
+#endif
 extern int  bpdrain( bpio_t *bpio, int (*sink)( unsigned char *buf, int nbytes, void *arg ), void *arg );
 extern void bpsync( bpio_t *bpio );
 
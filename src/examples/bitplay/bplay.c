@@ -59,6 +59,7 @@
 #include "sail.h"
 #include "appWidgets.h"
 #include "misc.h"
+#include "libsage.h"
 sail sageInf; // sail object
 unsigned char *rgbBuffer = 0;
 float pixelSize = 3.0;
@@ -147,7 +148,7 @@ int bpawaitone( bpio_t *bpio )
   bpbuf_t *bpb = &playlist[curplay].bpb[ bpio->drain ];
 
   pthread_mutex_lock( &bpb->bmut );
-  while(bpbempty( bpb ) && bpb->filling) {
+  while(bpbempty( bpb ) && bpbmore( bpb )) {
     bpb->drainwaiting = 1;
     pthread_cond_wait( &bpb->bdrainwait, &bpb->bmut );
     bpb->drainwaiting = 0;
@@ -161,7 +162,8 @@ int bpconsume1( bpio_t *bpio )
 {
   bpbuf_t *bpb =  &bpio->bpb[ bpio->drain ];
 
-  if(!bpb->filling) /* if EOF or bpstop() or etc. */
+  /* if EOF or bpstop() or etc., and nothing left queued */
+  if(!bpbmore( bpb ) && bpbempty( bpb ))
     return 0;
 
   pthread_mutex_lock( &bpb->bmut );
@@ -655,12 +657,51 @@ int openmovie( bpio_t *bpio, char *fname, bpmvhead_t *bpmv )
   return head.nframes;
 }
 
+/*
+ * Read only tile columns x0..x1-1 of each frame, the ones draweye() uses:
+ * e.g. the left half of a stereo movie shown in mono.
+ */
+void readtiles( bpio_t *bpio, bpmvhead_t *bpmv, int x0, int x1 )
+{
+  int i, j, n = 0;
+  off_t *offs;
+  int *lens;
+
+  if(x0 <= 0 && x1 >= bpmv->nxtile) {
+    bpextents( bpio, 0, NULL, NULL );
+    return;
+  }
+
+  offs = (off_t *)malloc( bpmv->nxtile * bpmv->nytile * sizeof(off_t) );
+  lens = (int *)malloc( bpmv->nxtile * bpmv->nytile * sizeof(int) );
+  for(i = 0; i < bpmv->nytile; i++) {
+    for(j = x0; j < x1; j++, n++) {
+      offs[n] = (off_t)i*bpmv->ytilestride + (off_t)j*bpmv->xtilestride;
+      lens[n] = bpmv->ytile * bpmv->tilerowstride;
+    }
+  }
+  bpextents( bpio, n, offs, lens );
+  free( offs );
+  free( lens );
+}
+
 void draweye( bpmvhead_t *bpmv, unsigned int *txs, unsigned char *tilebuf,
               float scl, float imxsz, float xoff, float yoff, int x0, int x1, float *xagain )
 {
   //struct txcodes *txc = &txcode[ bpmv->format ];
   int i,j,k, ii;
 
+  /* A single column of tiles is laid out just like the SAIL buffer:
+   * stream the read buffer in place.  SAGE is done with it once the
+   * next frame is streamed, and the fillers never refill the buffer
+   * just behind the one being drained.
+   */
+  if(bpmv->nxtile == 1 && x0 == 0 && x1 == 1 && xagain == NULL) {
+    streamWithBuffer( &sageInf, tilebuf );
+    rgbBuffer = (unsigned char *)sageInf.getBuffer();
+    return;
+  }
+
   for(i = k = 0; i < bpmv->nytile; i++) {
     for(j = x0; j < x1; j++, k++) {
 
@@ -982,6 +1023,7 @@ int main(int argc, char *argv[])
    Options:\n\
    -f NNN target NNN frames/sec or -f NNNm milliseconds/frame\n\
    -t NTHREADS  number of reader threads\n\
+   -b NBUFS  number of frames queued per reader thread (default %d)\n\
    -r READSIZE  size of each read() in bytes (default = image size)\n\
    -M msfudge fudge factor for ms/frame timing estimates (default %d)\n\
    -v   verbose\n\
@@ -1114,10 +1156,14 @@ int main(int argc, char *argv[])
       exit(1);
     }
     totalframes +=  frames;
+
+    /* In mono, only the left eye of a stereo movie is ever shown */
+    if(stereo == MONO && (mvlist[i].flags & BPF_STEREO))
+      readtiles( &playlist[i], &mvlist[i], 0, mvlist[i].nxtile/2 );
   }
 
   if(nplay <= 0 && port == 0) {
-    fprintf(stderr, Usage, prog, msfudge);
+    fprintf(stderr, Usage, prog, nbufseach, msfudge);
     exit(1);
   }
 
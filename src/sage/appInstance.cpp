@@ -47,7 +47,7 @@
 
 appInstance::appInstance(char *msgStr, int id, bridgeSharedData *sh) : instID(id), shared(sh),
                                                                        firstSyncGroup(NULL), firstSyncID(0), initialized(false), maxStreamerIdx(0),
-                                                                       blockSize(0), groupSize(0)
+                                                                       blockSize(0), groupSize(0), blockBuf(NULL), recv(NULL)
 {
   sscanf(msgStr, "%s %d %d %d %d %d %s %d %d %d %d %d", appName, &x, &y, &width, &height,
          (int *)&sConfig.protocol, fsIP, &fsPort, &imageWidth, &imageHeight, &blockNum,
@@ -349,6 +349,14 @@ int appInstance::accumulateBandWidth(char *data)
   return 0;
 }
 
+int appInstance::bufStatus()
+{
+  if (!initialized || !blockBuf)
+    return 0;
+
+  return blockBuf->getStatus();
+}
+
 int appInstance::findValidIdx()
 {
   int i=0;
@@ -445,12 +453,14 @@ int appInstance::parseMessage(sageMessage &msg, int fsIdx)
   }
 
   case SAIL_FRAME_RATE : {
-    if (initialized) {
-      //float frate = atof(msgData);
-      //if (nodeNum > 1 && shared->nodeID == 0)
-      //   streamerList[fsIdx]->getSyncGroup()->setFrameRate(frate);
-      //else
-      //   streamerList[fsIdx]->setFrameRate(frate);
+    // each wall sets the rate of its own streamer, -1 goes back to the app's rate.
+    // A streamer slower than the app skips to the newest frame
+    if (initialized && nodeNum == 1 && streamerList[fsIdx]) {
+      float frate = atof(msgData);
+      if (frate <= 0)
+        frate = sConfig.frameRate;
+      if (frate > 0)
+        streamerList[fsIdx]->setFrameRate(frate);
     }
     break;
   }
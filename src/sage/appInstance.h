@@ -123,6 +123,7 @@ public:
   int parseMessage(sageMessage &msg, int fsIdx);
   bool isActive();
   int accumulateBandWidth(char *data);
+  int bufStatus(); /**< occupancy of the block buffer in percent */
   int allocateNodes(int policy, int nodeID = 0);
   friend class sageBridge;
 };
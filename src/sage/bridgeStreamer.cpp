@@ -44,6 +44,14 @@
 //#include "streamInfo.h"
 #include "sageBlockPartition.h"
 #include "sageSharedData.h"
+#include "sageTelemetry.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telFrames = telemetry.counter("sage_bridge_frames_total", "frames forwarded by the bridge");
+static int telBytes = telemetry.counter("sage_bridge_bytes_total", "bytes forwarded by the bridge");
+static int telDropped = telemetry.counter("sage_bridge_dropped_frames_total", "frames skipped by slow streamers");
+static int telSyncWait = telemetry.histogram("sage_bridge_sync_wait_us", "time the bridge nodes wait for each other, in microsecs");
+static int telSend = telemetry.histogram("sage_bridge_send_us", "time to forward a frame, in microsecs");
 #include "messageInterface.h"
 
 bridgeStreamer::bridgeStreamer(streamerConfig &conf, sageBlockBuf *buf, bridgeSharedData *sh)
@@ -69,6 +77,7 @@ bridgeStreamer::bridgeStreamer(streamerConfig &conf, sageBlockBuf *buf, bridgeSh
   interval = 1000000.0/config.frameRate;
   firstFrame = true;
   accInterval = 0.0;
+  droppedFrames = 0;
 
   SAGE_PRINTLOG("%s() : sibal 3\n", __FUNCTION__);
 }
@@ -153,6 +162,7 @@ int bridgeStreamer::streamLoop()
     if (config.nodeNum > 1){
       //SAGE_PRINTLOG("node %d syncGroup %d send update %d", config.rank, config.syncID, frameID);
       if ( config.syncClientObj ) {
+        telemetryTimer syncTimer(telSyncWait);
         config.syncClientObj->sendSlaveUpdate(frameID, config.syncID, config.nodeNum, updateType);
         updateType = SAGE_UPDATE_FOLLOW;
         syncMsgStruct *syncMsg = config.syncClientObj->waitForSync(config.syncID);
@@ -191,14 +201,22 @@ int bridgeStreamer::streamLoop()
     if (config.nodeNum == 1)
       checkInterval();
 
+    double sendStart = sage::getTime();
+    unsigned long sentBefore = totalBandWidth;
+
     /* will not return until END_FRAME */
     int totalBlockNum = streamPixelData();
     if (totalBlockNum < 0) {
       streamerOn = false;
     }
     else {
-      //SAGE_PRINTLOG("bridgeStreamer::%s() : sent %d pixel blocks for frame %d\n\n", __FUNCTION__, totalBlockNum, frameID);
+      telemetry.observe(telSend, (long long)(sage::getTime() - sendStart));
+      telemetry.add(telFrames);
     }
+
+    // the performance report resets totalBandWidth now and then
+    if (totalBandWidth > sentBefore)
+      telemetry.add(telBytes, totalBandWidth - sentBefore);
   }
 
   SAGE_PRINTLOG("bridgeStreamer::%s() : network thread exit", __FUNCTION__);
@@ -220,15 +238,21 @@ int bridgeStreamer::streamPixelData()
 
   int TotalBlockNumCounter = 0;
 
+  // Every streamer reads the block buffer at its own pace. One that fell
+  // behind (slow network or lower frame rate of its wall) goes on with the
+  // newest complete frame, so it doesn't keep the buffer full for the others.
+  // With several bridge nodes, the sync groups decide which frame is sent
+  if (config.frameDrop && config.nodeNum == 1) {
+    int skipped = blockBuffer->skipToNewestFrame(config.streamerID);
+    if (skipped > 0) {
+      droppedFrames += skipped;
+      telemetry.add(telDropped, skipped);
+    }
+  }
+
   while (loop) {
-    //      SAGE_PRINTLOG("waiting for data");
+    // blocks until a group arrives, NULL if the streamer was removed
     sageBlockGroup *sbg = blockBuffer->front(config.streamerID, frameID);
-    //      SAGE_PRINTLOG("get data");
-
-    while (streamerOn && !sbg) {
-      blockBuffer->next(config.streamerID);
-      sbg = blockBuffer->front(config.streamerID);
-    }
 
     if (!sbg)
       return -1;
@@ -396,5 +420,5 @@ void bridgeStreamer::shutdown()
   for (int j=0; j<rcvNodeNum; j++)
     nwObj->close(params[j].rcvID, SAGE_SEND);
 
-  SAGE_PRINTLOG("< bridgeStreamer shutdown >");
+  SAGE_PRINTLOG("< bridgeStreamer shutdown > streamer %d skipped %u frames", config.streamerID, droppedFrames);
 }
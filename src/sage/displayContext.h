@@ -80,11 +80,15 @@ protected:
   bool winCreatFlag;
   int tileNum;
   bool singleContext;
+  bool partialClear;  // can clear one tile without touching the others
 
 public:
-  displayContext() : winCreatFlag(false) {}
+  displayContext() : winCreatFlag(false), partialClear(false) {}
   virtual int init(struct sageDisplayConfig &cfg) = 0;
   virtual void clearScreen() {}
+  virtual void clearTile(int i, sageRect &tileRect) {}
+  inline bool canClearTile() { return partialClear; }
+  virtual int bufferAge() { return 0; }  // swaps since the back buffer was drawn, 0 if unknown
   virtual void setupViewport(int i, sageRect &tileRect) {}
   virtual void refreshTile(int i) {}
   virtual void refreshScreen() {}
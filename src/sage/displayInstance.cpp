@@ -51,6 +51,8 @@ displayInstance::displayInstance(fsManager *f, int id, appInExec* app) : fsm(f),
   receiverList.clear();
   sailClient = appExec->sailClient;
   zValue = 0;
+  configID = 0;
+  lastDisplayID = -1;
 
   //imageSize = appExec->imageWidth * appExec->imageHeight * appExec->bytesPerPixel;
   //if (imageSize == 0) {
@@ -73,6 +75,7 @@ displayInstance::displayInstance(fsManager *f, int id, appInExec* app) : fsm(f),
   }
 
   waitNodes = dispNodeNum;
+  frameShown = false;
   rcvFlagCnt = 0;
 
   SAGE_PRINTLOG("Establishing network connections for streams......");
@@ -96,11 +99,31 @@ void displayInstance::generateStreamInfo(void)
 
 int displayInstance::streamInfoToSender(void)
 {
-  // send new stream info to recevers
+  // the sender numbers the configurations the same way
+  configID++;
+
+  // send new stream info to the receivers the window covers now or covered
+  // before, the others keep showing nothing of it
   char msgStr[TOKEN_LEN];
-  streamGrp.createRcvMsg(winID, msgStr);
-  fsm->sendToVDT(appExec->displayID, RCV_UPDATE_DISPLAY, msgStr);
-  fsm->sendToOtherVDT(appExec->displayID, RCV_CLEAR_DISPLAY, winID);
+  streamGrp.createRcvMsg(winID, configID, msgStr);
+  sageVirtualDesktop *curVDT = fsm->vdtList[appExec->displayID];
+  for (int i=0; i<receiverList.size(); i++)
+    curVDT->sendToNode(receiverList[i], RCV_UPDATE_DISPLAY, msgStr);
+
+  if (lastDisplayID >= 0) {
+    char clearStr[TOKEN_LEN];
+    sprintf(clearStr, "%d %d", winID, configID);
+
+    for (int i=0; i<lastRcvList.size(); i++) {
+      if (lastDisplayID != appExec->displayID)
+        fsm->vdtList[lastDisplayID]->sendToNode(lastRcvList[i], RCV_CLEAR_DISPLAY, clearStr);
+      else if (std::find(receiverList.begin(), receiverList.end(), lastRcvList[i]) == receiverList.end())
+        curVDT->sendToNode(lastRcvList[i], RCV_UPDATE_DISPLAY, msgStr);
+    }
+  }
+
+  lastDisplayID = appExec->displayID;
+  lastRcvList = receiverList;
 
   //SAGE_PRINTLOG("displayInstance : send stream info to SAIL");
   sageMessage msg;
@@ -361,6 +384,21 @@ int displayInstance::parseMsg(sageMessage &msg)
     }
     break;
   }
+
+  case DISP_APP_FIRST_FRAME : {
+    // only the node that showed the app first tells the launch latency
+    if (frameShown)
+      break;
+    frameShown = true;
+
+    int instID, nodeID;
+    float setupTime, firstTime;
+    sscanf((char *)msg.getData(), "%d %d %f %f", &instID, &nodeID, &setupTime, &firstTime);
+    SAGE_PRINTLOG("displayInstance : %s(%d) first frame on display node %d %.1f ms after registering "
+                  "(receiver setup %.2f ms, first frame %.1f ms after setup started)", appExec->appName, winID,
+                  nodeID, (sage::getTime() - appExec->regTime)/1000.0, setupTime, firstTime);
+    break;
+  }
   }
 
   return 0;
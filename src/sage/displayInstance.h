@@ -65,6 +65,10 @@ private:
   std::vector<int> receiverList;
   streamGroup streamGrp;
 
+  int configID;                  // counts SAIL_INIT_STREAM like the sender does
+  int lastDisplayID;             // receivers of the previous configuration
+  std::vector<int> lastRcvList;
+
   int tileNum;
   int dispNodeNum;
   int streamNum;
@@ -73,6 +77,7 @@ private:
   int rcvFlagCnt;
   int syncMode;
   int waitNodes;
+  bool frameShown;
   int imageSize;
   float rcvFrate, rcvBwidth, rcvLoss, accBwidth, accLoss;
   float sendFrate;
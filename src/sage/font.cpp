@@ -1,55 +1,127 @@
 #include "drawObjects.h"
 #include "font.h"
 #include "misc.h"
+#include "sageDrawBatch.h"
+#include <math.h>
 
 
 int Font::initCounter = 0;
 
 
 
-void Font::loadChar(char c)
+// renders all the glyphs and packs them in rows into one texture
+void Font::loadAtlas()
 {
-  GLfloat texcoord[4];
+  SDL_Surface *pics[maxGlyph + 1];
   char letter[2] = {0, 0};
+  int i, area = 0, widest = 0;
 
-  if ((minGlyph <= c) &&
-      (c <= maxGlyph) &&
-      (NULL == glyphs[((int)c)].pic))
-  {
-    SDL_Surface *g0 = NULL;
-    SDL_Surface *g1 = NULL;
+  // only tried once, drawText() shows nothing if it fails
+  atlasLoaded = true;
 
-    letter[0] = c;
-    TTF_GlyphMetrics(ttfFont,
-                     (Uint16)c,
-                     &glyphs[((int)c)].minx,
-                     &glyphs[((int)c)].maxx,
-                     &glyphs[((int)c)].miny,
-                     &glyphs[((int)c)].maxy,
-                     &glyphs[((int)c)].advance);
-
-    g0 = TTF_RenderText_Blended(ttfFont, letter, foreground);
-
-    if (NULL != g0) {
-      g1 = SDL_DisplayFormatAlpha(g0);
-      SDL_FreeSurface(g0);
+  for (i = minGlyph; i <= maxGlyph; i++) {
+    letter[0] = i;
+    pics[i] = TTF_RenderText_Blended(ttfFont, letter, foreground);
+    if (NULL != pics[i]) {
+      area += (pics[i]->w + 1) * (pics[i]->h + 1);
+      widest = MAX(widest, pics[i]->w);
     }
+  }
 
-    if (NULL != g1) {
-      glyphs[((int)c)].pic = g1;
-      glyphs[((int)c)].tex = SDL_GL_LoadTexture(g1, texcoord);
-      glyphs[((int)c)].texMinX = texcoord[0];
-      glyphs[((int)c)].texMinY = texcoord[1];
-      glyphs[((int)c)].texMaxX = texcoord[2];
-      glyphs[((int)c)].texMaxY = texcoord[3];
+  // one pixel between the glyphs so that they don't bleed into each other
+  int w = power_of_two(MAX(widest, (int)sqrt((double)area)));
+  int x = 0, y = 0, rowHeight = 0;
+  for (i = minGlyph; i <= maxGlyph; i++) {
+    if (NULL == pics[i])
+      continue;
+    if (x + pics[i]->w > w) {
+      x = 0;
+      y += rowHeight + 1;
+      rowHeight = 0;
     }
+    glyphs[i].texMinX = x;
+    glyphs[i].texMinY = y;
+    x += pics[i]->w + 1;
+    rowHeight = MAX(rowHeight, pics[i]->h);
   }
+  int h = power_of_two(y + rowHeight);
+
+  SDL_Surface *image = SDL_CreateRGBSurface(
+                               SDL_SWSURFACE,
+                               w, h,
+                               32,
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN /* OpenGL RGBA masks */
+                               0x000000FF,
+                               0x0000FF00,
+                               0x00FF0000,
+                               0xFF000000
+#else
+                               0xFF000000,
+                               0x00FF0000,
+                               0x0000FF00,
+                               0x000000FF
+#endif
+                               );
+
+  if (NULL != image)
+    SDL_FillRect(image, NULL, 0);
+
+  for (i = minGlyph; i <= maxGlyph; i++) {
+    if (NULL == pics[i]) {
+      glyphs[i].w = glyphs[i].h = 0;
+      continue;
+    }
+
+    SDL_Rect src, dst;
+    src.x = 0;
+    src.y = 0;
+    src.w = pics[i]->w;
+    src.h = pics[i]->h;
+    dst.x = (Sint16)glyphs[i].texMinX;
+    dst.y = (Sint16)glyphs[i].texMinY;
+
+    /* copy the alpha channel instead of blending with it */
+    if (NULL != image) {
+      SDL_SetAlpha(pics[i], 0, 0);
+      SDL_BlitSurface(pics[i], &src, image, &dst);
+    }
+
+    glyphs[i].w = pics[i]->w;
+    glyphs[i].h = pics[i]->h;
+    glyphs[i].texMinX = (GLfloat)dst.x / w;
+    glyphs[i].texMinY = (GLfloat)dst.y / h;
+    glyphs[i].texMaxX = (GLfloat)(dst.x + pics[i]->w) / w;
+    glyphs[i].texMaxY = (GLfloat)(dst.y + pics[i]->h) / h;
+
+    SDL_FreeSurface(pics[i]);
+  }
+
+  if (NULL == image) {
+    SAGE_PRINTLOG("Font::loadAtlas : can't create a %dx%d glyph atlas\n", w, h);
+    return;
+  }
+
+  glGenTextures(1, &atlasTex);
+  glBindTexture(GL_TEXTURE_2D, atlasTex);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexImage2D(GL_TEXTURE_2D,
+               0,
+               GL_RGBA,
+               w, h,
+               0,
+               GL_RGBA,
+               GL_UNSIGNED_BYTE,
+               image->pixels);
+  SDL_FreeSurface(image);
 }
 
 
 
 Font::Font(int pointSize):
 
+  atlasTex(0),
+  atlasLoaded(false),
   pointSize(pointSize),
   //fgRed(fgRed), fgGreen(fgGreen), fgBlue(fgBlue),
   ttfFont(NULL)
@@ -74,6 +146,9 @@ Font::Font(int pointSize):
 
 Font::~Font()
 {
+  if (atlasTex)
+    glDeleteTextures(1, &atlasTex);
+
   initCounter--;
   if (0 == initCounter)
     TTF_Quit();
@@ -99,9 +174,17 @@ void Font::initFont()
   descent = TTF_FontDescent(ttfFont);
   lineSkip = TTF_FontLineSkip(ttfFont);
 
+  // the metrics are known without a GL context, the glyphs are
+  // rendered into the atlas the first time text is drawn
   for (i = minGlyph; i <= maxGlyph; i++) {
-    glyphs[i].pic = NULL;
-    glyphs[i].tex = 0;
+    TTF_GlyphMetrics(ttfFont,
+                     (Uint16)i,
+                     &glyphs[i].minx,
+                     &glyphs[i].maxx,
+                     &glyphs[i].miny,
+                     &glyphs[i].maxy,
+                     &glyphs[i].advance);
+    glyphs[i].w = glyphs[i].h = 0;
   }
 }
 
@@ -145,8 +228,6 @@ void Font::textSize(const char *text, SDL_Rect *r)
         if (r->w > w_largest) w_largest = r->w;
         r->w = 0;
       } else {
-        loadChar(*text);
-
         maxx = glyphs[((int)*text)].maxx;
         advance = glyphs[((int)*text)].advance;
         r->w += advance;
@@ -172,19 +253,19 @@ void Font::drawText(const char *text, int x, int y, float z, WIDGET_color c, int
 {
   GLfloat left, right;
   GLfloat top, bottom;
-  GLfloat texMinX, texMinY;
-  GLfloat texMaxX, texMaxY;
-  GLfloat minx;
   GLfloat baseleft = x;
 
-  /*foreground.r = 255;
-    foreground.g = 255;
-    foreground.b = 255; */
+  if (!atlasLoaded)
+    loadAtlas();
 
-  glEnable(GL_TEXTURE_2D);
+  // the whole string is one run of quads in the overlay batch
+  sageDrawBatch &batch = sageDrawBatch::overlay();
+  batch.bindTexture(atlasTex);
 
   // set the color of the font
-  glColor4ub(c.r, c.g, c.b, alpha);
+  batch.colorub(c.r, c.g, c.b, alpha);
+
+  batch.begin(GL_QUADS);
 
   while (0 != *text)
   {
@@ -193,38 +274,27 @@ void Font::drawText(const char *text, int x, int y, float z, WIDGET_color c, int
       y += lineSkip;
     }
     else if ((minGlyph <= *text) && (*text <= maxGlyph)) {
-      loadChar(*text);
-
-      texMinX = glyphs[((int)*text)].texMinX;
-      texMinY = glyphs[((int)*text)].texMinY;
-      texMaxX = glyphs[((int)*text)].texMaxX;
-      texMaxY = glyphs[((int)*text)].texMaxY;
-
-      minx = glyphs[((int)*text)].minx;
-
-      left   = x + minx;
-      right  = x + glyphs[((int)*text)].pic->w + minx;
-      //top    = y;
-      //bottom = y + glyphs[((int)*text)].pic->h;
-      bottom = y;
-      top    = y + glyphs[((int)*text)].pic->h;
-
-      glBindTexture(GL_TEXTURE_2D, glyphs[((int)*text)].tex);
-
-      glBegin(GL_TRIANGLE_STRIP);
-
-      glTexCoord2f(texMinX, texMinY); glVertex3f( left,    top, z);
-      glTexCoord2f(texMaxX, texMinY); glVertex3f(right,    top, z);
-      glTexCoord2f(texMinX, texMaxY); glVertex3f( left, bottom, z);
-      glTexCoord2f(texMaxX, texMaxY); glVertex3f(right, bottom, z);
-
-      glEnd();
+      glyph &g = glyphs[((int)*text)];
+
+      if (g.w > 0) {
+        left   = x + g.minx;
+        right  = x + g.w + g.minx;
+        bottom = y;
+        top    = y + g.h;
+
+        batch.texCoord(g.texMinX, g.texMinY); batch.vertex( left,    top, z);
+        batch.texCoord(g.texMaxX, g.texMinY); batch.vertex(right,    top, z);
+        batch.texCoord(g.texMaxX, g.texMaxY); batch.vertex(right, bottom, z);
+        batch.texCoord(g.texMinX, g.texMaxY); batch.vertex( left, bottom, z);
+      }
 
-      x += glyphs[((int)*text)].advance;
+      x += g.advance;
     }
 
     text++;
   }
+
+  batch.end();
 }
 
 
@@ -238,77 +308,3 @@ int Font::power_of_two(int input)
   }
   return value;
 }
-
-
-GLuint Font::SDL_GL_LoadTexture(SDL_Surface *surface, GLfloat *texcoord)
-{
-  GLuint texture;
-  int w, h;
-  SDL_Surface *image;
-  SDL_Rect area;
-  Uint32 saved_flags;
-  Uint8  saved_alpha;
-
-  /* Use the surface width and height expanded to powers of 2 */
-  w = power_of_two(surface->w);
-  h = power_of_two(surface->h);
-  texcoord[0] = 0.0f;                        /* Min X */
-  texcoord[1] = 0.0f;                        /* Min Y */
-  texcoord[2] = (GLfloat)surface->w / w;        /* Max X */
-  texcoord[3] = (GLfloat)surface->h / h;        /* Max Y */
-
-  image = SDL_CreateRGBSurface(
-                               SDL_SWSURFACE,
-                               w, h,
-                               32,
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN /* OpenGL RGBA masks */
-                               0x000000FF,
-                               0x0000FF00,
-                               0x00FF0000,
-                               0xFF000000
-#else
-                               0xFF000000,
-                               0x00FF0000,
-                               0x0000FF00,
-                               0x000000FF
-#endif
-                               );
-
-  if ( image == NULL ) {
-    return 0;
-  }
-
-  /* Save the alpha blending attributes */
-  saved_flags = surface->flags&(SDL_SRCALPHA|SDL_RLEACCELOK);
-  saved_alpha = surface->format->alpha;
-  if ( (saved_flags & SDL_SRCALPHA) == SDL_SRCALPHA )
-    SDL_SetAlpha(surface, 0, 0);
-
-  /* Copy the surface into the GL texture image */
-  area.x = 0;
-  area.y = 0;
-  area.w = surface->w;
-  area.h = surface->h;
-  SDL_BlitSurface(surface, &area, image, &area);
-
-  /* Restore the alpha blending attributes */
-  if ( (saved_flags & SDL_SRCALPHA) == SDL_SRCALPHA )
-    SDL_SetAlpha(surface, saved_flags, saved_alpha);
-
-  /* Create an OpenGL texture for the image */
-  glGenTextures(1, &texture);
-  glBindTexture(GL_TEXTURE_2D, texture);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-  glTexImage2D(GL_TEXTURE_2D,
-               0,
-               GL_RGBA,
-               w, h,
-               0,
-               GL_RGBA,
-               GL_UNSIGNED_BYTE,
-               image->pixels);
-  SDL_FreeSurface(image); /* No longer needed */
-
-  return texture;
-}
@@ -55,8 +55,7 @@ private:
     int minx, maxx;
     int miny, maxy;
     int advance;
-    SDL_Surface *pic;
-    GLuint tex;
+    int w, h;   // size of the rendered glyph
     GLfloat texMinX, texMinY;
     GLfloat texMaxX, texMaxY;
   } glyph;
@@ -67,6 +66,11 @@ private:
   int lineSkip;
   glyph glyphs[maxGlyph + 1];
 
+  // all the glyphs of this size packed into one texture, so that a string
+  // is drawn from a single texture
+  GLuint atlasTex;
+  bool atlasLoaded;
+
   const char *fontName;
   int pointSize;
   float fgRed, fgGreen, fgBlue;
@@ -75,9 +79,8 @@ private:
 
   SDL_Color foreground;
 
-  void loadChar(char c);
+  void loadAtlas();
   int power_of_two(int input);
-  GLuint SDL_GL_LoadTexture(SDL_Surface *surface, GLfloat *texcoord);
 
 public:
 
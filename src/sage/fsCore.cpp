@@ -122,6 +122,7 @@ void fsCore::clearAppInstance(int id)
 
   // clear app instance on display nodes
   fsm->sendToAllRcvs(RCV_SHUTDOWN_APP, id);
+  windowUpdates.erase(id);
 
   // clear app instance on audio nodes
   if (app->audioOn) {
@@ -220,6 +221,7 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
   switch(msg.getCode()) {
   case REG_APP : {
     app = new appInExec;
+    app->regTime = sage::getTime();
     memset(app->launcherID, 0, SAGE_NAME_LEN);
     sscanf((char *)msg.getData(), "%s %d %d %d %d %d %s %d %d %d %d %d %d %s", app->appName, &app->x, &app->y,
            &app->width, &app->height, &app->bandWidth, app->renderNodeIP, &app->imageWidth,
@@ -343,10 +345,11 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
 
     char msgStr[TOKEN_LEN];
     memset(msgStr, 0, TOKEN_LEN);
-    sprintf(msgStr, "%d %d %d %d %d %d %d %s", fsm->nwInfo->rcvBufSize,
+    sprintf(msgStr, "%d %d %d %d %d %d %d %d %d %d %d %s", fsm->nwInfo->rcvBufSize,
             fsm->nwInfo->sendBufSize, fsm->nwInfo->mtuSize,
             streamPort, fsm->rInfo.bufSize, fsm->rInfo.fullScreen,
-            fsm->vdtList[dispID]->getNodeNum(), info);
+            fsm->vdtList[dispID]->getNodeNum(), fsm->rInfo.poolSize,
+            fsm->rInfo.prewarmNum, (int)fsm->rInfo.prewarmFmt, fsm->rInfo.avDelay, info);
 
     if (fsm->sendMessage(clientID, RCV_INIT, msgStr) < 0) {
       SAGE_PRINTLOG("fsCore : displaynode(%d) doesn't respond", nodeID);
@@ -374,9 +377,10 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
     // get the tile config info of display node
     fsm->vdtList[0]->getAudioRcvInfo(nodeID, info);
     char msgStr[TOKEN_LEN];
-    sprintf(msgStr, "%d %d %d %d %d %d %d %d %s", fsm->nwInfo->rcvBufSize,
+    sprintf(msgStr, "%d %d %d %d %d %d %d %d %d %s", fsm->nwInfo->rcvBufSize,
             fsm->nwInfo->sendBufSize, fsm->nwInfo->mtuSize,   fsm->rInfo.audioSyncPort,
-            fsm->rInfo.audioPort, fsm->rInfo.agSyncPort, fsm->rInfo.bufSize, fsm->vdtList[0]->getNodeNum(), info);
+            fsm->rInfo.audioPort, fsm->rInfo.agSyncPort, fsm->rInfo.bufSize, fsm->vdtList[0]->getNodeNum(),
+            fsm->rInfo.avDelay, info);
 
     //cout << " ----> fsCore : " << msgStr << endl;
     fsm->sendMessage(clientID, ARCV_AUDIO_INIT, msgStr);
@@ -454,12 +458,9 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
 
   case MOVE_WINDOW : {
 
-    sageRect devRect;
     int winID, index;
     float x, y;
     sscanf((char *)msg.getData(), "%d %f %f", &winID, &x, &y);
-    devRect.x = int(x);
-    devRect.y = int(y);
 
     app = findApp(winID, index);
 
@@ -468,16 +469,13 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
       break;
     }
 
-    //fsm->dispList[winID]->modifyStream();
+    // moves are relative to the position requested last
+    windowUpdate &update = windowUpdates[winID];
+    sageRect target = update.pending ? update.target : *(sageRect *)app;
+    target.x += int(x);
+    target.y += int(y);
 
-    startTime = sage::getTime();
-    if (fsm->winStep > 0)
-      winSteps = fsm->winStep;
-
-    if (fsm->dispList[index]->changeWindow(devRect, winSteps) < 0)
-      clearAppInstance(winID);
-    else
-      windowChanged(winID, clientID == fsm->dim);
+    queueWindowChange(winID, target, clientID == fsm->dim);
 
     break;
   }
@@ -657,6 +655,29 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
     break;
   }
 
+  case RECORD_WALL : {
+    if (!msg.getData())
+      break;
+    fsm->sendToAllRcvs(RECORD_WALL, (char *)msg.getData());
+    break;
+  }
+
+  case RECORD_STREAM : {
+    if (!msg.getData())
+      break;
+
+    int winID, index;
+    sscanf((char *)msg.getData(), "%d", &winID);
+
+    if (!findApp(winID, index)) {
+      SAGE_PRINTLOG("fsCore/RECORD_STREAM : app %d doesn't exist", winID);
+      break;
+    }
+
+    fsm->sendToAllRcvs(RECORD_STREAM, (char *)msg.getData());
+    break;
+  }
+
   case FS_TIME_MSG : {
     double endTime = sage::getTime();
     double bigTime = floor(endTime/1000000.0)*1000000.0;
@@ -693,21 +714,13 @@ int fsCore::parseMessage(sageMessage &msg, int clientID)
       break;
     }
 
-    sageRect devRect;
-    devRect.x = left - app->x;
-    devRect.width = right - (app->width+app->x) - devRect.x;
-    devRect.y = bottom - app->y;
-    devRect.height = top - (app->y+app->height) - devRect.y;
-
-    startTime = sage::getTime();
+    sageRect target = *(sageRect *)app;
+    target.x = left;
+    target.width = right - left;
+    target.y = bottom;
+    target.height = top - bottom;
 
-    if (fsm->winStep > 0)
-      winSteps = fsm->winStep;
-
-    if (fsm->dispList[index]->changeWindow(devRect, winSteps) < 0)
-      clearAppInstance(winID);
-    else
-      windowChanged(winID, clientID==fsm->dim);
+    queueWindowChange(winID, target, clientID==fsm->dim);
 
     break;
   }
@@ -1042,6 +1055,10 @@ int fsCore::rotateWindow(char *msgStr)
     return -1;
   }
 
+  // rotate the window where it was dragged to
+  if (applyWindowChange(winID) < 0)
+    return -1;
+
 
   switch(rotation) {
   case 90:
@@ -1075,6 +1092,79 @@ int fsCore::rotateWindow(char *msgStr)
   return 0;
 }
 
+int fsCore::queueWindowChange(int winID, sageRect &target, bool dimOriginated)
+{
+  windowUpdate &update = windowUpdates[winID];
+  update.target = target;
+  update.dimOriginated = dimOriginated;
+  update.pending = true;
+
+  // the first change of a drag goes out right away
+  double interval = 1000000.0 / MAX(fsm->rInfo.refreshInterval, 1);
+  if (sage::getTime() - update.lastApplied >= interval)
+    return applyWindowChange(winID);
+
+  return 0;
+}
+
+int fsCore::applyWindowChange(int winID)
+{
+  std::map<int, windowUpdate>::iterator iter = windowUpdates.find(winID);
+  if (iter == windowUpdates.end() || !iter->second.pending)
+    return 0;
+
+  windowUpdate &update = iter->second;
+  update.pending = false;
+  update.lastApplied = sage::getTime();
+
+  int index;
+  appInExec *app = findApp(winID, index);
+  if (!app) {
+    windowUpdates.erase(iter);
+    return -1;
+  }
+
+  sageRect devRect;
+  devRect.x = update.target.x - app->x;
+  devRect.y = update.target.y - app->y;
+  devRect.width = update.target.width - app->width;
+  devRect.height = update.target.height - app->height;
+
+  startTime = sage::getTime();
+
+  if (fsm->winStep > 0)
+    winSteps = fsm->winStep;
+
+  if (fsm->dispList[index]->changeWindow(devRect, winSteps) < 0) {
+    clearAppInstance(winID);
+    return -1;
+  }
+
+  windowChanged(winID, update.dimOriginated);
+
+  return 0;
+}
+
+void fsCore::flushWindowChanges()
+{
+  if (windowUpdates.empty())
+    return;
+
+  double now = sage::getTime();
+  double interval = 1000000.0 / MAX(fsm->rInfo.refreshInterval, 1);
+
+  std::vector<int> dueList;
+  std::map<int, windowUpdate>::iterator iter;
+  for (iter = windowUpdates.begin(); iter != windowUpdates.end(); iter++) {
+    if (iter->second.pending && now - iter->second.lastApplied >= interval)
+      dueList.push_back(iter->first);
+  }
+
+  // applying may shut an app down and change the map
+  for (int i=0; i<dueList.size(); i++)
+    applyWindowChange(dueList[i]);
+}
+
 int fsCore::windowChanged(int winID, bool dimOriginatedChange)
 {
   // update the window borders on the display side
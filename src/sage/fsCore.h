@@ -43,10 +43,24 @@
 #define _FS_CORE_H
 
 #include "sage.h"
+#include <map>
 
 class fsManager;
 class appInExec;
 
+/**
+ * newest geometry requested for a window by move and resize messages
+ */
+class windowUpdate {
+public:
+  sageRect target;
+  bool pending;
+  bool dimOriginated;
+  double lastApplied; // in microseconds
+
+  windowUpdate() : pending(false), dimOriginated(false), lastApplied(0.0) {}
+};
+
 /**
  * class fsCore
  * The core part of the Free Space Manager processing user commands to run applications or send appropriate orders to each part of SAGE
@@ -58,6 +72,17 @@ private:
   int winSteps;
   int numReportedReceivers;
 
+  // a drag sends far more moves than the walls can show, they are merged
+  // and applied at most once per display refresh
+  std::map<int, windowUpdate> windowUpdates;
+
+  /**
+   * records the new geometry of a window and applies it if the last change
+   * is at least a refresh interval ago
+   */
+  int queueWindowChange(int winID, sageRect &target, bool dimOriginated);
+  int applyWindowChange(int winID);
+
 public:
   fsCore();
   ~fsCore();
@@ -71,6 +96,12 @@ public:
   int initDisp(appInExec* app);
   int initAudio();
   int windowChanged(int winID, bool dimOriginatedChange=false);
+
+  /**
+   * applies the window changes that were held back and are due now,
+   * called from the main loop of fsManager
+   */
+  void flushWindowChanges();
   int bringToFront(int winID);
   int pushToBack(int winID);
   int rotateWindow(char *msgStr);
@@ -39,6 +39,7 @@
  *****************************************************************************/
 
 #include "fsManager.h"
+#include "sageTelemetry.h"
 
 int main(int argc, char *argv[])
 {
@@ -57,5 +58,7 @@ int main(int argc, char *argv[])
       exit(-1);
   }
 
+  sageTelemetry::instance().startExport("fsManager", "proc=\"fsManager\"");
+
   fsm.mainLoop();
 }
@@ -46,6 +46,11 @@
 #include "sageVirtualDesktop.h"
 #include "displayInstance.h"
 #include "streamProtocol.h"
+#include "sageTelemetry.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telMessages = telemetry.counter("sage_fsm_messages_total", "messages handled by fsManager");
+static int telHandle = telemetry.histogram("sage_fsm_message_us", "time to handle a message, in microsecs");
 
 fsManager::fsManager() : NRM(false), fsmClose(false), globalSync(true), useLocalPort(false)
 {
@@ -171,6 +176,26 @@ int fsManager::init(char *conf_file)
       getToken(fileFsConf, token);
       rInfo.fullScreen = atoi(token);
     }
+    else if (strcmp(token, "receiverPoolSize") == 0) {
+      getToken(fileFsConf, token);
+      rInfo.poolSize = atoi(token);
+    }
+    else if (strcmp(token, "receiverPrewarm") == 0) {
+      getToken(fileFsConf, token);
+      rInfo.prewarmNum = atoi(token);
+      getToken(fileFsConf, token);
+      sage::toupper(token);
+      if (strcmp(token, "RGBA") == 0)
+        rInfo.prewarmFmt = PIXFMT_8888;
+      else if (strcmp(token, "DXT") == 0)
+        rInfo.prewarmFmt = PIXFMT_DXT;
+      else if (strcmp(token, "DXT5") == 0)
+        rInfo.prewarmFmt = PIXFMT_DXT5;
+      else if (strcmp(token, "YUV") == 0)
+        rInfo.prewarmFmt = PIXFMT_YUV;
+      else
+        rInfo.prewarmFmt = PIXFMT_888;
+    }
     else if (strcmp(token, "rcvNwBufSize") == 0) {
       getToken(fileFsConf, token);
       nwInfo->rcvBufSize = getnumber(token); // atoi(token);
@@ -211,6 +236,10 @@ int fsManager::init(char *conf_file)
       getToken(fileFsConf, token);
       rInfo.audioPort = atoi(token);
     }
+    else if (strcmp(token, "avSyncDelay") == 0) {
+      getToken(fileFsConf, token);
+      rInfo.avDelay = atoi(token);
+    }
     else if (strcmp(token, "syncPort") == 0) {
       getToken(fileFsConf, token);
       rInfo.agSyncPort = atoi(token);
@@ -374,6 +403,7 @@ void fsManager::mainLoop()
 {
   while (!fsmClose) {
     server->checkClients();
+    core->flushWindowChanges();
     //      std::cout << "check clients " << std::endl;
     sage::usleep(100);
   }
@@ -381,11 +411,17 @@ void fsManager::mainLoop()
 
 int fsManager::msgToCore(sageMessage &msg, int clientID)
 {
+  telemetryTimer timer(telHandle);
+  telemetry.add(telMessages);
+
   return core->parseMessage(msg, clientID);
 }
 
 int fsManager::msgToDisp(sageMessage &msg, int clientID)
 {
+  telemetryTimer timer(telHandle);
+  telemetry.add(telMessages);
+
   int dispNum = dispList.size();
 
   // find associated display manager and forward this message
@@ -79,12 +79,17 @@ public:
   int bufSize;
   int fullScreen;
 
+  int poolSize;     /**< idle montages (per tile and format) and block buffers a SDM keeps */
+  int prewarmNum;   /**< montages per tile created when a SDM starts */
+  sagePixFmt prewarmFmt;
+
   bool audioOn;
   int audioPort;
   int audioSyncPort;
   int agSyncPort;
+  int avDelay;      /**< msecs from capture to presentation of timestamped frames and audio, 0 if not scheduled */
   rcvInfo() : syncPort(11000), syncBarrierPort(11001), refreshInterval(120), syncMasterPollingInterval(100), syncLevel(1), streamPort(21000), bufSize(64), fullScreen(true),
-              audioOn(false), audioSyncPort(13000), audioPort(23000), agSyncPort(15000) {}
+              poolSize(4), prewarmNum(0), prewarmFmt(PIXFMT_888), audioOn(false), audioSyncPort(13000), audioPort(23000), agSyncPort(15000), avDelay(0) {}
 };
 
 class sageNwConfig;
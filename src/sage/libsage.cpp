@@ -88,7 +88,7 @@ int getWallSize(int &width, int &height)
 
 
 
-sail* createSAIL(const char *appname, int ww, int hh, enum sagePixFmt pixelfmt, const char *fsIP, int roworder, int frate, sageWidgetFunc wFunc)
+sail* createSAIL(const char *appname, int ww, int hh, enum sagePixFmt pixelfmt, const char *fsIP, int roworder, int frate, sageWidgetFunc wFunc, sageStreamer *streamer)
 {
   sailConfig scfg;
   sail *sageInf;
@@ -168,7 +168,7 @@ sail* createSAIL(const char *appname, int ww, int hh, enum sagePixFmt pixelfmt,
     (*wFunc)(sageInf);
   }
 
-  sageInf->init(scfg);
+  sageInf->init(scfg, streamer);
 
   return sageInf;
 }
@@ -214,6 +214,29 @@ void swapWithBuffer(sail *sageInf, unsigned char *pixptr)
   }
 }
 
+void streamWithBuffer(sail *sageInf, unsigned char *pixptr)
+{
+  // Stream pixptr in place from the main sail object
+  sageInf->streamBuffer(pixptr);
+
+  // The copies share pixptr as well
+  list<sail*>::const_iterator cii;
+  for(cii=Clients.begin(); cii!=Clients.end(); cii++)
+  {
+    sail* cl = *cii;
+    cl->streamBuffer(pixptr);
+  }
+}
+
+void convertWithBuffer(sail *sageInf, unsigned char *pixptr, sageConvFmt fmt, int roworder)
+{
+  // Convert once into the main sail object, the copies get the result
+  if (sageInf->convertBuffer(pixptr, fmt, roworder) < 0)
+    return;
+
+  swapBuffer(sageInf);
+}
+
 void swapBuffer(sail *sageInf)
 {
   // Swap the derived clients
@@ -59,8 +59,8 @@ typedef struct _application_update {
   int app_x, app_y, app_w, app_h;
 } application_update_t;
 
-// Create and initialize a SAIL object
-sail*          createSAIL(const char *appname, int ww, int hh, enum sagePixFmt pixelfmt, const char *fsIP, int roworder = BOTTOM_TO_TOP, int frate = 60, sageWidgetFunc wFunc = NULL);
+// Create and initialize a SAIL object, streaming with the given streamer if there is one
+sail*          createSAIL(const char *appname, int ww, int hh, enum sagePixFmt pixelfmt, const char *fsIP, int roworder = BOTTOM_TO_TOP, int frate = 60, sageWidgetFunc wFunc = NULL, sageStreamer *streamer = NULL);
 
 // Disconnect and delete a SAIL object
 void           deleteSAIL(sail *sageInf);
@@ -77,6 +77,14 @@ unsigned char* swapAndNextBuffer(sail *sageInf);
 // Fill the next buffer and swap
 void           swapWithBuffer(sail *sageInf, unsigned char *pixptr);
 
+// Stream pixptr without copying it (zeroCopy with TCP avoids the copy into
+// pixel blocks too). pixptr is in use until the next swap or stream returns
+void           streamWithBuffer(sail *sageInf, unsigned char *pixptr);
+
+// Convert pixptr, in format fmt, into the next buffer and swap. Rows are
+// flipped if roworder differs from the one given to createSAIL
+void           convertWithBuffer(sail *sageInf, unsigned char *pixptr, sageConvFmt fmt, int roworder = -1);
+
 // Process SAGE message from fsManager and DIM
 void           processMessages(sail *sageInf, application_update_t *up, sageQuitFunc qfunc, sageSyncFunc sfunc);
 
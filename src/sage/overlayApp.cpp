@@ -74,6 +74,7 @@
 overlayApp::overlayApp()
 {
   strcpy(objectType, APP);
+  batched = true;
   state = NORMAL_STATE;
   aspectRatio = 1;
   cornerSize = 250;
@@ -100,9 +101,9 @@ overlayApp::overlayApp()
 
 void overlayApp::draw()
 {
-  glDisable(GL_TEXTURE_2D);
+  batch.disableTexture();
 
-  glPushMatrix();
+  batch.pushMatrix();
 
   //SAGE_PRINTLOG( "\nDRAWING AT: %f %f %f %f", left, right, top, bottom);
 
@@ -113,37 +114,34 @@ void overlayApp::draw()
       drawSelection();
     }
     else {
-      glLineWidth( lineW(4*displayScale));
+      batch.lineWidth( lineW(4*displayScale));
       if (mouseOver) drawOutline();
     }
 
-    glEnable(GL_LINE_STIPPLE);
-    glLineStipple(8, 21845);
+    batch.lineStipple(8, 21845);
 
     drawCorners();
 
-    glDisable(GL_LINE_STIPPLE);
+    batch.disableStipple();
   }
   else if (state == DRAG_STATE || state == RESIZE_STATE)
   {
-    glEnable(GL_LINE_STIPPLE);
-
-    glLineStipple(8, 21845);
-    glLineWidth( lineW(5*displayScale));
+    batch.lineStipple(8, 21845);
+    batch.lineWidth( lineW(5*displayScale));
     drawOutline();
     drawCorners();
 
-    glDisable(GL_LINE_STIPPLE);
+    batch.disableStipple();
   }
   else if (state == MINIMIZED_STATE)
   {
-    glLineWidth(1);
+    batch.lineWidth(1);
     drawOutline();
   }
 
 
   if (!tooltip.empty() && mouseOver && !dim && state!=MINIMIZED_STATE) {  // draw the tooltip
-    glTranslatef(x, y, 0);
+    batch.translate(x, y);
     drawFontBackground(0,(height)-ttSize, width, ttSize);
     ft = getFont(ttSize);
 
@@ -156,7 +154,7 @@ void overlayApp::draw()
   if (dim)
     drawCurtain();
 
-  glPopMatrix();
+  batch.popMatrix();
 }
 
 
@@ -166,14 +164,14 @@ void overlayApp::drawFontBackground(float x, float y, float w, float h)
   int a = 220;
   if (closing)
     a = (int)255*curtainAlpha;
-  glColor4ub(50,50,50,220);
-
-  glBegin(GL_QUADS);
-  glVertex3f(x, y, z);
-  glVertex3f(x, y+h, z);
-  glVertex3f(x+w, y+h, z);
-  glVertex3f(x+w, y, z);
-  glEnd();
+  batch.colorub(50,50,50,220);
+
+  batch.begin(GL_QUADS);
+  batch.vertex(x, y, z);
+  batch.vertex(x, y+h, z);
+  batch.vertex(x+w, y+h, z);
+  batch.vertex(x+w, y, z);
+  batch.end();
 }
 
 
@@ -184,47 +182,47 @@ void overlayApp::drawSelection()
   int w = right - left;
   int h = top - bottom;
 
-  glLineWidth( lineW(10*displayScale));
+  batch.lineWidth( lineW(10*displayScale));
 
   float c = 1.0;
   float c2 = 0.6;
   float lw = 4;
 
-  glBegin(GL_LINE_LOOP);
-  glColor4f(c, c, 0, selLineWidth/255.0);
-  glVertex3f(left-lw, bottom-lw, z);
+  batch.begin(GL_LINE_LOOP);
+  batch.color(c, c, 0, selLineWidth/255.0);
+  batch.vertex(left-lw, bottom-lw, z);
 
-  glColor4f(c2, 0, 0, selLineWidth/255.0);
-  glVertex3f(left-lw, top+lw - h/2.0, z);
+  batch.color(c2, 0, 0, selLineWidth/255.0);
+  batch.vertex(left-lw, top+lw - h/2.0, z);
 
-  glColor4f(c, c, 0, selLineWidth/255.0);
-  glVertex3f(left-lw, top+lw, z);
+  batch.color(c, c, 0, selLineWidth/255.0);
+  batch.vertex(left-lw, top+lw, z);
 
-  glColor4f(c2, 0, 0, selLineWidth/255.0);
-  glVertex3f(left-lw+w/2.0, top+lw, z);
+  batch.color(c2, 0, 0, selLineWidth/255.0);
+  batch.vertex(left-lw+w/2.0, top+lw, z);
 
-  glColor4f(c, c, 0, selLineWidth/255.0);
-  glVertex3f(right+lw, top+lw, z);
+  batch.color(c, c, 0, selLineWidth/255.0);
+  batch.vertex(right+lw, top+lw, z);
 
-  glColor4f(c2, 0, 0, selLineWidth/255.0);
-  glVertex3f(right+lw, top+lw-h/2.0, z);
+  batch.color(c2, 0, 0, selLineWidth/255.0);
+  batch.vertex(right+lw, top+lw-h/2.0, z);
 
-  glColor4f(c, c, 0, selLineWidth/255.0);
-  glVertex3f(right+lw, bottom-lw, z);
+  batch.color(c, c, 0, selLineWidth/255.0);
+  batch.vertex(right+lw, bottom-lw, z);
 
-  glColor4f(c2, 0, 0, selLineWidth/255.0);
-  glVertex3f(right+lw-w/2.0, bottom-lw, z);
-  glEnd();
+  batch.color(c2, 0, 0, selLineWidth/255.0);
+  batch.vertex(right+lw-w/2.0, bottom-lw, z);
+  batch.end();
 
 
-  glColor4f(0.2, 0.2, 0.2, 255.0);
-  glLineWidth( lineW(3*displayScale));
-  glBegin(GL_LINE_LOOP);
-  glVertex3f(left+1, bottom+1, z);
-  glVertex3f(left+1, top-1, z);
-  glVertex3f(right-1, top-1, z);
-  glVertex3f(right-1, bottom+1, z);
-  glEnd();
+  batch.color(0.2, 0.2, 0.2, 255.0);
+  batch.lineWidth( lineW(3*displayScale));
+  batch.begin(GL_LINE_LOOP);
+  batch.vertex(left+1, bottom+1, z);
+  batch.vertex(left+1, top-1, z);
+  batch.vertex(right-1, top-1, z);
+  batch.vertex(right-1, bottom+1, z);
+  batch.end();
   /*
     glEnable(GL_LINE_STIPPLE);
     glLineWidth(4);
@@ -289,49 +287,47 @@ void overlayApp::drawOutline()
   else
     a = alpha/255.0;
 
-  glBegin(GL_LINE_LOOP);
-  glColor4f(0.5, 0.5, 0.5, a);
-  glVertex3f(left, bottom, z);
-  glColor4f(color[0], color[1], color[2], a);
-  glVertex3f(left, top, z);
-  glColor4f(color[0], color[1], color[2], a);
-  glVertex3f(right, top, z);
-  glColor4f(0.5, 0.5, 0.5, a);
-  glVertex3f(right, bottom, z);
-  glEnd();
+  batch.begin(GL_LINE_LOOP);
+  batch.color(0.5, 0.5, 0.5, a);
+  batch.vertex(left, bottom, z);
+  batch.color(color[0], color[1], color[2], a);
+  batch.vertex(left, top, z);
+  batch.color(color[0], color[1], color[2], a);
+  batch.vertex(right, top, z);
+  batch.color(0.5, 0.5, 0.5, a);
+  batch.vertex(right, bottom, z);
+  batch.end();
 
-  int o;
-  glGetIntegerv(GL_LINE_WIDTH, &o);
+  int o = (int)batch.getLineWidth();
 
   // now draw the black one
-  glColor4f(0.0, 0.0, 0.0, a);
-  glBegin(GL_LINE_LOOP);
-  glColor4f(0.0, 0.0, 0.0, a);
-  glVertex3f(left-o, bottom-o, z);
-  glColor4f(0.5, 0.5, 0.5, a);
-  glVertex3f(left-o, top+o, z);
-  glColor4f(0.5, 0.5, 0.5, a);
-  glVertex3f(right+o, top+o, z);
-  glColor4f(0.0, 0.0, 0.0, a);
-  glVertex3f(right+o, bottom-o, z);
-  glEnd();
+  batch.color(0.0, 0.0, 0.0, a);
+  batch.begin(GL_LINE_LOOP);
+  batch.color(0.0, 0.0, 0.0, a);
+  batch.vertex(left-o, bottom-o, z);
+  batch.color(0.5, 0.5, 0.5, a);
+  batch.vertex(left-o, top+o, z);
+  batch.color(0.5, 0.5, 0.5, a);
+  batch.vertex(right+o, top+o, z);
+  batch.color(0.0, 0.0, 0.0, a);
+  batch.vertex(right+o, bottom-o, z);
+  batch.end();
 }
 
 
 void overlayApp::drawCurtain()
 {
-  int o;
-  glGetIntegerv(GL_LINE_WIDTH, &o);
-  glDisable(GL_TEXTURE_2D);
+  int o = (int)batch.getLineWidth();
+  batch.disableTexture();
 
   // now draw the black one
-  glColor4f(0.0, 0.0, 0.0, curtainAlpha);
-  glBegin(GL_QUADS);
-  glVertex3f(left-o, bottom-o, z-0.8);
-  glVertex3f(left-o, top+o, z-0.8);
-  glVertex3f(right+o, top+o, z-0.8);
-  glVertex3f(right+o, bottom-o, z-0.8);
-  glEnd();
+  batch.color(0.0, 0.0, 0.0, curtainAlpha);
+  batch.begin(GL_QUADS);
+  batch.vertex(left-o, bottom-o, z-0.8);
+  batch.vertex(left-o, top+o, z-0.8);
+  batch.vertex(right+o, top+o, z-0.8);
+  batch.vertex(right+o, bottom-o, z-0.8);
+  batch.end();
 }
 
 
@@ -339,62 +335,62 @@ void overlayApp::drawCorners()
 {
   int cs = cornerSize;
 
-  glLineWidth(2);
-  glPushMatrix();
+  batch.lineWidth(2);
+  batch.pushMatrix();
 
   if (activeCorners[TOP_LEFT] == 1) {
-    glTranslated(left, top, 0);
-    glRotatef(270, 0.0, 0.0, 1.0);
+    batch.translate(left, top);
+    batch.rotate(270);
     drawOneCorner();
   }
   if(activeCorners[TOP_RIGHT] == 1) {
-    glTranslated(right, top, 0);
-    glRotatef(180, 0.0, 0.0, 1.0);
+    batch.translate(right, top);
+    batch.rotate(180);
     drawXCorner();
   }
   if(activeCorners[BOTTOM_RIGHT] == 1) {
-    glTranslated(right, bottom, 0);
-    glRotatef(90, 0.0, 0.0, 1.0);
+    batch.translate(right, bottom);
+    batch.rotate(90);
     drawOneCorner();
   }
   if(activeCorners[BOTTOM_LEFT] == 1) {
-    glTranslated(left, bottom, 0);
+    batch.translate(left, bottom);
     drawOneCorner();
   }
   if(activeCorners[TOP_RIGHT_X] == 1) {
-    glTranslated(right-cs, top, 0);
-    glRotatef(180, 0.0, 0.0, 1.0);
+    batch.translate(right-cs, top);
+    batch.rotate(180);
     drawXCorner();
   }
 
-  glPopMatrix();
+  batch.popMatrix();
 }
 
 void overlayApp::drawXCorner()
 {
 	  int cs = cornerSize;
 
-	  glColor4f(color[0], color[1], color[2], 0.7);
-	  glBegin(GL_LINE_STRIP);
-	  glVertex3f(0, cs, z);
-	  glVertex3f(cs, cs, z);
-	  glVertex3f(cs, 0, z);
-	  glEnd();
-
-	  glColor4f(0.0, 0.0, 0.0, 0.7);
-	  glBegin(GL_LINE_STRIP);
-	  glVertex3f(0+2, cs-2, z);
-	  glVertex3f(cs-2, cs-2, z);
-	  glVertex3f(cs-2, 0+2, z);
-	  glEnd();
-
-	  glColor4f(1.0f, 0.0f, 0.0f, 0.7);
-	  glBegin(GL_QUADS);
-	  glVertex3f(0, cs, z+Z_STEP);
-	  glVertex3f(cs, cs, z+Z_STEP);
-	  glVertex3f(cs, 0, z+Z_STEP);
-	  glVertex3f(0, 0, z+Z_STEP);
-	  glEnd();
+	  batch.color(color[0], color[1], color[2], 0.7);
+	  batch.begin(GL_LINE_STRIP);
+	  batch.vertex(0, cs, z);
+	  batch.vertex(cs, cs, z);
+	  batch.vertex(cs, 0, z);
+	  batch.end();
+
+	  batch.color(0.0, 0.0, 0.0, 0.7);
+	  batch.begin(GL_LINE_STRIP);
+	  batch.vertex(0+2, cs-2, z);
+	  batch.vertex(cs-2, cs-2, z);
+	  batch.vertex(cs-2, 0+2, z);
+	  batch.end();
+
+	  batch.color(1.0f, 0.0f, 0.0f, 0.7);
+	  batch.begin(GL_QUADS);
+	  batch.vertex(0, cs, z+Z_STEP);
+	  batch.vertex(cs, cs, z+Z_STEP);
+	  batch.vertex(cs, 0, z+Z_STEP);
+	  batch.vertex(0, 0, z+Z_STEP);
+	  batch.end();
 }
 
 
@@ -402,28 +398,28 @@ void overlayApp::drawOneCorner()
 {
   int cs = cornerSize;
 
-  glColor4f(color[0], color[1], color[2], 0.7);
-  glBegin(GL_LINE_STRIP);
-  glVertex3f(0, cs, z);
-  glVertex3f(cs, cs, z);
-  glVertex3f(cs, 0, z);
-  glEnd();
-
-  glColor4f(0.0, 0.0, 0.0, 0.7);
-  glBegin(GL_LINE_STRIP);
-  glVertex3f(0+2, cs-2, z);
-  glVertex3f(cs-2, cs-2, z);
-  glVertex3f(cs-2, 0+2, z);
-  glEnd();
-
-  glColor4f(corner_color[0], corner_color[1],
+  batch.color(color[0], color[1], color[2], 0.7);
+  batch.begin(GL_LINE_STRIP);
+  batch.vertex(0, cs, z);
+  batch.vertex(cs, cs, z);
+  batch.vertex(cs, 0, z);
+  batch.end();
+
+  batch.color(0.0, 0.0, 0.0, 0.7);
+  batch.begin(GL_LINE_STRIP);
+  batch.vertex(0+2, cs-2, z);
+  batch.vertex(cs-2, cs-2, z);
+  batch.vertex(cs-2, 0+2, z);
+  batch.end();
+
+  batch.color(corner_color[0], corner_color[1],
             corner_color[2], corner_color[3]);
-  glBegin(GL_QUADS);
-  glVertex3f(0, cs, z+Z_STEP);
-  glVertex3f(cs, cs, z+Z_STEP);
-  glVertex3f(cs, 0, z+Z_STEP);
-  glVertex3f(0, 0, z+Z_STEP);
-  glEnd();
+  batch.begin(GL_QUADS);
+  batch.vertex(0, cs, z+Z_STEP);
+  batch.vertex(cs, cs, z+Z_STEP);
+  batch.vertex(cs, 0, z+Z_STEP);
+  batch.vertex(0, 0, z+Z_STEP);
+  batch.end();
 }
 
 
@@ -520,6 +516,7 @@ int overlayApp::parseMessage(char *msg)
     sscanf(msg, "%d %d %d %d", &id, &code, &ov, &appId);
     mouseOver = bool(ov);
     (drawParent->apps[appId]).mouseOver = mouseOver;
+    drawParent->damageApp(appId);   // the drop shadow is outside the app
     break;
   }
   case DIM: {
@@ -58,6 +58,7 @@ GLuint overlayButton::default_tex = 0;
 overlayButton::overlayButton()
 {
   strcpy(objectType, BUTTON);
+  batched = true;
   state = MOUSE_NOT_OVER;
   z = TOP_Z;
   isToggle = false;
@@ -91,10 +92,10 @@ void overlayButton::deleteTex(GLuint tex)
 void overlayButton::draw()
 {
   /**********    DRAW THE STUFF   ***********/
-  glPushMatrix();
-  glColor4ub(255, 255, 255, alpha);
+  batch.pushMatrix();
+  batch.colorub(255, 255, 255, alpha);
   drawTexture(current_tex);
-  glPopMatrix();
+  batch.popMatrix();
 
   // draw the font with the correct size
   if (!label.empty() && ft)
@@ -104,25 +105,24 @@ void overlayButton::draw()
 
 void overlayButton::drawTexture(GLuint tex)
 {
-  glEnable(GL_TEXTURE_2D);
-  glTranslatef(x, y, 0);
+  batch.translate(x, y);
 
-  glBindTexture (GL_TEXTURE_2D, tex);
-  glBegin(GL_QUADS);
+  batch.bindTexture(tex);
+  batch.begin(GL_QUADS);
 
-  glTexCoord2f(0.0, 0.0);
-  glVertex3f(0.0, 0.0, z);
+  batch.texCoord(0.0, 0.0);
+  batch.vertex(0.0, 0.0, z);
 
-  glTexCoord2f(0.0, 1.0);
-  glVertex3f(0.0, height, z);
+  batch.texCoord(0.0, 1.0);
+  batch.vertex(0.0, height, z);
 
-  glTexCoord2f(1.0, 1.0);
-  glVertex3f(width, height, z);
+  batch.texCoord(1.0, 1.0);
+  batch.vertex(width, height, z);
 
-  glTexCoord2f(1.0, 0.0);
-  glVertex3f(width, 0, z);
+  batch.texCoord(1.0, 0.0);
+  batch.vertex(width, 0, z);
 
-  glEnd();
+  batch.end();
 }
 
 
@@ -168,15 +168,15 @@ int overlayButton::parseMessage(char *msg)
 
 void overlayButton::parseGraphicsInfo(TiXmlElement *parent)
 {
-  up_tex = getTextureFromXml(parent, "up");
+  up_tex = getTexture(parent, "up");
   if (up_tex == 0)
     up_tex = default_tex;
 
-  down_tex = getTextureFromXml(parent, "down");
+  down_tex = getTexture(parent, "down");
   if (down_tex == 0)
     down_tex = up_tex;
 
-  over_tex = getTextureFromXml(parent, "over");
+  over_tex = getTexture(parent, "over");
   if (over_tex == 0)
     over_tex = up_tex;
 
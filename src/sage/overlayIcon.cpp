@@ -45,6 +45,7 @@
 overlayIcon::overlayIcon()
 {
   strcpy(objectType, ICON);
+  batched = true;
   z = TOP_Z;
   tex = 0;
 }
@@ -61,34 +62,33 @@ overlayIcon::~overlayIcon()
 void overlayIcon::draw()
 {
   /**********    DRAW THE ICON   ***********/
-  glPushMatrix();
-  glColor4ub(255,255,255, alpha);
+  batch.pushMatrix();
+  batch.colorub(255,255,255, alpha);
   drawTexture(tex);
-  glPopMatrix();
+  batch.popMatrix();
 }
 
 
 void overlayIcon::drawTexture(GLuint tex)
 {
-  glEnable(GL_TEXTURE_2D);
-  glTranslatef(x, y, 0);
+  batch.translate(x, y);
 
-  glBindTexture (GL_TEXTURE_2D, tex);
-  glBegin(GL_QUADS);
+  batch.bindTexture(tex);
+  batch.begin(GL_QUADS);
 
-  glTexCoord2f(0.0, 0.0);
-  glVertex3f(0.0, 0.0, z);
+  batch.texCoord(0.0, 0.0);
+  batch.vertex(0.0, 0.0, z);
 
-  glTexCoord2f(0.0, 1.0);
-  glVertex3f(0.0, height, z);
+  batch.texCoord(0.0, 1.0);
+  batch.vertex(0.0, height, z);
 
-  glTexCoord2f(1.0, 1.0);
-  glVertex3f(width, height, z);
+  batch.texCoord(1.0, 1.0);
+  batch.vertex(width, height, z);
 
-  glTexCoord2f(1.0, 0.0);
-  glVertex3f(width, 0, z);
+  batch.texCoord(1.0, 0.0);
+  batch.vertex(width, 0, z);
 
-  glEnd();
+  batch.end();
 }
 
 
@@ -99,5 +99,5 @@ int overlayIcon::parseMessage(char *msg)
 
 void overlayIcon::parseGraphicsInfo(TiXmlElement *parent)
 {
-  tex = getTextureFromXml(parent, "image");
+  tex = getTexture(parent, "image");
 }
@@ -45,6 +45,7 @@
 overlayLabel::overlayLabel()
 {
   strcpy(objectType, LABEL);
+  batched = true;
   z = TOP_Z;
   ft = NULL;
   background = false;
@@ -67,39 +68,38 @@ void overlayLabel::drawBackground()
   if (!background)
     return;
 
-  glDisable(GL_TEXTURE_2D);
-  glColor4ub(backgroundColor.r, backgroundColor.g, backgroundColor.b, alpha);
+  batch.disableTexture();
+  batch.colorub(backgroundColor.r, backgroundColor.g, backgroundColor.b, alpha);
 
-  glBegin(GL_QUADS);
-  glVertex3f(x, y, z);
-  glVertex3f(x, y+height, z);
-  glVertex3f(x+width, y+height, z);
-  glVertex3f(x+width, y, z);
-  glEnd();
+  batch.begin(GL_QUADS);
+  batch.vertex(x, y, z);
+  batch.vertex(x, y+height, z);
+  batch.vertex(x+width, y+height, z);
+  batch.vertex(x+width, y, z);
+  batch.end();
 }
 
 
 void overlayLabel::drawTexture(GLuint tex)
 {
-  glEnable(GL_TEXTURE_2D);
-  glTranslatef(x, y, 0);
+  batch.translate(x, y);
 
-  glBindTexture (GL_TEXTURE_2D, tex);
-  glBegin(GL_QUADS);
+  batch.bindTexture(tex);
+  batch.begin(GL_QUADS);
 
-  glTexCoord2f(0.0, 0.0);
-  glVertex3f(0.0, 0.0, z);
+  batch.texCoord(0.0, 0.0);
+  batch.vertex(0.0, 0.0, z);
 
-  glTexCoord2f(0.0, 1.0);
-  glVertex3f(0.0, height, z);
+  batch.texCoord(0.0, 1.0);
+  batch.vertex(0.0, height, z);
 
-  glTexCoord2f(1.0, 1.0);
-  glVertex3f(width, height, z);
+  batch.texCoord(1.0, 1.0);
+  batch.vertex(width, height, z);
 
-  glTexCoord2f(1.0, 0.0);
-  glVertex3f(width, 0, z);
+  batch.texCoord(1.0, 0.0);
+  batch.vertex(width, 0, z);
 
-  glEnd();
+  batch.end();
 }
 
 void overlayLabel::parseSpecificInfo(TiXmlElement *parent)
@@ -102,7 +102,7 @@ void overlayMenu::drawMenu()
     for (int i=0; i<menuItems.size(); i++)
       menuItems[i]->draw();
 
-    glDisable(GL_TEXTURE_2D);
+    batch.disableTexture();
 
     if (currSelection != -1)
       drawSelection();
@@ -114,36 +114,36 @@ void overlayMenu::drawMenu()
 
 void overlayMenu::drawSelection()
 {
-  glColor4f(1,1,1,0.3);
+  batch.color(1,1,1,0.3);
 
   int w = shownBounds.width;
   int h = menuItems[currSelection]->height;
   int x = shownBounds.x;
   int y = int(shownBounds.top - currSelection*h - h);
 
-  glBegin(GL_QUADS);
-  glVertex3f(x, y, z+Z_STEP*3);
-  glVertex3f(x, y+h, z+Z_STEP*3);
-  glVertex3f(x+w, y+h, z+Z_STEP*3);
-  glVertex3f(x+w, y, z+Z_STEP*3);
-  glEnd();
+  batch.begin(GL_QUADS);
+  batch.vertex(x, y, z+Z_STEP*3);
+  batch.vertex(x, y+h, z+Z_STEP*3);
+  batch.vertex(x+w, y+h, z+Z_STEP*3);
+  batch.vertex(x+w, y, z+Z_STEP*3);
+  batch.end();
 }
 
 void overlayMenu::drawOutline()
 {
-  glColor4ub(255,255,255,menuItems[0]->fadeAlpha);
+  batch.colorub(255,255,255,menuItems[0]->fadeAlpha);
 
   int w = shownBounds.width + 2;
   int h = shownBounds.height + 2;
   int x = shownBounds.x - 1;
   int y = shownBounds.y - 1;
 
-  glBegin(GL_LINE_LOOP);
-  glVertex3f(x, y, z+Z_STEP*2);
-  glVertex3f(x, y+h, z+Z_STEP*2);
-  glVertex3f(x+w, y+h, z+Z_STEP*2);
-  glVertex3f(x+w, y, z+Z_STEP*2);
-  glEnd();
+  batch.begin(GL_LINE_LOOP);
+  batch.vertex(x, y, z+Z_STEP*2);
+  batch.vertex(x, y+h, z+Z_STEP*2);
+  batch.vertex(x+w, y+h, z+Z_STEP*2);
+  batch.vertex(x+w, y, z+Z_STEP*2);
+  batch.end();
 }
 
 
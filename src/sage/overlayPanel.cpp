@@ -51,6 +51,7 @@
 overlayPanel::overlayPanel()
 {
   strcpy(objectType, PANEL);
+  batched = true;
   z = TOP_Z;
   borderWidth = 0;
 
@@ -62,7 +63,7 @@ overlayPanel::overlayPanel()
 
 void overlayPanel::draw()
 {
-  glDisable(GL_TEXTURE_2D);
+  batch.disableTexture();
 
   /**********    DRAW THE PANEL   ***********/
 
@@ -73,14 +74,14 @@ void overlayPanel::draw()
 
 
   if (borderWidth > 0) {
-    glLineWidth( lineW(borderWidth*displayScale) );
-    glColor4ub(255,255,255,alpha);
-    glBegin(GL_LINE_LOOP);
-    glVertex3f(x-borderWidth, y-borderWidth, z+Z_STEP*2);
-    glVertex3f(x-borderWidth, y+height+borderWidth, z+Z_STEP*2);
-    glVertex3f(x+width+borderWidth, y+height+borderWidth, z+Z_STEP*2);
-    glVertex3f(x+width+borderWidth, y-borderWidth, z+Z_STEP*2);
-    glEnd();
+    batch.lineWidth( lineW(borderWidth*displayScale) );
+    batch.colorub(255,255,255,alpha);
+    batch.begin(GL_LINE_LOOP);
+    batch.vertex(x-borderWidth, y-borderWidth, z+Z_STEP*2);
+    batch.vertex(x-borderWidth, y+height+borderWidth, z+Z_STEP*2);
+    batch.vertex(x+width+borderWidth, y+height+borderWidth, z+Z_STEP*2);
+    batch.vertex(x+width+borderWidth, y-borderWidth, z+Z_STEP*2);
+    batch.end();
   }
 }
 
@@ -116,44 +117,44 @@ void overlayPanel::drawCurtain()
   float clr[4];
   glGetFloatv(GL_COLOR_CLEAR_VALUE, clr);
   float red=clr[0], green=clr[1], blue=clr[2], al=clr[3];
-  glColor4f(red, green, blue, 0.9);
+  batch.color(red, green, blue, 0.9);
 
   // solid one
-  glBegin(GL_QUADS);
-  glVertex3f(l, b, z);
-  glVertex3f(l, t, z);
-  glVertex3f(r, t, z);
-  glVertex3f(r, b, z);
-  glEnd();
+  batch.begin(GL_QUADS);
+  batch.vertex(l, b, z);
+  batch.vertex(l, t, z);
+  batch.vertex(r, t, z);
+  batch.vertex(r, b, z);
+  batch.end();
 
   // gradient one
   if (curtainDir == VERTICAL) {
-    glBegin(GL_QUADS);
-    glVertex3f(l, b, z);
-    glVertex3f(r, b, z);
-    glColor4f(red, green, blue, 0.0);
-    glVertex3f(r, b-o, z);
-    glVertex3f(l, b-o, z);
-    glEnd();
+    batch.begin(GL_QUADS);
+    batch.vertex(l, b, z);
+    batch.vertex(r, b, z);
+    batch.color(red, green, blue, 0.0);
+    batch.vertex(r, b-o, z);
+    batch.vertex(l, b-o, z);
+    batch.end();
   }
   else {
     if (curtainPos > 0) {
-      glBegin(GL_QUADS);
-      glVertex3f(l, t, z);
-      glVertex3f(l, b, z);
-      glColor4f(red, green, blue, 0.0);
-      glVertex3f(r+o, b, z);
-      glVertex3f(r+o, t, z);
-      glEnd();
+      batch.begin(GL_QUADS);
+      batch.vertex(l, t, z);
+      batch.vertex(l, b, z);
+      batch.color(red, green, blue, 0.0);
+      batch.vertex(r+o, b, z);
+      batch.vertex(r+o, t, z);
+      batch.end();
     }
     else {
-      glBegin(GL_QUADS);
-      glVertex3f(r, b, z);
-      glVertex3f(r, t, z);
-      glColor4f(red, green, blue, 0.0);
-      glVertex3f(l-o/2.0, t, z);
-      glVertex3f(l-o/2.0, b, z);
-      glEnd();
+      batch.begin(GL_QUADS);
+      batch.vertex(r, b, z);
+      batch.vertex(r, t, z);
+      batch.color(red, green, blue, 0.0);
+      batch.vertex(l-o/2.0, t, z);
+      batch.vertex(l-o/2.0, b, z);
+      batch.end();
     }
 
   }
@@ -162,14 +163,14 @@ void overlayPanel::drawCurtain()
 
 void overlayPanel::drawBackground()
 {
-  glColor4ub(backgroundColor.r, backgroundColor.g, backgroundColor.b, alpha);
-
-  glBegin(GL_QUADS);
-  glVertex3f(x, y, z);
-  glVertex3f(x, y+height, z);
-  glVertex3f(x+width, y+height, z);
-  glVertex3f(x+width, y, z);
-  glEnd();
+  batch.colorub(backgroundColor.r, backgroundColor.g, backgroundColor.b, alpha);
+
+  batch.begin(GL_QUADS);
+  batch.vertex(x, y, z);
+  batch.vertex(x, y+height, z);
+  batch.vertex(x+width, y+height, z);
+  batch.vertex(x+width, y, z);
+  batch.end();
 }
 
 void overlayPanel::parseSpecificInfo(TiXmlElement *parent)
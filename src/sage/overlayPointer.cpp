@@ -602,7 +602,7 @@ int overlayPointer::destroy()
 
 void overlayPointer::parseGraphicsInfo(TiXmlElement *parent)
 {
-  tex = getTextureFromXml(parent, "image");
+  tex = getTexture(parent, "image");
 }
 
 int overlayPointer::parseMessage(char *msg)
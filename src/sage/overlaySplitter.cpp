@@ -131,7 +131,7 @@ void overlaySplitter::parseSpecificInfo(TiXmlElement *parent)
 
 void overlaySplitter::parseGraphicsInfo(TiXmlElement *parent)
 {
-  tex = getTextureFromXml(parent, "image");
+  tex = getTexture(parent, "image");
 }
 
 
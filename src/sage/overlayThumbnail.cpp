@@ -45,6 +45,7 @@ overlayThumbnail::overlayThumbnail()
   :overlayButton()
 {
   strcpy(objectType, THUMBNAIL);
+  batched = false;  // still draws with the GL matrices
   dragX = dragY = 0;
   scaleMultiplier = 1.4;
   outline = false;
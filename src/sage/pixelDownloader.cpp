@@ -47,12 +47,26 @@
 #include "sageEvent.h"
 #include "sageBlockPartition.h"
 #include "sageReceiver.h"
-
-int montagePair::init(displayContext *context, sagePixFmt pfmt, int index, float depth, int winID, int async)
+#include "sageResourcePool.h"
+#include "sageTelemetry.h"
+#include "sageTrace.h"
+#include "sageAffinity.h"
+#include <algorithm>
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telFrames = telemetry.counter("sage_sdm_frames_total", "app frames completed on the display node");
+static int telBytes = telemetry.counter("sage_sdm_bytes_total", "pixel bytes taken from the block buffers");
+static int telLoss = telemetry.counter("sage_sdm_lost_bytes_total", "pixel bytes of frames that never arrived");
+static int telFetch = telemetry.histogram("sage_sdm_fetch_us", "time to copy the received blocks into textures, in microsecs");
+static int telQueue = telemetry.histogram("sage_sdm_queue_groups", "block groups waiting when the display thread fetches them");
+static int telSyncWait = telemetry.histogram("sage_sdm_sync_wait_us", "time a complete frame waits for the sync signal, in microsecs");
+static sageTrace &trace = sageTrace::instance();
+
+int montagePair::init(sageMontage *mon, int index, float depth, int winID, int async)
 {
   asyncUpdate = async;
 
-  montage = new sageMontage(context, pfmt);
+  montage = mon;
 
   montage->otherMontage = montage;
 
@@ -84,6 +98,14 @@ int montagePair::deleteMontage()
   return 0;
 }
 
+sageMontage* montagePair::detachMontage()
+{
+  sageMontage *mon = montage;
+  montage = NULL;
+
+  return mon;
+}
+
 int montagePair::setDepth(float depth)
 {
   montage->depth = depth;
@@ -111,8 +133,9 @@ montagePair::~montagePair()
 pixelDownloader::pixelDownloader() : reportRate(1), updatedFrame(0), curFrame(0), recv(NULL),
                                      streamNum(0), bandWidth(0), montageList(NULL), configID(0), frameCheck(false),
                                      syncFrame(0), updateType(SAGE_UPDATE_FOLLOW), activeRcvs(0), passiveUpdate(false),
-                                     dispConfigID(0), displayActive(false), status(PDL_WAIT_DATA), frameBlockNum(0), frameSize(0),
-                                     m_initialized(false)
+                                     dispConfigID(0), displayActive(false), status(PDL_WAIT_DATA), frameBlockNum(0), frameSize(0), eyePlanes(false), batchFrame(0),
+                                     m_initialized(false), initTime(0.0), setupTime(0.0), firstFrameShown(false),
+                                     syncWaitStart(0.0), framePTS(0.0), presentAt(0.0)
 {
   perfTimer.reset();
   fromBridgeParallel = 0;
@@ -122,6 +145,8 @@ pixelDownloader::pixelDownloader() : reportRate(1), updatedFrame(0), curFrame(0)
 
 int pixelDownloader::init(char *msg, dispSharedData *sh, streamProtocol *nwObj, bool sync, int sl)
 {
+  initTime = sage::getTime();
+
   char *msgPt = sage::tokenSeek(msg, 3);
   sscanf(msgPt, "%d %d %d", &instID, &groupSize, &blockSize);
 
@@ -145,6 +170,7 @@ int pixelDownloader::init(char *msg, dispSharedData *sh, streamProtocol *nwObj,
   shared = sh;
   syncOn = sync;
   syncLevel = sl;
+  playout.setDelay(shared->avDelay);
 
   // how many tiles a node has
   tileNum = shared->displayObj->getTileNum();
@@ -154,7 +180,16 @@ int pixelDownloader::init(char *msg, dispSharedData *sh, streamProtocol *nwObj,
   float depth = 1.0f - 0.01f*instID;
 
   for (int i=0; i<tileNum; i++) {
-    montageList[i].init(shared->context, pixFmt, i, depth, instID, asyncUpdate);
+    sageMontage *mon;
+    if (shared->resPool) {
+      // the part of the image a tile shows is at most as big as the tile, unless the window is scaled down
+      sageRect &tileRect = shared->displayObj->getTileRect(i);
+      mon = shared->resPool->getMontage(i, pixFmt, MIN(imgWidth, tileRect.width), MIN(imgHeight, tileRect.height));
+    }
+    else
+      mon = new sageMontage(shared->context, pixFmt);
+
+    montageList[i].init(mon, i, depth, instID, asyncUpdate);
   }
 
   configQueue.clear();
@@ -177,17 +212,39 @@ int pixelDownloader::init(char *msg, dispSharedData *sh, streamProtocol *nwObj,
   }
   //SAGE_PRINTLOG("pixelDownloader::init: new receiver buffer size %d Byte", shared->bufSize);
 
-  blockBuf = new sageBlockBuf(shared->bufSize, groupSize, blockSize, BUF_MEM_ALLOC | BUF_CTRL_GROUP);
+  if (shared->resPool)
+    blockBuf = shared->resPool->getBlockBuf(shared->bufSize, groupSize, blockSize);
+  else {
+    affinityPlacement placement("receiver");
+    blockBuf = new sageBlockBuf(shared->bufSize, groupSize, blockSize, BUF_MEM_ALLOC | BUF_CTRL_GROUP);
+  }
   recv = new sagePixelReceiver(msg, (rcvSharedData *)shared, nwObj, blockBuf);
 
   shared->displayObj->updateAppDepth(instID, montageList[0].getDepth());
   m_initialized = true;
+  setupTime = sage::getTime() - initTime;
 
   //SAGE_PRINTLOG("PDL %d(of SDM %d)::%s() : returning.\n", instID, shared->nodeID, __FUNCTION__);
 
   return 0;
 }
 
+int pixelDownloader::recordStream(char *dir)
+{
+  if (!recv)
+    return -1;
+
+  if (strcmp(dir, "stop") == 0) {
+    recv->stopRecording();
+    return 0;
+  }
+
+  char path[SAGE_NAME_LEN];
+  snprintf(path, SAGE_NAME_LEN, "%s/app-%d-node-%d.sgs", dir, instID, shared->nodeID);
+
+  return recv->startRecording(path);
+}
+
 int pixelDownloader::addStream(int senderID)
 {
   if (recv) {
@@ -222,8 +279,8 @@ int pixelDownloader::clearScreen()
 
 int pixelDownloader::swapMontages()
 {
-  bool activeMontage = false;
-
+  // removeMontage() and replaceMontage() damage only the tiles they touch
+  bool shown = false;
   for (int i=0; i<tileNum; i++) {
     montagePair &monPair = montageList[i];
 
@@ -234,13 +291,17 @@ int pixelDownloader::swapMontages()
       else {
         monPair.swapMontage();
         shared->displayObj->replaceMontage(monPair.getFrontMon());
+        shown = true;
       }
-      activeMontage = true;
     }
   }
 
-  if (activeMontage) {
-    shared->displayObj->setDirty();
+  // report how long the app took to show up on this node
+  if (shown && !firstFrameShown) {
+    firstFrameShown = true;
+    char info[TOKEN_LEN];
+    sprintf(info, "%d %.0f %.0f", instID, setupTime, sage::getTime() - initTime);
+    shared->eventQueue->sendEvent(EVENT_FIRST_FRAME, info);
   }
 
   return 0;
@@ -256,19 +317,21 @@ void pixelDownloader::processSync(int frame, int cmd)
   //SAGE_PRINTLOG("receive sync %d", syncFrame);
 
   if (updatedFrame == syncFrame) {
+    if (syncWaitStart > 0.0) {
+      double waited = sage::getTime() - syncWaitStart;
+      telemetry.observe(telSyncWait, (long long)waited);
+      double now = trace.now();
+      trace.record(TRACE_SYNC, instID, syncFrame, now - waited, now);
+      syncWaitStart = 0.0;
+    }
     swapMontages();
   }
   else {
-    bool screenUpdate = false;
     for (int i=0; i<tileNum; i++) {
       montagePair &monPair = montageList[i];
-      if (monPair.getClearFlag()) {
+      if (monPair.getClearFlag())
         clearTile(i);
-        screenUpdate = true;
-      }
     }
-    if (screenUpdate)
-      shared->displayObj->setDirty();
 
     if (cmd == SKIP_FRAME) {
       updatedFrame = syncFrame;
@@ -314,28 +377,44 @@ int pixelDownloader::enqueConfig(char *data)
   return 0;
 }
 
-bool pixelDownloader::reconfigDisplay(int confID)
+bool pixelDownloader::reconfigDisplay(int confID, bool hasPixels)
 {
   if (dispConfigID >= confID) {
     SAGE_PRINTLOG("[%d,%d] PDL::reconfigDisplay(%d) : configuration ID error", shared->nodeID, instID, confID);
     return false;
   }
 
+  // the newest configuration up to confID holds the layout
   char *configStr = NULL;
-  while (dispConfigID < confID) {
-    if (configQueue.size() == 0)
-      return false;
-
+  while (configQueue.size() > 0 && atoi(configQueue.front()) <= confID) {
+    if (configStr)
+      delete [] configStr;
     configStr = configQueue.front();
-    dispConfigID++;
     configQueue.pop_front();
   }
 
+  if (configStr) {
+    dispConfigID = atoi(configStr);
+    applyConfig(configStr);
+    delete [] configStr;
+  }
+
+  // the window covers this node, or covered it under the last layout :
+  // fsManager sent the configuration confID, wait for it
+  if (hasPixels || displayActive)
+    return (dispConfigID == confID);
+
+  // the window stays away from this node, nothing changes on the screen
+  return true;
+}
+
+void pixelDownloader::applyConfig(char *configStr)
+{
   int oldRcvs = activeRcvs;
   displayActive = false;
 
   sageRotation orientation;
-  sscanf(configStr, "%d %d %d %d %d %d", &windowLayout.x, &windowLayout.y,
+  sscanf(configStr, "%*d %d %d %d %d %d %d", &windowLayout.x, &windowLayout.y,
          &windowLayout.width, &windowLayout.height, &activeRcvs, (int *)&orientation);
   windowLayout.setOrientation(orientation);
 
@@ -350,11 +429,9 @@ bool pixelDownloader::reconfigDisplay(int confID)
       for (int i=0; i<tileNum; i++)
         montageList[i].clear();
     }
-    else {
+    else
       clearScreen();
-      shared->displayObj->setDirty();
-    }
-    return true;
+    return;
   }
 
   partition->setDisplayLayout(windowLayout);
@@ -368,10 +445,8 @@ bool pixelDownloader::reconfigDisplay(int confID)
     if (!tileRect.crop(windowLayout)) {
       if (syncOn)
         monPair.clear();
-      else {
+      else
         clearTile(i);
-        shared->displayObj->setDirty();
-      }
       continue;
     }
 
@@ -415,22 +490,43 @@ bool pixelDownloader::reconfigDisplay(int confID)
 
   if (oldRcvs != activeRcvs)
     updateType = SAGE_UPDATE_SETUP;
-
-  return true;
 }
 
-int pixelDownloader::downloadPixelBlock(sagePixelBlock *block, montagePair &monPair)
+void pixelDownloader::flushBlocks()
 {
-  sageMontage *mon = monPair.getBackMon();
+  if (copyBatch.size() > 0) {
+    // a right eye sent as a residual has to follow the left eye of its block
+    std::stable_sort(copyBatch.begin(), copyBatch.end(), sageBlockCopyOrder);
+
+    int first = 0;
+    for (int i=1; i<=(int)copyBatch.size(); i++) {
+      if (i == (int)copyBatch.size() || copyBatch[i].target != copyBatch[first].target) {
+        sageMontage *mon = montageList[copyBatch[first].target].getBackMon();
+        mon->loadPixelBlocks(&copyBatch[first], i - first);
+        first = i;
+      }
+    }
+    copyBatch.clear();
+  }
 
-  mon->loadPixelBlock(block);
-  //monPair.update();
+  for (int i=0; i<heldGroups.size(); i++)
+    blockBuf->returnBG(heldGroups[i]);
+  heldGroups.clear();
+}
 
-  return 0;
+void pixelDownloader::releaseGroup(sageBlockGroup *sbg, bool held)
+{
+  if (held)
+    heldGroups.push_back(sbg);
+  else
+    blockBuf->returnBG(sbg);
 }
 
 int pixelDownloader::fetchSageBlocks()
 {
+  telemetryTimer timer(telFetch);
+  traceScope fetchTrace(TRACE_FETCH, instID, curFrame);
+  telemetry.observe(telQueue, blockBuf->entryNum());
 
   // fetch block data from the block buffer
   sageBlockGroup *sbg;
@@ -440,6 +536,7 @@ int pixelDownloader::fetchSageBlocks()
   bool proceedSwap = false;
 
   while (sbg = blockBuf->front()) {
+    bool held = false;
 
     /**
      * the difference between updatedFrame and syncFrame should always 1
@@ -449,6 +546,7 @@ int pixelDownloader::fetchSageBlocks()
      * This is the most important pre-requisite of the sync algorithm
      */
     if ( syncOn && (sbg->getFrameID() > syncFrame + 1) )   {
+      flushBlocks();
       status = PDL_WAIT_SYNC; // wait for others to catch up
       return status;
     }
@@ -522,9 +620,11 @@ int pixelDownloader::fetchSageBlocks()
 #ifdef DEBUG_PDL
       //SAGE_PRINTLOG("[%d,%d] PDL::fetch() : flag CONFIG_UPDATE, curFrame %d, updatedFrame %d, config %d\n", shared->nodeID, instID,curFrame, updatedFrame, configID);
 #endif
+      // the montages may change
+      flushBlocks();
 
       if (configID < sbg->getConfigID()) {
-        if (reconfigDisplay(sbg->getConfigID())) {
+        if (reconfigDisplay(sbg->getConfigID(), false)) {
           configID = sbg->getConfigID();
 
 #ifdef DEBUG_PDL
@@ -556,9 +656,13 @@ int pixelDownloader::fetchSageBlocks()
 #ifdef DEBUG_PDL
       //SAGE_PRINTLOG("[%d,%d] PDL::fetch() : new PIXEL_DATA; sbg->getFrameID() %d > updatedFrame %d\n", shared->nodeID, instID, sbg->getFrameID(), updatedFrame);
 #endif
+      // blocks of another frame or configuration go into the montages first
+      if (copyBatch.size() > 0 && (sbg->getFrameID() != batchFrame || configID < sbg->getConfigID()))
+        flushBlocks();
+
       // see if config changed
       if (configID < sbg->getConfigID()) {
-        if (reconfigDisplay(sbg->getConfigID())) {
+        if (reconfigDisplay(sbg->getConfigID(), true)) {
           configID = sbg->getConfigID();
 #ifdef DEBUG_PDL
           SAGE_PRINTLOG("[%d,%d] PDL::fetch() : PIXEL_DATA with new Config %d; curFrame is now %d\n", shared->nodeID, instID, sbg->getConfigID(), sbg->getFrameID());
@@ -574,9 +678,20 @@ int pixelDownloader::fetchSageBlocks()
       }
 
       bandWidth += sbg->getDataSize() + GROUP_HEADER_SIZE;
+      telemetry.add(telBytes, sbg->getDataSize() + GROUP_HEADER_SIZE);
       curFrame = sbg->getFrameID();
       frameBlockNum += sbg->getBlockNum();
 
+      // the first group of a frame tells how far behind the sender we are
+      if (playout.isOn() && sbg->getBlockNum() > 0 && (*sbg)[0]) {
+        double pts = (*sbg)[0]->getPTS();
+        if (pts != framePTS) {
+          framePTS = pts;
+          if (pts > 0.0)
+            playout.arrival(pts, sageClock::instance().now());
+        }
+      }
+
       //SAGE_PRINTLOG("Numblocks: %d",sbg->getBlockNum());
       for (int i=0; i<sbg->getBlockNum(); i++) {
         sagePixelBlock *block = (*sbg)[i];
@@ -584,22 +699,30 @@ int pixelDownloader::fetchSageBlocks()
         if (!block)
           continue;
 
+        if (block->getPlane() != SAGE_PLANE_ALL)
+          eyePlanes = true;
+
         //SAGE_PRINTLOG("block header %s", (char *)block->getBuffer());
 
         blockMontageMap *map = (blockMontageMap *)partition->getBlockMap(block->getID());
-        int bx = block->x, by = block->y;
 
         while(map) {
-          block->translate(map->x, map->y);
-          //SAGE_PRINTLOG("block montage %d id %d pos %d , %d", map->infoID, block->getID(), block->x, block->y);
-          downloadPixelBlock(block, montageList[map->infoID]);
-          block->x = bx;
-          block->y = by;
+          //SAGE_PRINTLOG("block montage %d id %d pos %d , %d", map->infoID, block->getID(), block->x + map->x, block->y + map->y);
+          sageBlockCopy copy;
+          copy.block = block;
+          copy.x = block->x + map->x;
+          copy.y = block->y + map->y;
+          copy.target = map->infoID;
+          copyBatch.push_back(copy);
+          held = true;
           map = (blockMontageMap *)map->next;
         }
       } // end of foreach block
+      batchFrame = sbg->getFrameID();
 
-      if ( recv->getSenderNum() == 1  &&  !fromBridgeParallel) {
+      // stereo streams sent in planes have up to two blocks per table entry
+      // and leave some out, those finish frames only with END_FRAME
+      if ( recv->getSenderNum() == 1  &&  !fromBridgeParallel && !eyePlanes) {
         if ( partition && frameBlockNum >= partition->tableEntryNum() ) { // whole frame received
           useLastBlock = true; // setting flag for swapMontages to be executed, since END_FRAME
           proceedSwap = true;
@@ -653,11 +776,8 @@ int pixelDownloader::fetchSageBlocks()
     // This causes frame being displayed is always behind actual config ->  config l is applied but frame l-1 is displayed
     if ( proceedSwap ) {
       proceedSwap = false;
+      flushBlocks();
 
-      // now the most recent frame I got(curFrame) becomes updateFrame.
-      // this means that because of swapMontages() curFrames will become front montage which means it can be displayed
-      // therefore, it's updatedFrame
-      updatedFrame = curFrame;
 #ifdef DEBUG_PDL
       //if (useLastBlock)
       //SAGE_PRINTLOG("[%d,%d] PDL::fetch() : !!! ProceedSwap !!! using LastBlock fBN %d of %d; updF %d, syncF %d, cfID %d\n", shared->nodeID, instID, frameBlockNum, partition->tableEntryNum(), updatedFrame, syncFrame, configID);
@@ -665,49 +785,36 @@ int pixelDownloader::fetchSageBlocks()
       //SAGE_PRINTLOG("[%d,%d] PDL::fetch() : !!! ProceedSwap !!! using END_FRAME fBN %d of %d; updF %d, syncF %d, cfID %d\n", shared->nodeID, instID, frameBlockNum, partition->tableEntryNum(), updatedFrame, syncFrame, configID);
 #endif
       frameCounter++;
+      telemetry.add(telFrames);
 
       // calculate packet loss
-      packetLoss += frameSize-(frameBlockNum*blockSize);
+      if (!eyePlanes) {
+        packetLoss += frameSize-(frameBlockNum*blockSize);
+        if (frameSize > frameBlockNum*blockSize)
+          telemetry.add(telLoss, frameSize - frameBlockNum*blockSize);
+      }
       frameBlockNum = 0; //reset
       //actualFrameBlockNum = 0;
 
-      if (syncOn) {
-        if ( updatedFrame > syncFrame) {
-          // if this is the case, I'm too fast. I must wait for others
-
-#ifdef DELAY_COMPENSATION
-          //shared->syncClientObj->sendSlaveUpdateToBBS(updatedFrame, instID, activeRcvs, shared->nodeID, shared->latency);
-#else
-          if ( syncLevel == -1 ) {
-            shared->syncClientObj->sendSlaveUpdate(updatedFrame, instID, activeRcvs, updateType);
-          }
-          else {
-            shared->syncClientObj->sendSlaveUpdateToBBS(updatedFrame, instID, activeRcvs, shared->nodeID, 0);
-          }
-#endif
-          updateType = SAGE_UPDATE_FOLLOW;
-          status = PDL_WAIT_SYNC;
-
+      // a timestamped frame waits for its presentation time, so it is shown
+      // together with the audio and on all nodes at once
+      if (framePTS > 0.0) {
+        presentAt = playout.presentTime(framePTS);
+        framePTS = 0.0;
+        if (presentAt > sageClock::instance().now()) {
+          status = PDL_WAIT_PTS;
           blockBuf->next();
-          blockBuf->returnBG(sbg);
-
+          releaseGroup(sbg, held);
+          flushBlocks();
           return status;
         }
-        else if ( updatedFrame == syncFrame ) {
-#ifdef DEBUG_PDL
-          SAGE_PRINTLOG("\nPDL::fetch() : [%d,%d] updatedFrame == synchFrame %d, don't we need swapMontages() ? \n", syncFrame);
-#endif
-          //swapMontages();
-        }
-        else {
-          SAGE_PRINTLOG("\nPDL::fetch() : [%d,%d] FatalError! updF %d , syncF %d\n", shared->nodeID, instID, updatedFrame, syncFrame);
-        }
       }
-      else {
-#ifdef DEBUG_PDL
-        //SAGE_PRINTLOG("[%d,%d] PDL::fetch() : NO_SYNC; swapMont() frame %d, config %d\n\n", shared->nodeID, instID, updatedFrame, configID);
-#endif
-        swapMontages();
+
+      if (presentFrame() == PDL_WAIT_SYNC) {
+        blockBuf->next();
+        releaseGroup(sbg, held);
+        flushBlocks();
+        return status;
       }
     } // end of if(isLastBlock)
 
@@ -716,13 +823,15 @@ int pixelDownloader::fetchSageBlocks()
 
 
     blockBuf->next();
-    blockBuf->returnBG(sbg);
-
-
-
+    releaseGroup(sbg, held);
 
+    // the receiver can't fill groups that wait here
+    if (heldGroups.size() >= MAX(1, blockBuf->getGroupNum()/4))
+      flushBlocks();
   } // end of while(blockBuf->front())
 
+  flushBlocks();
+
   status = PDL_WAIT_DATA;
   //SAGE_PRINTLOG("exit fetch");
 
@@ -731,6 +840,63 @@ int pixelDownloader::fetchSageBlocks()
   return status;
 }
 
+int pixelDownloader::presentFrame()
+{
+  // now the most recent frame I got(curFrame) becomes updateFrame.
+  // this means that because of swapMontages() curFrames will become front montage which means it can be displayed
+  // therefore, it's updatedFrame
+  updatedFrame = curFrame;
+  status = PDL_WAIT_DATA;
+
+  if (syncOn) {
+    if ( updatedFrame > syncFrame) {
+      // if this is the case, I'm too fast. I must wait for others
+
+#ifdef DELAY_COMPENSATION
+      //shared->syncClientObj->sendSlaveUpdateToBBS(updatedFrame, instID, activeRcvs, shared->nodeID, shared->latency);
+#else
+      if ( syncLevel == -1 ) {
+        shared->syncClientObj->sendSlaveUpdate(updatedFrame, instID, activeRcvs, updateType);
+      }
+      else {
+        shared->syncClientObj->sendSlaveUpdateToBBS(updatedFrame, instID, activeRcvs, shared->nodeID, 0);
+      }
+#endif
+      updateType = SAGE_UPDATE_FOLLOW;
+      status = PDL_WAIT_SYNC;
+      syncWaitStart = sage::getTime();
+    }
+    else if ( updatedFrame == syncFrame ) {
+#ifdef DEBUG_PDL
+      SAGE_PRINTLOG("\nPDL::fetch() : [%d,%d] updatedFrame == synchFrame %d, don't we need swapMontages() ? \n", syncFrame);
+#endif
+      //swapMontages();
+    }
+    else {
+      SAGE_PRINTLOG("\nPDL::fetch() : [%d,%d] FatalError! updF %d , syncF %d\n", shared->nodeID, instID, updatedFrame, syncFrame);
+    }
+  }
+  else {
+#ifdef DEBUG_PDL
+    //SAGE_PRINTLOG("[%d,%d] PDL::fetch() : NO_SYNC; swapMont() frame %d, config %d\n\n", shared->nodeID, instID, updatedFrame, configID);
+#endif
+    swapMontages();
+  }
+
+  return status;
+}
+
+int pixelDownloader::checkPresentTime()
+{
+  if (status != PDL_WAIT_PTS || sageClock::instance().now() < presentAt)
+    return status;
+
+  if (presentFrame() == PDL_WAIT_DATA)
+    fetchSageBlocks();
+
+  return status;
+}
+
 int pixelDownloader::evalPerformance(char **frameStr, char **bandStr)
 {
   //Calculate performance here
@@ -776,14 +942,20 @@ pixelDownloader::~pixelDownloader()
     montagePair &monPair = montageList[i];
     sageMontage* mon = monPair.getFrontMon();
     shared->displayObj->removeMontage(mon);
-    monPair.deleteMontage();
+    if (shared->resPool)
+      shared->resPool->putMontage(monPair.detachMontage());
+    else
+      monPair.deleteMontage();
   }
 
-  shared->displayObj->setDirty();
-
   delete [] montageList;
   delete recv;
-  delete blockBuf;
+
+  // the receiver thread is gone, the buffer can go to the next app
+  if (shared->resPool)
+    shared->resPool->putBlockBuf(blockBuf);
+  else
+    delete blockBuf;
 
   for (int i=0; i<configQueue.size(); i++) {
     char *configData = configQueue.front();
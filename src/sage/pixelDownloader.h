@@ -43,14 +43,17 @@
 
 #include "sage.h"
 #include "sageSync.h"
+#include "sageClock.h"
 
 
 #include "sageEvent.h"
+#include "sageBlockCopy.h"
 
 class pixelDownloader;
 class dispSharedData;
 class sageMontage;
 class sageBlockBuf;
+class sageBlockGroup;
 class sagePixelBlock;
 class displayContext;
 class sageBlockPartition;
@@ -72,7 +75,7 @@ private:
 public:
   montagePair() : renewMontage(false), frontMon(0), active(false),
                   clearFlag(false) {}
-  int init(displayContext *context, sagePixFmt pfmt, int index, float depth, int winID, int asyncUpdate);
+  int init(sageMontage *mon, int index, float depth, int winID, int asyncUpdate);
   inline sageMontage* getFrontMon() { return montage; }
   inline sageMontage* getBackMon() { return montage; }
   int setDepth(float depth);
@@ -86,6 +89,11 @@ public:
   void swapMontage();
 
   int deleteMontage();
+
+  /**
+   * gives up the montage, e.g. to the resource pool, instead of deleting it
+   */
+  sageMontage* detachMontage();
   inline bool isActive()  { return active; }
   inline void activate()  { active = true, clearFlag = false; }
   inline void deactivate(){ active = false, clearFlag = false; }
@@ -101,6 +109,7 @@ public:
 #define PDL_WAIT_CONFIG 1
 #define PDL_WAIT_DATA   2
 #define PDL_WAIT_SYNC   3
+#define PDL_WAIT_PTS    4
 
 /**
  * \brief class pixelDownloader (per application). It reads pixel data from buffer and downloads into texture memory.
@@ -119,7 +128,7 @@ protected:
   bool syncOn; /**< whether we ensure sync b/w tiles or not */
   int syncLevel;
   bool displayActive;
-  int  status; /**< PDL_WAIT_CONFIG 1, PDL_WAIT_DATA 2, and PDL_WAIT_SYNC 3*/
+  int  status; /**< PDL_WAIT_CONFIG 1, PDL_WAIT_DATA 2, PDL_WAIT_SYNC 3 and PDL_WAIT_PTS 4 */
   bool m_initialized;
 
   sagePixelReceiver *recv; /**< sagePixelReceiver */
@@ -133,9 +142,19 @@ protected:
   unsigned packetLoss;
   int frameBlockNum;
   int frameSize;
+  bool eyePlanes;   // the stream sends the eyes of its stereo blocks apart
 
   int fromBridgeParallel;
 
+  double initTime;  /**< when init() started, in microsecs */
+  double setupTime; /**< how long init() took */
+  bool firstFrameShown;
+  double syncWaitStart; /**< when the last complete frame started waiting for sync */
+
+  sagePlayout playout; /**< schedules timestamped frames on the cluster clock */
+  double framePTS;     /**< timestamp of the frame being received, 0 if none */
+  double presentAt;    /**< cluster time the held frame is shown at */
+
   sageBlockPartition *partition;
   sageRect windowLayout;
 
@@ -153,8 +172,21 @@ protected:
 
   std::deque<char *> configQueue;
 
+  // blocks of the fetched groups of a frame, loaded into the montages at once
+  std::vector<sageBlockCopy> copyBatch;
+  std::vector<sageBlockGroup *> heldGroups;   /**< groups of copyBatch, returned after the copy */
+  int batchFrame;
+
   //int sendPerformanceInfo();
-  int downloadPixelBlock(sagePixelBlock *block, montagePair &monPair);
+
+  /**
+   * loads copyBatch into the montages, sorted so that the blocks side by
+   * side are copied together, and returns the held groups to blockBuf
+   */
+  void flushBlocks();
+
+  /** keeps sbg until the next flushBlocks() if its blocks are in copyBatch */
+  void releaseGroup(sageBlockGroup *sbg, bool held);
   int clearTile(int tileIdx);
 
   /**
@@ -163,6 +195,18 @@ protected:
   int clearScreen();
   int setupSyncInfo(sagePixelBlock *block);
 
+  /**
+   * sets up the montages and the block table for a window layout
+   * "configID x y width height activeRcvs orientation"
+   */
+  void applyConfig(char *configStr);
+
+  /**
+   * the frame in the back montages is complete and due: reports it to the
+   * sync master, or swaps the montages if the app isn't synced
+   */
+  int presentFrame();
+
 public:
   /**
    * starts with updateType = SAGE_UPDATE_FOLLOW, status = PDL_WAIT_DATA
@@ -197,6 +241,13 @@ public:
    */
   void processSync(int frame, int cmd = 0);
 
+  /**
+   * Frames with a timestamp are held in PDL_WAIT_PTS until the cluster clock
+   * reaches their presentation time. Called on every refresh and sync round,
+   * goes on with the frame and the blocks behind it when it is due
+   */
+  int checkPresentTime();
+
   int enqueConfig(char *data);
   int setDepth(float depth);
 
@@ -206,12 +257,26 @@ public:
    */
   int addStream(int senderID);
 
+  /**
+   * records what this node receives of the app to
+   * dir/app-<instID>-node-<nodeID>.sgs, "stop" ends the recording
+   */
+  int recordStream(char *dir);
+
   /**
    * When a window is moved or resized, the config of back montage is
    * updated immediately, the front montage is updated when it is swapped.
    */
   int swapMontages();
-  bool reconfigDisplay(int id);
+
+  /**
+   * fsManager sends a configuration only to the nodes the window covers now
+   * or covered before, so a node sees a subset of the configuration IDs.
+   * Applies the newest queued configuration up to id and returns false while
+   * the one for id is still on the way. hasPixels tells that the data for id
+   * has blocks for this node, i.e. the window covers it
+   */
+  bool reconfigDisplay(int id, bool hasPixels);
   int evalPerformance(char **frameStr, char **bandStr); /**< evaluate performance */
   inline void setReportRate(int rate) { reportRate = rate; }
   inline void resetTimer() { perfTimer.reset(); }
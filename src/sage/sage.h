@@ -93,6 +93,8 @@
 #define ROTATE_WINDOW      SAGE_UI_TO_FSM + 18
 #define PUSH_TO_BACK       SAGE_UI_TO_FSM + 19
 #define SAVE_SCREENSHOT    SAGE_UI_TO_FSM + 20
+#define RECORD_WALL        SAGE_UI_TO_FSM + 21
+#define RECORD_STREAM      SAGE_UI_TO_FSM + 22
 
 #define NETWORK_RESERVED   SAGE_UI_TO_FSM + 50
 
@@ -119,6 +121,7 @@
 #define DISP_DEPTH_CHANGED     DISP_MESSAGE + 103
 #define DISP_RCV_FRATE_RPT     DISP_MESSAGE + 104
 #define DISP_RCV_BANDWITH_RPT  DISP_MESSAGE + 105
+#define DISP_APP_FIRST_FRAME   DISP_MESSAGE + 106
 
 // gStreamRcv Messages
 #define RCV_INIT               GRCV_MESSAGE
@@ -151,6 +154,7 @@
 #define BRIDGE_UI_REG          BRIDGE_MESSAGE + 9
 #define BRIDGE_APP_INST_READY BRIDGE_MESSAGE + 10
 #define CLEAR_APP_INSTANCE    BRIDGE_MESSAGE + 11
+#define BRIDGE_NODE_LOAD      BRIDGE_MESSAGE + 12
 
 // fsManager to UI : 40000
 #define SAGE_STATUS      FSM_TO_SAGE_UI
@@ -0,0 +1,351 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageAffinity.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageAffinity.h"
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+
+// numaif.h isn't installed everywhere, the policies are all we need of it
+#ifndef MPOL_PREFERRED
+#define MPOL_DEFAULT   0
+#define MPOL_PREFERRED 1
+#endif
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE   (1<<1)
+#endif
+#endif
+
+// cpus and ranges like "0-3", separated by sep, added to cpus
+static int parseList(const char *str, char sep, std::vector<int> &cpus)
+{
+  const char *p = str;
+
+  while (*p && *p != '\n') {
+    char *end;
+    long first = strtol(p, &end, 10);
+    if (end == p || first < 0)
+      return -1;
+
+    long last = first;
+    p = end;
+    if (*p == '-') {
+      p++;
+      last = strtol(p, &end, 10);
+      if (end == p || last < first)
+        return -1;
+      p = end;
+    }
+
+    for (long i=first; i<=last; i++)
+      cpus.push_back((int)i);
+
+    if (*p == sep)
+      p++;
+    else if (*p && *p != '\n')
+      return -1;
+  }
+
+  return 0;
+}
+
+// "nodeN" or "NODEN", -1 for cpu lists
+static int specNode(const char *spec)
+{
+  if (strncmp(spec, "node", 4) != 0 && strncmp(spec, "NODE", 4) != 0)
+    return -1;
+
+  return atoi(spec + 4);
+}
+
+sageAffinity::sageAffinity()
+{
+  pthread_mutex_init(&lock, NULL);
+  pthread_key_create(&placementKey, NULL);
+}
+
+sageAffinity& sageAffinity::instance()
+{
+  static sageAffinity affinity;
+  return affinity;
+}
+
+int sageAffinity::parseSpec(const char *spec, std::vector<int> &cpus)
+{
+  cpus.clear();
+
+  int node = specNode(spec);
+  if (node >= 0)
+    return nodeCpus(node, cpus);
+
+  if (parseList(spec, '+', cpus) < 0 || cpus.empty())
+    return -1;
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  return 0;
+}
+
+int sageAffinity::nodeCpus(int node, std::vector<int> &cpus)
+{
+  cpus.clear();
+
+  char path[SAGE_NAME_LEN];
+  sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+  FILE *fp = fopen(path, "r");
+  if (!fp)
+    return -1;
+
+  char list[TOKEN_LEN];
+  int ret = -1;
+  if (fgets(list, TOKEN_LEN, fp))
+    ret = parseList(list, ',', cpus);
+  fclose(fp);
+
+  if (ret < 0 || cpus.empty())
+    return -1;
+
+  std::sort(cpus.begin(), cpus.end());
+  return 0;
+}
+
+int sageAffinity::nodeNum()
+{
+  std::vector<int> cpus;
+  int num = 0;
+
+  for (int i=0; i<AFFINITY_MAX_NODES; i++) {
+    if (nodeCpus(i, cpus) == 0)
+      num++;
+  }
+
+  return MAX(num, 1);
+}
+
+int sageAffinity::cpuNum()
+{
+#if defined(WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return (int)info.dwNumberOfProcessors;
+#else
+  return MAX((int)sysconf(_SC_NPROCESSORS_CONF), 1);
+#endif
+}
+
+int sageAffinity::set(const char *name, const char *spec)
+{
+  std::vector<int> cpus;
+  if (parseSpec(spec, cpus) < 0) {
+    SAGE_PRINTLOG("sageAffinity : invalid cpu spec %s for %s threads", spec, name);
+    return -1;
+  }
+
+  pthread_mutex_lock(&lock);
+  specs[name] = spec;
+  pthread_mutex_unlock(&lock);
+
+  return 0;
+}
+
+int sageAffinity::set(const char *assignment)
+{
+  const char *spec = strchr(assignment, '=');
+  if (!spec || spec == assignment) {
+    SAGE_PRINTLOG("sageAffinity : invalid assignment %s", assignment);
+    return -1;
+  }
+
+  std::string name(assignment, spec - assignment);
+  return set(name.c_str(), spec + 1);
+}
+
+void sageAffinity::getAssignments(char *str)
+{
+  pthread_mutex_lock(&lock);
+  std::map<std::string, std::string>::iterator it;
+  for (it = specs.begin(); it != specs.end(); it++) {
+    strcat(str, " ");
+    strcat(str, it->first.c_str());
+    strcat(str, "=");
+    strcat(str, it->second.c_str());
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+int sageAffinity::bind(const char *name)
+{
+  std::string spec;
+
+  pthread_mutex_lock(&lock);
+  std::map<std::string, std::string>::iterator it = specs.find(name);
+  if (it != specs.end())
+    spec = it->second;
+  pthread_mutex_unlock(&lock);
+
+  if (spec.empty())
+    return 0;
+
+  std::vector<int> cpus;
+  if (parseSpec(spec.c_str(), cpus) < 0) {
+    SAGE_PRINTLOG("sageAffinity : no cpus in %s for %s threads", spec.c_str(), name);
+    return -1;
+  }
+
+#if defined(__linux__)
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (int i=0; i<(int)cpus.size(); i++) {
+    if (cpus[i] < CPU_SETSIZE)
+      CPU_SET(cpus[i], &cpuset);
+  }
+
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+    SAGE_PRINTLOG("sageAffinity : can't bind %s thread to cpus %s", name, spec.c_str());
+    return -1;
+  }
+
+  SAGE_PRINTLOG("sageAffinity : %s thread bound to cpus %s", name, spec.c_str());
+  return 0;
+#else
+  SAGE_PRINTLOG("sageAffinity : threads can't be bound on this platform, %s ignored", name);
+  return -1;
+#endif
+}
+
+int sageAffinity::nodeOf(const char *name)
+{
+  std::string spec;
+
+  pthread_mutex_lock(&lock);
+  std::map<std::string, std::string>::iterator it = specs.find(name);
+  if (it != specs.end())
+    spec = it->second;
+  pthread_mutex_unlock(&lock);
+
+  if (spec.empty())
+    return -1;
+
+  int node = specNode(spec.c_str());
+  if (node >= 0)
+    return node;
+
+  std::vector<int> cpus, nodeList;
+  if (parseSpec(spec.c_str(), cpus) < 0)
+    return -1;
+
+  // the node that has all the cpus
+  for (int i=0; i<AFFINITY_MAX_NODES; i++) {
+    if (nodeCpus(i, nodeList) < 0)
+      continue;
+
+    if (std::includes(nodeList.begin(), nodeList.end(), cpus.begin(), cpus.end()))
+      return i;
+  }
+
+  return -1;
+}
+
+int sageAffinity::preferNode(int node)
+{
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+  if (node < 0)
+    return (syscall(SYS_set_mempolicy, MPOL_DEFAULT, NULL, 0) == 0) ? 0 : -1;
+
+  if (node >= (int)sizeof(unsigned long)*8)
+    return -1;
+
+  unsigned long mask = 1UL << node;
+  if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &mask, sizeof(mask)*8 + 1) != 0)
+    return -1;
+
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+int sageAffinity::placeMemory(void *addr, size_t len, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+  if (node < 0 || node >= (int)sizeof(unsigned long)*8)
+    return -1;
+
+  unsigned long mask = 1UL << node;
+  if (syscall(SYS_mbind, addr, len, MPOL_PREFERRED, &mask, sizeof(mask)*8 + 1, MPOL_MF_MOVE) != 0)
+    return -1;
+
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+int sageAffinity::placementNode()
+{
+  // stored as node+1, the key reads NULL in threads that never set it
+  return (int)(long)pthread_getspecific(placementKey) - 1;
+}
+
+void sageAffinity::setPlacementNode(int node)
+{
+  pthread_setspecific(placementKey, (void *)(long)(node + 1));
+}
+
+affinityPlacement::affinityPlacement(const char *name)
+{
+  node = sageAffinity::instance().nodeOf(name);
+  if (node < 0)
+    return;
+
+  sageAffinity::instance().setPlacementNode(node);
+  if (sageAffinity::preferNode(node) < 0)
+    SAGE_PRINTLOG("sageAffinity : no memory policy for node %d, only the pixel arena follows it", node);
+}
+
+affinityPlacement::~affinityPlacement()
+{
+  if (node >= 0) {
+    sageAffinity::instance().setPlacementNode(-1);
+    sageAffinity::preferNode(-1);
+  }
+}
@@ -0,0 +1,134 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageAffinity.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_AFFINITY_H
+#define SAGE_AFFINITY_H
+
+#include "sageBase.h"
+#include "misc.h"
+#include <map>
+#include <string>
+#include <vector>
+
+// NUMA nodes looked for in /sys/devices/system/node
+#define AFFINITY_MAX_NODES 64
+
+/**
+ * Places the named pipeline threads of a process on cpus. A spec is a
+ * list of cpus and ranges joined by '+', like "0-3+8", or "nodeN" for all
+ * the cpus of a NUMA node ("," separates config tokens). The names used :
+ *
+ *   network  - SAIL network thread (sageStreamer)
+ *   udpsend  - UDP sending thread
+ *   receiver - SDM pixel receiving threads
+ *   display  - SDM main thread, pixel downloaders and drawing
+ *   sync     - sync client, master and manager threads
+ *
+ * Each thread calls bind() with its name when it starts, threads without
+ * a spec are left to the scheduler. Specs come from "AFFINITY name spec"
+ * lines of the SAIL config and the tile config. Pinning and memory
+ * placement are done on Linux only.
+ */
+class sageAffinity {
+private:
+  pthread_mutex_t lock;
+  std::map<std::string, std::string> specs;
+  pthread_key_t placementKey;
+
+  sageAffinity();
+
+public:
+  static sageAffinity& instance();
+
+  /** returns -1 if the spec can't be parsed */
+  int set(const char *name, const char *spec);
+
+  /** an assignment like "receiver=node0", as sent in RCV_INIT */
+  int set(const char *assignment);
+
+  /** " name=spec" for each assignment, appended to str */
+  void getAssignments(char *str);
+
+  /**
+   * pins the calling thread to the cpus of name. Returns 0 if it is
+   * pinned or there is no spec for name, -1 on errors
+   */
+  int bind(const char *name);
+
+  /** NUMA node the cpus of name are on, -1 if unknown or several */
+  int nodeOf(const char *name);
+
+  /** cpus of a spec, sorted. Returns -1 if it can't be parsed */
+  static int parseSpec(const char *spec, std::vector<int> &cpus);
+
+  /** cpus of a NUMA node, from sysfs */
+  static int nodeCpus(int node, std::vector<int> &cpus);
+  static int nodeNum();
+  static int cpuNum();
+
+  /**
+   * memory the calling thread touches first from now on goes to node,
+   * -1 goes back to the default policy
+   */
+  static int preferNode(int node);
+
+  /** puts the pages of a range on node, before they are touched */
+  static int placeMemory(void *addr, size_t len, int node);
+
+  /** node of the affinityPlacement of the calling thread, -1 if none */
+  int placementNode();
+  void setPlacementNode(int node);
+};
+
+/**
+ * Buffers allocated while one exists are placed on the node of a named
+ * thread, the one that mostly fills or reads them. The pixel arena takes
+ * its slabs from that node, other allocations follow the memory policy of
+ * the thread.
+ */
+class affinityPlacement {
+private:
+  int node;
+
+public:
+  affinityPlacement(const char *name);
+  ~affinityPlacement();
+};
+
+#endif
@@ -0,0 +1,189 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageAffinityBench.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+/*
+ * Compares thread placements of the SDM receive path : a "receiver"
+ * thread fills a ring of block groups and a "display" thread copies them
+ * out, like the pixel receiver and the downloader. The placements are
+ * unpinned, both threads on one node, and the threads on two nodes with
+ * the ring on either side. Specs given on the command line are run too.
+ *
+ *   sageAffinityBench [MB [receiverSpec displaySpec]]
+ */
+
+#include "sageAffinity.h"
+
+#define BENCH_CHUNK (1024*1024)
+#define BENCH_CHUNKS 8
+
+static pthread_mutex_t ringLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ringCond = PTHREAD_COND_INITIALIZER;
+static long long filled, consumed;
+static long long chunks;
+static char *ring;
+
+static void* receiverThread(void *args)
+{
+  sageAffinity::instance().bind("receiver");
+
+  for (long long i=0; i<chunks; i++) {
+    pthread_mutex_lock(&ringLock);
+    while (filled - consumed >= BENCH_CHUNKS)
+      pthread_cond_wait(&ringCond, &ringLock);
+    pthread_mutex_unlock(&ringLock);
+
+    memset(ring + (i % BENCH_CHUNKS)*BENCH_CHUNK, (int)i, BENCH_CHUNK);
+
+    pthread_mutex_lock(&ringLock);
+    filled++;
+    pthread_cond_broadcast(&ringCond);
+    pthread_mutex_unlock(&ringLock);
+  }
+
+  return NULL;
+}
+
+static void* displayThread(void *args)
+{
+  sageAffinity::instance().bind("display");
+
+  char *texture = (char *)malloc(BENCH_CHUNK);
+  memset(texture, 0, BENCH_CHUNK);
+
+  for (long long i=0; i<chunks; i++) {
+    pthread_mutex_lock(&ringLock);
+    while (filled <= consumed)
+      pthread_cond_wait(&ringCond, &ringLock);
+    pthread_mutex_unlock(&ringLock);
+
+    memcpy(texture, ring + (i % BENCH_CHUNKS)*BENCH_CHUNK, BENCH_CHUNK);
+
+    pthread_mutex_lock(&ringLock);
+    consumed++;
+    pthread_cond_broadcast(&ringCond);
+    pthread_mutex_unlock(&ringLock);
+  }
+
+  free(texture);
+  return NULL;
+}
+
+// rcvSpec and dispSpec NULL leave the threads unpinned
+static int run(const char *label, const char *rcvSpec, const char *dispSpec, const char *bufOwner)
+{
+  sageAffinity &affinity = sageAffinity::instance();
+  if (rcvSpec && (affinity.set("receiver", rcvSpec) < 0 || affinity.set("display", dispSpec) < 0))
+    return -1;
+
+  {
+    affinityPlacement placement(bufOwner);
+    ring = (char *)malloc(BENCH_CHUNK*BENCH_CHUNKS);
+    memset(ring, 0, BENCH_CHUNK*BENCH_CHUNKS);
+  }
+
+  filled = consumed = 0;
+
+  sageTimer timer;
+  pthread_t rcvId, dispId;
+  pthread_create(&rcvId, 0, receiverThread, NULL);
+  pthread_create(&dispId, 0, displayThread, NULL);
+  pthread_join(rcvId, NULL);
+  pthread_join(dispId, NULL);
+  double us = timer.getTimeUS();
+
+  free(ring);
+
+  double bytes = (double)chunks * BENCH_CHUNK;
+  printf("%-34s %-10s %-10s %6.2f GB/s\n", label, rcvSpec ? rcvSpec : "-",
+         dispSpec ? dispSpec : "-", bytes / us / 1000.0);
+
+  return 0;
+}
+
+// the idx-th cpu of a node
+static bool nodeCpu(int node, int idx, char *spec)
+{
+  std::vector<int> cpus;
+  if (sageAffinity::nodeCpus(node, cpus) < 0 || (int)cpus.size() <= idx)
+    return false;
+
+  sprintf(spec, "%d", cpus[idx]);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  int mb = 4096;
+
+  if (argc >= 2)
+    mb = atoi(argv[1]);
+
+  if (mb <= 0 || argc == 3) {
+    fprintf(stderr, "usage: %s [MB [receiverSpec displaySpec]]\n", argv[0]);
+    return -1;
+  }
+
+  chunks = (long long)mb * 1048576 / BENCH_CHUNK;
+
+  int nodes = sageAffinity::nodeNum();
+  printf("%d cpus, %d NUMA nodes, %d MB per placement\n\n", sageAffinity::cpuNum(), nodes, mb);
+  printf("%-34s %-10s %-10s %s\n", "placement", "receiver", "display", "throughput");
+
+  run("unpinned", NULL, NULL, "receiver");
+
+  char rcvSpec[SAGE_NAME_LEN], dispSpec[SAGE_NAME_LEN];
+  if (nodeCpu(0, 0, rcvSpec) && nodeCpu(0, 1, dispSpec))
+    run("one node", rcvSpec, dispSpec, "receiver");
+
+  if (nodes > 1 && nodeCpu(0, 0, rcvSpec) && nodeCpu(1, 0, dispSpec)) {
+    run("two nodes, ring on receiver node", rcvSpec, dispSpec, "receiver");
+    run("two nodes, ring on display node", rcvSpec, dispSpec, "display");
+  }
+  else
+    printf("(one NUMA node, the placements across nodes are skipped)\n");
+
+  if (argc >= 4) {
+    if (run("given", argv[2], argv[3], "receiver") < 0) {
+      fprintf(stderr, "invalid spec %s or %s\n", argv[2], argv[3]);
+      return -1;
+    }
+  }
+
+  return 0;
+}
@@ -41,6 +41,7 @@
 #include "sageAppAudio.h"
 #include "sageAudioCircBuf.h"
 #include "sageAudioModule.h"
+#include "sageClock.h"
 
 sageAppAudio::sageAppAudio(sageAudioCircBuf* audioBuffer, int maxsize) : buffer(audioBuffer), initialized(false)
 {
@@ -57,6 +58,7 @@ sageAppAudio::sageAppAudio(sageAudioCircBuf* audioBuffer, int maxsize) : buffer(
   audioAppRawBuffer[1] = malloc(maxAudioBuffSize);
   audiobufSize[0] = maxAudioBuffSize;
   audiobufSize[1] = maxAudioBuffSize;
+  pushTime[0] = pushTime[1] = 0.0;
 
   remainBufSize =0;
   remainBuf = NULL;
@@ -153,6 +155,7 @@ int sageAppAudio::processData()
       memcpy(block->buff, buf, byteBlock);
       block->frameIndex = buffer->getWriteIndex();
       block->gframeIndex = sageAudioModule::_instance->getgFrameNum();
+      block->pts = pushTime[readIndex];
       block->reformatted = 1;
       buffer->updateWriteIndex();
       buf += byteBlock;
@@ -200,6 +203,7 @@ int sageAppAudio::swapBuffer(int size, void *buf)
 
   memcpy(bufaudio, buf, size);
   audiobufSize[writeIndex] = size + remainBufSize;
+  pushTime[writeIndex] = sageClock::instance().now();
 
 
   writeIndex = (writeIndex +1) % 2;
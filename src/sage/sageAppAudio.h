@@ -77,6 +77,7 @@ protected:
 
   void * audioAppRawBuffer[2];
   int audiobufSize[2];
+  double pushTime[2];  // cluster clock when the app pushed the samples
 
   int remainBufSize;
   void * remainBuf;
@@ -41,11 +41,13 @@
 
 #include "sageAudio.h"
 #include "sageAudioModule.h"
+#include "sageClock.h"
 
 sageAudio::sageAudio()
   : audioStream(NULL), audioParameters(NULL), audioMode(SAGE_AUDIO_CAPTURE), deviceNum(-1),
     sampleFmt(SAGE_SAMPLE_FLOAT32), samplingRate(44100), channels(2), framePerBuffer(1024),
-    playFlag(AUDIO_STOP), buffer(NULL), minLatency(1000), maxLatency(0), ID(-1)
+    playFlag(AUDIO_STOP), buffer(NULL), minLatency(1000), maxLatency(0), ID(-1),
+    playBlock(NULL), playPos(0.0), playRate(1.0), playAligned(false)
 {
 }
 
@@ -178,6 +180,10 @@ int sageAudio::reset( int id, sageAudioCircBuf *buf )
 {
   ID = id;
   buffer = buf;
+  playBlock = NULL;
+  playPos = 0.0;
+  playRate = 1.0;
+  playAligned = false;
   std::cout << "sageAudio::reset " << ID << std::endl;
   return 0;
 }
@@ -426,6 +432,15 @@ int sageAudio::playCallback( const void *inputBuffer, void *outputBuffer,
   sageAudio *This = (sageAudio*)userData;
   //if (This ==  NULL) return 0;      // for safety.... it needs, but it's not possible to get NULL
   //if(This->buffer == NULL) return 0;
+
+  // the receive buffer holds floats
+  if (This->sampleFmt == SAGE_SAMPLE_FLOAT32) {
+    double outTime = sageClock::instance().now();
+    if (timeInfo && timeInfo->outputBufferDacTime > timeInfo->currentTime)
+      outTime += (timeInfo->outputBufferDacTime - timeInfo->currentTime) * 1000000.0;
+    return This->playScheduled((float *)outputBuffer, framesPerBuffer, outTime);
+  }
+
   audioBlock *block = This->buffer->readBlock();
 
   /** todo */
@@ -584,6 +599,90 @@ int sageAudio::playCallback( const void *inputBuffer, void *outputBuffer,
   return 0;
 }
 
+int sageAudio::playScheduled(float *out, unsigned long frames, double outTime)
+{
+  double frameTime = 1000000.0 / samplingRate;
+  unsigned long i = 0;
+
+  while (i < frames) {
+    if (!playBlock)
+      playBlock = buffer->readBlock();
+
+    // underrun, the rest is silence and the schedule is found again
+    if (!playBlock || playBlock->reformatted != 1) {
+      playAligned = false;
+      break;
+    }
+
+    if (playBlock->pts > 0.0) {
+      // how late the next sample is, in microsecs
+      double error = outTime + i*frameTime - (playBlock->pts + playPos*frameTime);
+
+      if (playAligned && fabs(error) > AUDIO_RESYNC_LIMIT)
+        playAligned = false;
+
+      if (!playAligned) {
+        if (error < -frameTime) {
+          // early, wait for it
+          unsigned long wait = MIN(frames - i, (unsigned long)(-error / frameTime));
+          memset(out, 0, wait * channels * sizeof(float));
+          out += wait * channels;
+          i += wait;
+          continue;
+        }
+
+        if (error > 0.0) {
+          // late, skip what should have been played already
+          playPos += error / frameTime;
+          if (playPos >= framePerBuffer) {
+            playBlock->reformatted = 0;
+            buffer->updateReadIndex();
+            playBlock = NULL;
+            playPos = 0.0;
+            continue;
+          }
+        }
+
+        playAligned = true;
+        playRate = 1.0;
+      }
+      else if (i == 0) {
+        // small errors bend the rate, so no sample is dropped or repeated
+        double skew = MAX(-AUDIO_MAX_SKEW, MIN(AUDIO_MAX_SKEW, error / AUDIO_CORRECTION_TIME));
+        playRate += (1.0 + skew - playRate) * 0.1;
+      }
+    }
+    else {
+      playRate = 1.0;
+    }
+
+    // linear interpolation, the last frame of a block is held
+    float *samples = (float *)playBlock->buff;
+    while (i < frames && playPos < framePerBuffer) {
+      int idx = (int)playPos;
+      float frac = (float)(playPos - idx);
+      float *a = samples + idx*channels;
+      float *b = (idx+1 < framePerBuffer) ? a + channels : a;
+      for (int c=0; c<channels; c++)
+        *out++ = a[c] + frac*(b[c] - a[c]);
+      playPos += playRate;
+      i++;
+    }
+
+    if (playPos >= framePerBuffer) {
+      playPos -= framePerBuffer;
+      playBlock->reformatted = 0;
+      buffer->updateReadIndex();
+      playBlock = NULL;
+    }
+  }
+
+  if (i < frames)
+    memset(out, 0, (frames - i) * channels * sizeof(float));
+
+  return 0;
+}
+
 #ifdef linux1
 int sageAudio::recordFWCallback(iec61883_amdtp_t amdtp, char *data, int nsamples,
                                 unsigned int dbc, unsigned int dropped, void *callback_data)
@@ -788,6 +887,11 @@ int sageAudio::recordCallback( const void *inputBuffer, void *outputBuffer,
   block->reformatted = 1;
   block->timestamp = Pa_GetStreamTime(This->audioStream);
 
+  // stamp the samples with the time they entered the converter
+  block->pts = sageClock::instance().now();
+  if (timeInfo && timeInfo->inputBufferAdcTime > 0.0)
+    block->pts -= (timeInfo->currentTime - timeInfo->inputBufferAdcTime) * 1000000.0;
+
   // update writeIndex
   This->buffer->updateWriteIndex();
 
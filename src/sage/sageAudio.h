@@ -53,6 +53,16 @@
 #include "sageAudioCircBuf.h"
 #include "sageBase.h"
 
+// timestamped audio is played faster or slower by at most that much to
+// follow the cluster clock, which isn't audible
+#define AUDIO_MAX_SKEW 0.005
+
+// microsecs a schedule error is corrected in, until the skew saturates
+#define AUDIO_CORRECTION_TIME 2000000.0
+
+// errors larger than that are corrected by waiting or skipping samples
+#define AUDIO_RESYNC_LIMIT 100000.0
+
 class sageAudio {
 public:
   /** audio mode
@@ -169,6 +179,19 @@ protected:
   long minLatency;
   long maxLatency;
 
+  /** block being played and the position in it, in frames. Blocks are
+   * resampled at playRate input frames per output frame
+   */
+  audioBlock *playBlock;
+  double playPos;
+  double playRate;
+  bool playAligned; /**< the output is on the schedule of the blocks */
+
+  /** plays float samples, timestamped blocks are kept on the cluster clock.
+   * outTime is when the first frame of out reaches the speakers
+   */
+  int playScheduled(float *out, unsigned long frames, double outTime);
+
 };
 
 #endif
@@ -599,6 +599,8 @@ int sageAudioCircBuf::getAudioId()
 
 void sageAudioCircBuf::clearBlock(int frameNum)
 {
+  blockArray[frameNum].pts = 0.0;
+
   switch(sampleFmt) {
   case SAGE_SAMPLE_FLOAT32 :
     {
@@ -66,7 +66,12 @@ public:
   void* buff;
   double timestamp;
 
-  audioBlock(): frameIndex(-1), gframeIndex(-1), reformatted(0), buff(NULL), timestamp(0) {};
+  /** cluster clock in microsecs, when the samples were captured on the sender
+   * and when they are due on the receiver. 0 if the stream has no timestamps
+   */
+  double pts;
+
+  audioBlock(): frameIndex(-1), gframeIndex(-1), reformatted(0), buff(NULL), timestamp(0), pts(0.0) {};
   ~audioBlock() {};
 };
 
@@ -105,6 +105,7 @@ sageAudioManager::sageAudioManager(int argc, char **argv)
   sendMessage(REG_ARCV, argv[3]);
 
   rcvEnd = false;
+  avDelay = 0.0;
   receiverList.clear();
 
   eventQueue = new sageEventQueue;
@@ -160,6 +161,9 @@ int sageAudioManager::init(char *data)
     return -1;
   }
 
+  getToken(data, token);
+  avDelay = atoi(token)*1000.0;
+
   //audioOn = true;
 
   ///////////////////
@@ -403,6 +407,7 @@ int sageAudioManager::initStreams(char *msg, streamProtocol *nwObj)
       }
 
       sageAudioReceiver *recv = new sageAudioReceiver(msg, eventQueue, nwObj, buffer);
+      recv->setPlayoutDelay(avDelay);
       if(receiverList.size() == 0)
       {
         // set it as master receiver
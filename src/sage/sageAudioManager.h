@@ -80,6 +80,7 @@ private:
 
   int syncPort, streamPort;
   int totalRcvNum;
+  double avDelay; /**< microsecs from capture to playback of timestamped audio, 0 plays it as it comes */
   int memSize;
   bool rcvEnd;
 
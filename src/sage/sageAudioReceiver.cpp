@@ -170,6 +170,7 @@ int sageAudioReceiver::readData()
 
     if(resetFlag == true) {
       buffer->reset();
+      playout.reset();
       std::cout << "buffer is reset" << std::endl;
       resetFlag = false;
     }
@@ -195,6 +196,12 @@ int sageAudioReceiver::readData()
         char* tempbuff = audioNBlock.getAudioBuffer();
         buffer->convertToFloat(sampleFmt, tempbuff, block);
 
+        block->pts = 0.0;
+        if (playout.isOn() && audioNBlock.getPTS() > 0.0) {
+          playout.arrival(audioNBlock.getPTS(), sageClock::instance().now());
+          block->pts = playout.presentTime(audioNBlock.getPTS());
+        }
+
         block->frameIndex = audioNBlock.getgFrameID();
         if(masterFlag == true)
         {
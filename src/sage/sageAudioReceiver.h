@@ -43,6 +43,7 @@
 
 #include "sageReceiver.h"
 #include "sageBlock.h"
+#include "sageClock.h"
 
 class sageAudioCircBuf;
 class sageEventQueue;
@@ -76,6 +77,8 @@ protected:
   bool resetFlag;
   int  m_senderID;
 
+  sagePlayout playout; /**< schedules the blocks on the cluster clock */
+
 public:
   /**
    * starts sageReceiver::nwReadThread()<BR>
@@ -114,6 +117,12 @@ public:
   inline void resetBandWidth() { bandWidth = 0; }
   inline void resetFrame() { oldFrame = updateFrame; }
 
+  /**
+   * blocks are played delay microsecs after they were captured, in step
+   * with the frames of the app. 0 plays them as they come
+   */
+  inline void setPlayoutDelay(double delay) { playout.setDelay(delay); }
+
 };
 
 inline int sageAudioReceiver::getInstID()
@@ -40,10 +40,11 @@
 
 #include "sageStreamer.h"
 #include "streamInfo.h"
+#include "sageClock.h"
 
 using namespace std;
 sageAudioStreamer::sageAudioStreamer(streamerConfig &conf, int sampleSize, sageAudioCircBuf* buff) :
-  buffer(buff), bytesPerSample(sampleSize)
+  buffer(buff), bytesPerSample(sampleSize), nextPTS(0.0)
 {
   config = conf;
   config.protocol = config.audioProtocol;
@@ -203,6 +204,17 @@ int sageAudioStreamer::streamAudioData()
 
   aBlock.setgFrameID(bufferBlock->gframeIndex);
 
+  // blocks are stamped a block duration apart, the stamps of the writer only
+  // anchor the timeline, so receivers see the sender audio clock. A gap in
+  // the stream (pause, underrun) moves the anchor
+  aBlock.setPTS(0.0);
+  if (bufferBlock->pts > 0.0) {
+    if (nextPTS <= 0.0 || fabs(bufferBlock->pts - nextPTS) > CLOCK_STEP_LIMIT)
+      nextPTS = bufferBlock->pts;
+    aBlock.setPTS(nextPTS);
+    nextPTS += config.framePerBuffer * 1000000.0 / config.samplingRate;
+  }
+
   aBlock.updateBufferHeader();
 
   int cnt = 0;
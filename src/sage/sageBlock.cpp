@@ -39,6 +39,8 @@
  *****************************************************************************/
 
 #include "sageBlock.h"
+#include "sagePixelArena.h"
+#include <vector>
 
 void sagePixelData::operator=(sageRect &rect)
 {
@@ -68,15 +70,15 @@ int sagePixelData::initBuffer()
 int sagePixelData::releaseBuffer()
 {
   //std::cout << "release buffer" << std::endl;
-  if (buffer)
-    free((void *)buffer);
+  sagePixelArena::instance().release(buffer);
+  buffer = NULL;
 
   return 0;
 }
 
 int sagePixelData::allocateBuffer(int size)
 {
-  buffer = (char *)malloc(size);
+  buffer = sagePixelArena::instance().alloc(size);
   if (!buffer) {
     SAGE_PRINTLOG("sageBlock::allocateBuffer : fail to allocate %d bytes", size);
     return -1;
@@ -86,7 +88,8 @@ int sagePixelData::allocateBuffer(int size)
   return 0;
 }
 
-sagePixelBlock::sagePixelBlock(int size) : valid(false)
+sagePixelBlock::sagePixelBlock(int size) : valid(false), grp(NULL), srcAddr(NULL), plane(SAGE_PLANE_ALL),
+                                            payload(0)
 {
   flag = SAGE_PIXEL_BLOCK;
   allocateBuffer(size);
@@ -95,7 +98,8 @@ sagePixelBlock::sagePixelBlock(int size) : valid(false)
   pixelData = buffer + BLOCK_HEADER_SIZE;
 }
 
-sagePixelBlock::sagePixelBlock(sagePixelBlock &block)
+sagePixelBlock::sagePixelBlock(sagePixelBlock &block) : valid(false), grp(NULL), srcAddr(NULL),
+                                                         plane(SAGE_PLANE_ALL), payload(0)
 {
   allocateBuffer(block.bufSize);
   pixelData = buffer + BLOCK_HEADER_SIZE;
@@ -115,11 +119,11 @@ int sagePixelBlock::updateBufferHeader()
   int headerSize = 0;
 
 #if defined(WIN32)
-  headerSize = _snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d",
-                         bufSize, flag, x, y, width, height, frameID, blockID);
+  headerSize = _snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d %.0f %d %d",
+                         bufSize, flag, x, y, width, height, frameID, blockID, pts, plane, payload);
 #else
-  headerSize = snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d",
-                        bufSize, flag, x, y, width, height, frameID, blockID);
+  headerSize = snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d %.0f %d %d",
+                        bufSize, flag, x, y, width, height, frameID, blockID, pts, plane, payload);
 #endif
 
   if (headerSize >= BLOCK_HEADER_SIZE) {
@@ -139,8 +143,12 @@ bool sagePixelBlock::updateBlockConfig()
 
   //std::cout << "buf : " << buffer << std::endl;
 
-  sscanf(buffer, "%d %d %d %d %d %d %d %d", &bufSize, &flag, &x, &y, &width, &height,
-         &frameID, &blockID);
+  // senders older than the timestamps or the stereo planes don't send them
+  pts = 0.0;
+  plane = SAGE_PLANE_ALL;
+  payload = 0;
+  sscanf(buffer, "%d %d %d %d %d %d %d %d %lf %d %d", &bufSize, &flag, &x, &y, &width, &height,
+         &frameID, &blockID, &pts, &plane, &payload);
 
   return true;
 }
@@ -150,11 +158,250 @@ sagePixelBlock::~sagePixelBlock()
   releaseBuffer();
 }
 
+// the left eye pixel a right eye pixel is predicted from, clamped to the block
+static inline int eyeReference(int x, int disparity, int width)
+{
+  return 3*MIN(width-1, MAX(0, x + disparity));
+}
+
+// the disparity that predicts the right eye best, tried on every fourth row
+static int eyeDisparity(const char *left, const char *right, int width, int height)
+{
+  int best = 0;
+  long long bestCost = -1;
+
+  // 0, -1, 1, -2, 2... so that the smallest one wins ties
+  for (int d=0; d<=2*SAGE_EYE_MAX_DISPARITY; d++) {
+    int disparity = (d & 1) ? -(d+1)/2 : d/2;
+
+    long long cost = 0;
+    for (int y=0; y<height; y+=4) {
+      const signed char *l = (const signed char *)left + y*width*3;
+      const signed char *r = (const signed char *)right + y*width*3;
+      for (int x=0; x<width; x++, r+=3) {
+        const signed char *p = l + eyeReference(x, disparity, width);
+        cost += abs((signed char)(r[0] - p[0])) + abs((signed char)(r[1] - p[1])) +
+          abs((signed char)(r[2] - p[2]));
+      }
+    }
+
+    if (bestCost < 0 || cost < bestCost) {
+      best = disparity;
+      bestCost = cost;
+    }
+  }
+
+  return best;
+}
+
+// the code is the disparity byte followed by runs of differences, each
+// starting with a control byte c :
+//   c < 32         c+1 differences as they are
+//   32 <= c < 64   (c-31)*4 differences in -2..1, 2 bits each
+//   64 <= c < 128  (c-63)*2 differences in -8..7, 4 bits each
+//   c >= 128       c-126 zero differences
+#define RUN_LITERAL  0
+#define RUN_CRUMB    32
+#define RUN_NIBBLE   64
+#define RUN_ZERO     128
+
+static inline bool isCrumb(unsigned char d) { return (signed char)d >= -2 && (signed char)d <= 1; }
+static inline bool isNibble(unsigned char d) { return (signed char)d >= -8 && (signed char)d <= 7; }
+
+static int zeroRun(const unsigned char *d, int n)
+{
+  int i = 0;
+  while (i < n && i < 129 && d[i] == 0)
+    i++;
+  return i;
+}
+
+// differences that fit in bits, up to a zero run long enough to be cheaper
+static int packedRun(const unsigned char *d, int n, int bits)
+{
+  int i = 0, zeros = 0;
+  while (i < n && i < 128 && (bits == 2 ? isCrumb(d[i]) : isNibble(d[i]))) {
+    zeros = (d[i] == 0) ? zeros+1 : 0;
+    if (zeros >= 16)
+      return i+1 - zeros;
+    i++;
+  }
+  return i;
+}
+
+int sageEncodeEyeResidual(const char *left, const char *right, int width, int height,
+                          char *code, int maxBytes)
+{
+  if (maxBytes < 1 || width < 1 || height < 1)
+    return -1;
+
+  int disparity = eyeDisparity(left, right, width, height);
+
+  int n = width*height*3;
+  std::vector<unsigned char> diff(n);
+  unsigned char *d = &diff[0];
+  for (int y=0; y<height; y++) {
+    const unsigned char *l = (const unsigned char *)left + y*width*3;
+    const unsigned char *r = (const unsigned char *)right + y*width*3;
+    for (int x=0; x<width; x++, r+=3, d+=3) {
+      const unsigned char *p = l + eyeReference(x, disparity, width);
+      d[0] = r[0] - p[0];
+      d[1] = r[1] - p[1];
+      d[2] = r[2] - p[2];
+    }
+  }
+  d = &diff[0];
+
+  unsigned char *out = (unsigned char *)code;
+  int len = 0;
+  out[len++] = (unsigned char)(signed char)disparity;
+
+  int i = 0;
+  while (i < n) {
+    int zeros = zeroRun(d+i, n-i);
+    int crumbs = packedRun(d+i, n-i, 2);
+    int nibbles = packedRun(d+i, n-i, 4);
+    int run, bits = 0;
+    unsigned char ctrl;
+
+    if (zeros >= 8 || (zeros >= 2 && crumbs < 8 && nibbles < 4)) {
+      run = zeros;
+      ctrl = RUN_ZERO + run - 2;
+    }
+    else if (crumbs >= 8) {
+      run = crumbs/4*4;
+      ctrl = RUN_CRUMB + run/4 - 1;
+      bits = 2;
+    }
+    else if (nibbles >= 4) {
+      run = nibbles/2*2;
+      ctrl = RUN_NIBBLE + run/2 - 1;
+      bits = 4;
+    }
+    else {
+      // up to where another kind of run pays off
+      run = 1;
+      while (run < 32 && i+run < n) {
+        int rest = n - i - run;
+        if (zeroRun(d+i+run, MIN(rest, 2)) >= 2 || packedRun(d+i+run, MIN(rest, 8), 2) >= 8 ||
+            packedRun(d+i+run, MIN(rest, 4), 4) >= 4)
+          break;
+        run++;
+      }
+      ctrl = RUN_LITERAL + run - 1;
+    }
+
+    int bytes = (ctrl >= RUN_ZERO) ? 0 : (bits ? run*bits/8 : run);
+    if (len + 1 + bytes > maxBytes)
+      return -1;
+
+    out[len++] = ctrl;
+    if (bits) {
+      int perByte = 8/bits;
+      for (int j=0; j<run; j+=perByte) {
+        unsigned char b = 0;
+        for (int k=0; k<perByte; k++)
+          b |= (d[i+j+k] & ((1 << bits) - 1)) << (k*bits);
+        out[len++] = b;
+      }
+    }
+    else if (ctrl < RUN_ZERO) {
+      memcpy(out + len, d + i, run);
+      len += run;
+    }
+
+    i += run;
+  }
+
+  return len;
+}
+
+// hands out the differences of a code one at a time
+class residualReader {
+private:
+  const unsigned char *in, *end;
+  int ctrl, left, shift;
+  unsigned char packed;
+
+public:
+  residualReader(const unsigned char *code, int bytes) : in(code), end(code + bytes), ctrl(0), left(0),
+                                                          shift(8), packed(0) {}
+
+  inline bool done() { return in == end && left == 0; }
+
+  bool next(unsigned char &d)
+  {
+    if (left == 0) {
+      if (in >= end)
+        return false;
+      ctrl = *in++;
+      shift = 8;
+      if (ctrl >= RUN_ZERO)
+        left = ctrl - RUN_ZERO + 2;
+      else if (ctrl >= RUN_NIBBLE)
+        left = (ctrl - RUN_NIBBLE + 1)*2;
+      else if (ctrl >= RUN_CRUMB)
+        left = (ctrl - RUN_CRUMB + 1)*4;
+      else
+        left = ctrl - RUN_LITERAL + 1;
+    }
+    left--;
+
+    if (ctrl >= RUN_ZERO) {
+      d = 0;
+      return true;
+    }
+
+    int bits = (ctrl >= RUN_NIBBLE) ? 4 : (ctrl >= RUN_CRUMB) ? 2 : 8;
+    if (shift >= 8) {
+      if (in >= end)
+        return false;
+      packed = *in++;
+      shift = 0;
+    }
+
+    int v = (packed >> shift) & ((1 << bits) - 1);
+    shift += bits;
+    if (bits < 8 && v >= (1 << (bits-1)))
+      v -= 1 << bits;
+    d = (unsigned char)v;
+
+    return true;
+  }
+};
+
+bool sageDecodeEyeResidual(const char *code, int bytes, const char *left, int leftStride,
+                           char *right, int rightStride, int width, int height)
+{
+  if (bytes < 1)
+    return false;
+
+  int disparity = (signed char)code[0];
+  residualReader diff((const unsigned char *)code + 1, bytes - 1);
+
+  for (int y=0; y<height; y++) {
+    const unsigned char *l = (const unsigned char *)left + y*leftStride;
+    unsigned char *r = (unsigned char *)right + y*rightStride;
+
+    for (int x=0; x<width; x++, r+=3) {
+      const unsigned char *p = l + eyeReference(x, disparity, width);
+      for (int c=0; c<3; c++) {
+        unsigned char d;
+        if (!diff.next(d))
+          return false;
+        r[c] = (unsigned char)(p[c] + d);
+      }
+    }
+  }
+
+  return diff.done();
+}
+
 
 sageAudioBlock::sageAudioBlock() : frameID(0), gframeID(0),
                                    bytesPerSample(4), sampleFmt(SAGE_SAMPLE_FLOAT32),
                                    sampleRate(0), channels(0), framePerBuffer(0),
-                                   extraInfo(NULL), tileID(0), nodeID(0)
+                                   extraInfo(NULL), tileID(0), nodeID(0), pts(0.0)
 {
   flag = SAGE_AUDIO_BLOCK;
 }
@@ -163,7 +410,7 @@ sageAudioBlock::sageAudioBlock(int frame, sageSampleFmt type, int byte, int rate
   :                       frameID(frame), gframeID(0),
                           bytesPerSample(byte), sampleFmt(type),
                           sampleRate(rate), channels(chan), framePerBuffer(framesperbuffer),
-                          extraInfo(NULL), tileID(0), nodeID(0)
+                          extraInfo(NULL), tileID(0), nodeID(0), pts(0.0)
 {
   flag = SAGE_AUDIO_BLOCK;
   initBuffer();
@@ -238,11 +485,11 @@ int sageAudioBlock::updateBufferHeader()
 
 
 #if defined(WIN32)
-  headerSize = _snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d %d %d",
-                         bufSize, flag,(int)sampleFmt, sampleRate, channels, framePerBuffer, frameID, gframeID, tileID, nodeID);
+  headerSize = _snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d %d %d p%.0f",
+                         bufSize, flag,(int)sampleFmt, sampleRate, channels, framePerBuffer, frameID, gframeID, tileID, nodeID, pts);
 #else
-  headerSize = snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d %d %d",
-                        bufSize, flag, (int)sampleFmt, sampleRate, channels, framePerBuffer, frameID, gframeID, tileID, nodeID);
+  headerSize = snprintf(buffer, BLOCK_HEADER_SIZE, "%d %d %d %d %d %d %d %d %d %d p%.0f",
+                        bufSize, flag, (int)sampleFmt, sampleRate, channels, framePerBuffer, frameID, gframeID, tileID, nodeID, pts);
 #endif
 
   if (headerSize >= BLOCK_HEADER_SIZE) {
@@ -272,8 +519,15 @@ bool sageAudioBlock::updateBlockConfig()
   sscanf(buffer, "%d %d %d %d %d %d %d %d %d %d", &bufSize, &flag, &sampleFmt, &sampleRate,
          &channels, &framePerBuffer, &frameID,  &gframeID, &tileID, &nodeID);
 
-  //std::cout << buffer << std::endl;
+  // the timestamp is tagged, senders older than it may have extra info right here
+  pts = 0.0;
   extraInfo = sage::tokenSeek(buffer, 10);
+  if (extraInfo && extraInfo[0] == 'p') {
+    sscanf(extraInfo+1, "%lf", &pts);
+    extraInfo = sage::tokenSeek(buffer, 11);
+  }
+
+  //std::cout << buffer << std::endl;
   if (!extraInfo && flag == SAGE_AUDIO_BLOCK) {
     // SAGE_PRINTLOG("sageAudioBlock::updateBlockConfig : extraInfo is NULL");
   }
@@ -60,6 +60,21 @@
 #define SAGE_SKIP_BLOCK 105
 #define SAGE_CLEAR_BLOCK 106
 
+// eye planes of a PIXFMT_RGBS3D block. A stereo stream sent in planes
+// carries 3 bytes per pixel in each block, SAGE_PLANE_BOTH is a left eye
+// block that also is the right eye
+#define SAGE_PLANE_ALL    0
+#define SAGE_PLANE_LEFT   1
+#define SAGE_PLANE_RIGHT  2
+#define SAGE_PLANE_BOTH   3
+
+// a right eye block coded as its difference to the left eye of the block,
+// see sageEncodeEyeResidual(). The code is shorter than the block
+#define SAGE_PLANE_RESIDUAL 4
+
+// the right eye is predicted from the left eye shifted by up to this many pixels
+#define SAGE_EYE_MAX_DISPARITY 16
+
 /**
  * sageBLock
  */
@@ -98,6 +113,7 @@ class sagePixelData : public sageRect, public sageBlock {
 protected:
   char *pixelData; // starting address of image buffer
   int frameID;  // frame to which this block belongs
+  double pts;   // presentation timestamp of the frame, cluster clock in microsecs. 0 if none
   sagePixFmt pixelType;   // pixel format of block
   int bytesPerPixel;
   float compressX, compressY;
@@ -107,17 +123,23 @@ protected:
   int allocateBuffer(int size);
 
 public:
-  sagePixelData() : pixelData(NULL), frameID(0), pixelType(PIXFMT_888),
+  sagePixelData() : pixelData(NULL), frameID(0), pts(0.0), pixelType(PIXFMT_888),
                     bytesPerPixel(3), compressX(1.0), compressY(1.0) {}
 
   virtual int getFrameID() { return frameID; }
   void operator=(sageRect &rect);
   inline void setFrameID(int id) { frameID = id; }
+  inline double getPTS() { return pts; }
+  inline void setPTS(double t) { pts = t; }
   inline sagePixFmt getPixelType() { return pixelType; }
   inline void setPixelType(sagePixFmt type) { pixelType = type; }
   inline int getBytesPerPixel() { return bytesPerPixel; }
   inline void setBytesPerPixel(int byte) { bytesPerPixel = byte; }
   inline char *getPixelBuffer() { return pixelData; }
+
+  // let pixelData point to memory owned by the application (zero-copy)
+  inline void attachBuffer(char *data) { pixelData = data; }
+  inline void detachBuffer() { if (buffer) pixelData = buffer + BLOCK_HEADER_SIZE; }
 };
 
 class sageBlockGroup;
@@ -132,8 +154,18 @@ protected:
   bool valid;
   sageBlockGroup *grp;
 
+  // rows of the frame streamed in place instead of being copied into
+  // the block buffer. srcAddr is NULL if the block holds its own pixels
+  char *srcAddr;
+  int srcStride;    // bytes from one row to the next, negative for TOP_TO_BOTTOM
+  int srcRows;
+  int srcRowBytes;
+
+  int plane;        // SAGE_PLANE_ALL unless the stereo eyes are sent apart
+  int payload;      // bytes of pixel data sent, 0 for the whole block
+
 public:
-  sagePixelBlock() : valid(false), grp(NULL) {}
+  sagePixelBlock() : valid(false), grp(NULL), srcAddr(NULL), plane(SAGE_PLANE_ALL), payload(0) {}
   sagePixelBlock(int size);
   sagePixelBlock(sagePixelBlock& block);
   //sagePixelBlock(int w, int h, int bytes, float compX, float compY,
@@ -147,12 +179,40 @@ public:
   bool updateBlockConfig();
 
   inline bool isValid()    { return valid; }
+  inline int getPlane() { return plane; }
+  inline void setPlane(int p) { plane = p; }
+  inline int getPayloadSize() { return payload; }
+  inline void setPayloadSize(int bytes) { payload = bytes; }
+
+  inline void setSource(char *addr, int stride, int rows, int rowBytes)
+  { srcAddr = addr; srcStride = stride; srcRows = rows; srcRowBytes = rowBytes; }
+  inline void clearSource() { srcAddr = NULL; }
+  inline char *getSource() { return srcAddr; }
+  inline int getSourceStride() { return srcStride; }
+  inline int getSourceRows() { return srcRows; }
+  inline int getSourceRowBytes() { return srcRowBytes; }
 
   //void recalcBufSize();
 
   ~sagePixelBlock();
 };
 
+/**
+ * codes the right eye of a stereo block, 3 bytes per pixel, as its byte
+ * difference to the left eye shifted by the disparity that matches best,
+ * packed in runs of zeros and of 2 and 4 bit differences. Returns the
+ * length of the code, or -1 if it would be longer than maxBytes
+ */
+int sageEncodeEyeResidual(const char *left, const char *right, int width, int height,
+                          char *code, int maxBytes);
+
+/**
+ * rebuilds the right eye from the code and the left eye the receiver has.
+ * The strides are in bytes. Returns false if the code is damaged
+ */
+bool sageDecodeEyeResidual(const char *code, int bytes, const char *left, int leftStride,
+                           char *right, int rightStride, int width, int height);
+
 /**
  * sageAudioBlock
  */
@@ -171,6 +231,7 @@ protected:
   char *extraInfo;
   int tileID;
   int nodeID;
+  double pts;     // presentation timestamp, cluster clock in microsecs. 0 if none
 
   int releaseBuffer();
   int allocateBuffer(int size);
@@ -191,6 +252,8 @@ public:
   inline void setTileID(int id) { tileID = id; }
   inline int getNodeID() { return nodeID; }
   inline void setNodeID(int id) { nodeID = id; }
+  inline double getPTS() { return pts; }
+  inline void setPTS(double t) { pts = t; }
 
   virtual int getFrameID() { return frameID; }
   void operator=(sageAudioBlock &rect);
@@ -0,0 +1,213 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageBlockCopy.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageBlockCopy.h"
+#include "sageBlock.h"
+#include <vector>
+
+// SSE2 streaming stores are compiled with a function attribute and picked
+// at run time, like the kernels of sagePixelConvert
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define COPY_SSE2
+#include <emmintrin.h>
+#define SSE2_FN __attribute__((target("sse2")))
+#endif
+
+static int streamState = -1;   // -1 : CPU not probed yet
+
+static bool useStreaming()
+{
+#ifdef COPY_SSE2
+  if (streamState < 0) {
+    __builtin_cpu_init();
+    streamState = __builtin_cpu_supports("sse2") ? 1 : 0;
+  }
+  return streamState > 0;
+#else
+  return false;
+#endif
+}
+
+bool sageCopyStreaming(bool on)
+{
+  streamState = on ? -1 : 0;
+  return useStreaming();
+}
+
+bool sageBlockCopyOrder(const sageBlockCopy &a, const sageBlockCopy &b)
+{
+  if (a.target != b.target)
+    return a.target < b.target;
+  if (a.y != b.y)
+    return a.y < b.y;
+  return a.x < b.x;
+}
+
+#ifdef COPY_SSE2
+
+// the unaligned ends of dst are written with memcpy
+SSE2_FN static void streamBytes(char *dst, const char *src, int bytes)
+{
+  int head = (int)((16 - ((unsigned long)dst & 15)) & 15);
+  if (head > bytes)
+    head = bytes;
+  memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  bytes -= head;
+
+  while (bytes >= 64) {
+    __m128i a = _mm_loadu_si128((const __m128i *)src);
+    __m128i b = _mm_loadu_si128((const __m128i *)(src + 16));
+    __m128i c = _mm_loadu_si128((const __m128i *)(src + 32));
+    __m128i d = _mm_loadu_si128((const __m128i *)(src + 48));
+    _mm_stream_si128((__m128i *)dst, a);
+    _mm_stream_si128((__m128i *)(dst + 16), b);
+    _mm_stream_si128((__m128i *)(dst + 32), c);
+    _mm_stream_si128((__m128i *)(dst + 48), d);
+    dst += 64;
+    src += 64;
+    bytes -= 64;
+  }
+
+  while (bytes >= 16) {
+    _mm_stream_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+    dst += 16;
+    src += 16;
+    bytes -= 16;
+  }
+
+  memcpy(dst, src, bytes);
+}
+
+SSE2_FN static void streamFence()
+{
+  _mm_sfence();
+}
+
+#else
+
+static void streamBytes(char *dst, const char *src, int bytes)
+{
+  memcpy(dst, src, bytes);
+}
+
+static void streamFence()
+{
+}
+
+#endif
+
+void sageCopyRows(char *dst, int dstStride, const char *src, int rowBytes, int rows, bool stream)
+{
+  if (stream && useStreaming()) {
+    for (int i=0; i<rows; i++) {
+      streamBytes(dst, src, rowBytes);
+      dst += dstStride;
+      src += rowBytes;
+    }
+    streamFence();
+  }
+  else if (dstStride == rowBytes) {
+    memcpy(dst, src, rowBytes*rows);
+  }
+  else {
+    for (int i=0; i<rows; i++) {
+      memcpy(dst, src, rowBytes);
+      dst += dstStride;
+      src += rowBytes;
+    }
+  }
+}
+
+// row i of all the blocks of a run is written before row i+1. When streaming,
+// the row is gathered in line first so that the stores of two blocks never
+// share a partly written cache line
+static void copyRun(char *dst, sageBlockCopy *copies, const sageRowLayout *layouts, int num,
+                    char *line)
+{
+  int rows = layouts[0].rows;
+  int stride = layouts[0].stride;
+
+  for (int i=0; i<rows; i++) {
+    char *d = line ? line : dst;
+    for (int j=0; j<num; j++) {
+      const char *s = copies[j].block->getPixelBuffer() + i*layouts[j].rowBytes;
+      memcpy(d, s, layouts[j].rowBytes);
+      d += layouts[j].rowBytes;
+    }
+    if (line)
+      streamBytes(dst, line, (int)(d - line));
+    dst += stride;
+  }
+}
+
+void sageCopyBlocks(char *dst, sageBlockCopy *copies, const sageRowLayout *layouts, int num, bool stream)
+{
+  // a run never spans more than a texture row
+  std::vector<char> line;
+  if (stream && useStreaming()) {
+    int stride = 0;
+    for (int i=0; i<num; i++)
+      stride = MAX(stride, layouts[i].stride);
+    line.resize(stride);
+  }
+  char *buf = line.empty() ? NULL : &line[0];
+
+  int i = 0;
+  while (i < num) {
+    const sageRowLayout &first = layouts[i];
+    int end = first.offset + first.rowBytes;
+
+    int j = i+1;
+    while (j < num && copies[j].target == copies[i].target && copies[j].y == copies[i].y &&
+           layouts[j].offset == end && layouts[j].rows == first.rows &&
+           layouts[j].stride == first.stride) {
+      end += layouts[j].rowBytes;
+      j++;
+    }
+
+    copyRun(dst + first.offset, copies + i, layouts + i, j - i, buf);
+    i = j;
+  }
+
+  if (buf)
+    streamFence();
+}
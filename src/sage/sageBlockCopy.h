@@ -0,0 +1,91 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageBlockCopy.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_BLOCK_COPY_H
+#define SAGE_BLOCK_COPY_H
+
+#include "sageBase.h"
+
+class sagePixelBlock;
+
+// copies of at least that many bytes bypass the cache with streaming stores
+#define SAGE_STREAM_COPY_MIN (1024*1024)
+
+/**
+ * a pixel block on its way into a texture. x, y is where it goes in the
+ * texture and target tells which texture (the montage of a pixelDownloader)
+ */
+struct sageBlockCopy {
+  sagePixelBlock *block;
+  int x, y;
+  int target;
+};
+
+/** orders copies by target, then top to bottom and left to right */
+bool sageBlockCopyOrder(const sageBlockCopy &a, const sageBlockCopy &b);
+
+// where the rows of a block go in the CPU copy of a texture
+struct sageRowLayout {
+  int offset;     // of the first row
+  int rowBytes;
+  int rows;
+  int stride;     // bytes from one texture row to the next
+};
+
+/**
+ * copies rows rows of rowBytes bytes, packed one after another in src, to
+ * dst where the rows are dstStride bytes apart. With stream set, the rows
+ * are written with non-temporal stores if the CPU has them
+ */
+void sageCopyRows(char *dst, int dstStride, const char *src, int rowBytes, int rows, bool stream);
+
+/**
+ * copies num blocks, sorted with sageBlockCopyOrder, into dst as layouts
+ * tells. The blocks of a run whose rows follow one another in dst are
+ * copied row by row across the run, so dst is filled front to back
+ */
+void sageCopyBlocks(char *dst, sageBlockCopy *copies, const sageRowLayout *layouts, int num, bool stream);
+
+/**
+ * enables or disables the streaming stores, which are used by default when
+ * the CPU has them. Returns true if they are in use afterwards
+ */
+bool sageCopyStreaming(bool on);
+
+#endif
@@ -0,0 +1,202 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageBlockCopyBench.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+/*
+ * Times the copy of a frame of pixel blocks into the CPU copy of a texture
+ * the way the SDM does it, on one core : blocks one at a time in the order
+ * they arrive, sorted with the side by side ones merged (sageCopyBlocks),
+ * and sorted and merged with streaming stores. Checks that all give the
+ * same texture.
+ *
+ *   sageBlockCopyBench [width height [blockX blockY [iterations]]]
+ */
+
+#include "sageBlockCopy.h"
+#include "sageBlock.h"
+#include "misc.h"
+#include <algorithm>
+#include <vector>
+
+struct copyFormat {
+  const char *name;
+  int tile;        // pixels per side of a compressed tile, 1 if none
+  int tileBytes;
+};
+
+static const copyFormat formats[] = {
+  { "RGB",  1, 3 },
+  { "RGBA", 1, 4 },
+  { "YUV",  1, 2 },
+  { "DXT1", 4, 8 },
+  { "DXT5", 4, 16 }
+};
+
+// the layout of sageTexture::blockRows() for the format
+static void blockRows(const copyFormat &f, int texWidth, sageBlockCopy &c, sageRowLayout &l)
+{
+  int t = f.tile;
+  l.rowBytes = (c.block->width + t - 1)/t * f.tileBytes;
+  l.stride = (texWidth + t - 1)/t * f.tileBytes;
+  l.rows = c.block->height/t;
+  l.offset = c.y/t*l.stride + c.x/t*f.tileBytes;
+}
+
+// GB/s of num copies done iterations times
+static double timeCopies(int method, char *tex, sageBlockCopy *copies, sageRowLayout *layouts,
+                         int num, double bytes, int iterations)
+{
+  sageTimer timer;
+  for (int n=0; n<iterations; n++) {
+    if (method == 0) {
+      for (int i=0; i<num; i++)
+        sageCopyRows(tex + layouts[i].offset, layouts[i].stride, copies[i].block->getPixelBuffer(),
+                     layouts[i].rowBytes, layouts[i].rows, false);
+    }
+    else
+      sageCopyBlocks(tex, copies, layouts, num, method == 2);
+  }
+
+  return bytes*iterations / (timer.getTimeUS() * 1000.0);
+}
+
+int main(int argc, char **argv)
+{
+  int w = 3840, h = 2160, blockX = 64, blockY = 64, iterations = 50;
+
+  if (argc >= 3) {
+    w = atoi(argv[1]);
+    h = atoi(argv[2]);
+  }
+  if (argc >= 5) {
+    blockX = atoi(argv[3]);
+    blockY = atoi(argv[4]);
+  }
+  if (argc >= 6)
+    iterations = atoi(argv[5]);
+
+  // DXT tiles are 4x4 pixels
+  w = w/4*4;
+  h = h/4*4;
+  blockX = blockX/4*4;
+  blockY = blockY/4*4;
+  if (w <= 0 || h <= 0 || blockX <= 0 || blockY <= 0 || iterations <= 0) {
+    fprintf(stderr, "usage: %s [width height [blockX blockY [iterations]]]\n", argv[0]);
+    return -1;
+  }
+
+  bool hasStreaming = sageCopyStreaming(true);
+  printf("%dx%d texture, %dx%d blocks, %d iterations, one core, streaming stores %s\n\n",
+         w, h, blockX, blockY, iterations, hasStreaming ? "available" : "not available");
+  printf("%-6s %10s %14s %14s %14s\n", "format", "frame MB", "arrival GB/s", "merged GB/s", "stream GB/s");
+
+  // the blocks of a frame, cropped at the right and top edge
+  std::vector<sageBlockCopy> copies;
+  for (int y=0; y<h; y+=blockY) {
+    for (int x=0; x<w; x+=blockX) {
+      sagePixelBlock *block = new sagePixelBlock(BLOCK_HEADER_SIZE + blockX*blockY*4);
+      block->x = block->y = 0;
+      block->width = MIN(blockX, w-x);
+      block->height = MIN(blockY, h-y);
+
+      sageBlockCopy c;
+      c.block = block;
+      c.x = x;
+      c.y = y;
+      c.target = 0;
+      copies.push_back(c);
+    }
+  }
+
+  srand(1);
+  for (int i=0; i<(int)copies.size(); i++) {
+    char *pixels = copies[i].block->getPixelBuffer();
+    for (int j=0; j<blockX*blockY*4; j++)
+      pixels[j] = rand() & 0xff;
+  }
+
+  // blocks of a frame arrive in no particular order
+  std::vector<sageBlockCopy> arrival(copies);
+  for (int i=(int)arrival.size()-1; i>0; i--)
+    std::swap(arrival[i], arrival[rand() % (i+1)]);
+  std::vector<sageBlockCopy> sorted(arrival);
+  std::sort(sorted.begin(), sorted.end(), sageBlockCopyOrder);
+
+  int num = (int)copies.size();
+  std::vector<sageRowLayout> arrivalRows(num), sortedRows(num);
+  int failed = 0;
+
+  for (int f=0; f<(int)(sizeof(formats)/sizeof(formats[0])); f++) {
+    const copyFormat &fmt = formats[f];
+
+    double bytes = 0.0;
+    for (int i=0; i<num; i++) {
+      blockRows(fmt, w, arrival[i], arrivalRows[i]);
+      blockRows(fmt, w, sorted[i], sortedRows[i]);
+      bytes += (double)arrivalRows[i].rowBytes * arrivalRows[i].rows;
+    }
+
+    int texSize = h/fmt.tile * arrivalRows[0].stride;
+    char *ref = new char[texSize];
+    char *tex = new char[texSize];
+
+    double gbs[3];
+    for (int m=0; m<3; m++) {
+      char *dst = (m == 0) ? ref : tex;
+      memset(dst, 0, texSize);
+      sageBlockCopy *c = (m == 0) ? &arrival[0] : &sorted[0];
+      sageRowLayout *l = (m == 0) ? &arrivalRows[0] : &sortedRows[0];
+      gbs[m] = timeCopies(m, dst, c, l, num, bytes, iterations);
+
+      if (m > 0 && memcmp(ref, tex, texSize) != 0) {
+        printf("%-6s %s copy differs\n", fmt.name, m == 1 ? "merged" : "stream");
+        failed++;
+      }
+    }
+
+    printf("%-6s %10.1f %14.2f %14.2f %14.2f\n", fmt.name, bytes/1048576.0, gbs[0], gbs[1], gbs[2]);
+
+    delete [] ref;
+    delete [] tex;
+  }
+
+  for (int i=0; i<num; i++)
+    delete copies[i].block;
+
+  return failed ? -1 : 0;
+}
@@ -40,13 +40,22 @@
 
 #include "sageBlockPool.h"
 #include "sageBlock.h"
+#include <limits.h>
+
+// writev() rejects more iovecs than this in a single call
+#if defined(IOV_MAX)
+#define SAGE_IOV_MAX IOV_MAX
+#else
+#define SAGE_IOV_MAX 1024
+#endif
 
 const int sageBlockGroup::PIXEL_DATA    = 1;
 const int sageBlockGroup::CONFIG_UPDATE = 2;
 const int sageBlockGroup::END_FRAME     = 3;
 
 sageBlockGroup::sageBlockGroup(int blkSize, int grpSize, char opt) : frameSize(0),
-                                                                     flag(sageBlockGroup::PIXEL_DATA), blockNum(0), frameID(0), refCnt(0), deRefCnt(0)
+                                                                     flag(sageBlockGroup::PIXEL_DATA), blockNum(0), frameID(0), refCnt(0), deRefCnt(0),
+                                                                     iovNum(0), iovCap(0), packedSize(0), packBuf(NULL), packCap(0)
 {
   blockSize = blkSize;
   int bufLen = grpSize / blkSize; // # of blocks in this group
@@ -85,6 +94,7 @@ sageBlockGroup::sageBlockGroup(int blkSize, int grpSize, char opt) : frameSize(0
 #else
     iovs = new struct iovec[bufLen+1];
 #endif
+    iovCap = bufLen+1;
     if (memAlloc)
       genIOV();
   }
@@ -230,6 +240,49 @@ bool sageBlockGroup::setRefCnt()
   return true;
 }
 
+bool sageBlockGroup::reserveIOV(int num)
+{
+  if (num <= iovCap)
+    return true;
+
+#ifdef WIN32
+  WSABUF *newIovs = new WSABUF[num];
+#else
+  struct iovec *newIovs = new struct iovec[num];
+#endif
+  if (!newIovs) {
+    SAGE_PRINTLOG("sageBlockGroup::reserveIOV : fail to allocate %d iovecs", num);
+    return false;
+  }
+
+  if (iovs)
+    delete [] iovs;
+  iovs = newIovs;
+  iovCap = num;
+
+  return true;
+}
+
+void sageBlockGroup::setIOV(int idx, char *base, int len)
+{
+#ifdef WIN32
+  iovs[idx].buf = base;
+  iovs[idx].len = len;
+#else
+  iovs[idx].iov_base = base;
+  iovs[idx].iov_len = len;
+#endif
+}
+
+int sageBlockGroup::getIOVLen(int idx)
+{
+#ifdef WIN32
+  return (int)iovs[idx].len;
+#else
+  return (int)iovs[idx].iov_len;
+#endif
+}
+
 bool sageBlockGroup::genIOV()
 {
   if (!buf) {
@@ -242,25 +295,71 @@ bool sageBlockGroup::genIOV()
     return false;
   }
 
-#ifdef WIN32
-  iovs[0].buf = header;
-  iovs[0].len = GROUP_HEADER_SIZE;
-#else
-  iovs[0].iov_base = header;
-  iovs[0].iov_len = GROUP_HEADER_SIZE;
-#endif
   blockNum = buf->getEntryNum();
+
+  // count the iovecs first, blocks sent in place need one per row
+  int num = 1;
   for (int i=0; i<blockNum; i++) {
     sagePixelBlock *block = (sagePixelBlock *)(*buf)[i];
-#ifdef WIN32
-    iovs[i+1].buf = block->getBuffer();
-    iovs[i+1].len = blockSize;
-#else
-    iovs[i+1].iov_base = block->getBuffer();
-    iovs[i+1].iov_len = blockSize;
-#endif
+    if (!block->getSource())
+      num++;
+    else if (block->getSourceStride() == block->getSourceRowBytes())
+      num += 3;
+    else
+      num += block->getSourceRows() + 2;
   }
 
+  if (!reserveIOV(num))
+    return false;
+
+  setIOV(0, header, GROUP_HEADER_SIZE);
+  iovNum = 1;
+
+  packedSize = 0;
+  bool packed = false;
+
+  for (int i=0; i<blockNum; i++) {
+    sagePixelBlock *block = (sagePixelBlock *)(*buf)[i];
+    char *src = block->getSource();
+
+    if (!src) {
+      int len = blockSize;
+      if (block->getPayloadSize() > 0 && BLOCK_HEADER_SIZE + block->getPayloadSize() < blockSize) {
+        len = BLOCK_HEADER_SIZE + block->getPayloadSize();
+        packed = true;
+      }
+      setIOV(iovNum++, block->getBuffer(), len);
+      packedSize += len;
+      continue;
+    }
+
+    packedSize += blockSize;
+
+    int rows = block->getSourceRows();
+    int rowBytes = block->getSourceRowBytes();
+    int stride = block->getSourceStride();
+
+    setIOV(iovNum++, block->getBuffer(), BLOCK_HEADER_SIZE);
+
+    if (stride == rowBytes) {
+      // rows are contiguous in the frame
+      setIOV(iovNum++, src, rows*rowBytes);
+    }
+    else {
+      for (int j=0; j<rows; j++) {
+        setIOV(iovNum++, src, rowBytes);
+        src += stride;
+      }
+    }
+
+    int padding = blockSize - BLOCK_HEADER_SIZE - rows*rowBytes;
+    if (padding > 0)
+      setIOV(iovNum++, block->getPixelBuffer() + rows*rowBytes, padding);
+  }
+
+  if (!packed)
+    packedSize = 0;
+
   return true;
 }
 
@@ -272,43 +371,50 @@ int sageBlockGroup::sendData(int sockFd)
   }
 
   int sendSize = 0;
-  sprintf(header, "%d %d %d", blockNum, frameID, configID);
+  if (packedSize > 0)
+    sprintf(header, "%d %d %d %d", blockNum, frameID, configID, packedSize);
+  else
+    sprintf(header, "%d %d %d", blockNum, frameID, configID);
 
   //SAGE_PRINTLOG("send %s", header);
   //for (int i=1; i<=blockNum; i++)
   //   SAGE_PRINTLOG("header %s", (char *)iovs[i].iov_base);
 
-  int writtenBlocks = 0, bOffset = 0;
-  int iovNum = blockNum+1;
+  // iovecs may have any length, so partial writes are resumed
+  // from the first iovec which hasn't been written completely
+  int writtenIovs = 0, bOffset = 0;
 
-  while (writtenBlocks < iovNum) {
+  while (writtenIovs < iovNum) {
     int writtenSize = 0;
+    int cnt = iovNum - writtenIovs;
+    if (cnt > SAGE_IOV_MAX)
+      cnt = SAGE_IOV_MAX;
 
 #ifdef WIN32
     if (bOffset > 0) {
-      iovs[writtenBlocks].buf = (char *)(iovs[writtenBlocks].buf) + bOffset;
-      iovs[writtenBlocks].len -= bOffset;
+      iovs[writtenIovs].buf = (char *)(iovs[writtenIovs].buf) + bOffset;
+      iovs[writtenIovs].len -= bOffset;
     }
 
     DWORD WSAFlags = 0;
-    ::WSASend(sockFd, iovs+writtenBlocks, iovNum-writtenBlocks, (DWORD*)&writtenSize,
+    ::WSASend(sockFd, iovs+writtenIovs, cnt, (DWORD*)&writtenSize,
               WSAFlags, NULL, NULL);
 
     if (bOffset > 0) {
-      iovs[writtenBlocks].buf = (char *)(iovs[writtenBlocks].buf) - bOffset;
-      iovs[writtenBlocks].len += bOffset;
+      iovs[writtenIovs].buf = (char *)(iovs[writtenIovs].buf) - bOffset;
+      iovs[writtenIovs].len += bOffset;
     }
 #else
     if (bOffset > 0) {
-      iovs[writtenBlocks].iov_base = (char *)(iovs[writtenBlocks].iov_base) + bOffset;
-      iovs[writtenBlocks].iov_len -= bOffset;
+      iovs[writtenIovs].iov_base = (char *)(iovs[writtenIovs].iov_base) + bOffset;
+      iovs[writtenIovs].iov_len -= bOffset;
     }
 
-    writtenSize = ::writev(sockFd, iovs+writtenBlocks, iovNum-writtenBlocks);
+    writtenSize = ::writev(sockFd, iovs+writtenIovs, cnt);
 
     if (bOffset > 0) {
-      iovs[writtenBlocks].iov_base = (char *)(iovs[writtenBlocks].iov_base) - bOffset;
-      iovs[writtenBlocks].iov_len += bOffset;
+      iovs[writtenIovs].iov_base = (char *)(iovs[writtenIovs].iov_base) - bOffset;
+      iovs[writtenIovs].iov_len += bOffset;
     }
 #endif
 
@@ -316,15 +422,14 @@ int sageBlockGroup::sendData(int sockFd)
       return -1;
 
     sendSize += writtenSize;
-    bOffset = (sendSize-GROUP_HEADER_SIZE)%blockSize;
-    if (sendSize < GROUP_HEADER_SIZE) {
-      writtenBlocks = 0;
-      bOffset = sendSize;
+
+    bOffset += writtenSize;
+    while (writtenIovs < iovNum && bOffset >= getIOVLen(writtenIovs)) {
+      bOffset -= getIOVLen(writtenIovs);
+      writtenIovs++;
     }
-    else
-      writtenBlocks = 1 + (sendSize-GROUP_HEADER_SIZE)/blockSize;
 
-    //SAGE_PRINTLOG("written blocks %d", writtenBlocks);
+    //SAGE_PRINTLOG("written iovecs %d", writtenIovs);
   }
 
   return sendSize;
@@ -339,11 +444,15 @@ int sageBlockGroup::readData(int sockFd)
 
   int headerSize = 0, recvSize = 0;
   headerSize = sage::recv(sockFd, (void *)header, GROUP_HEADER_SIZE, MSG_PEEK);
+  packedSize = 0;
   if (headerSize > 0)
-    sscanf(header, "%d %d %d", &blockNum, &frameID, &configID);
+    sscanf(header, "%d %d %d %d", &blockNum, &frameID, &configID, &packedSize);
   else
     return -1;
 
+  if (packedSize > 0)
+    return readPacked(sockFd);
+
   //SAGE_PRINTLOG("iov num %d", blockNum+1);
   //for (int i=0; i<blockNum+1; i++)
   //  SAGE_PRINTLOG("iov size %s", iovs[i].iov_len);
@@ -404,6 +513,60 @@ int sageBlockGroup::readData(int sockFd)
   return recvSize;
 }
 
+int sageBlockGroup::readPacked(int sockFd)
+{
+  if (blockNum > buf->size() || packedSize > blockNum*blockSize) {
+    SAGE_PRINTLOG("sageBlockGroup::readPacked : %d blocks of %d bytes don't fit in the group", blockNum, packedSize);
+    return -1;
+  }
+
+  int total = GROUP_HEADER_SIZE + packedSize;
+  if (packCap < total) {
+    delete [] packBuf;
+    packBuf = new char[total];
+    packCap = total;
+  }
+
+  int recvSize = 0;
+  while (recvSize < total) {
+    int readSize = ::recv(sockFd, packBuf + recvSize, total - recvSize, 0);
+    if (readSize <= 0) {
+      SAGE_PRINTLOG("sageBlockGroup::readPacked : error in reading a packed group");
+      return -1;
+    }
+    recvSize += readSize;
+  }
+
+  // each block is its header and as many pixel bytes as the header says
+  char *data = packBuf + GROUP_HEADER_SIZE;
+  char *end = packBuf + total;
+
+  for (int i=0; i<blockNum; i++) {
+    sagePixelBlock *block = (sagePixelBlock *)(*buf)[i];
+    if (end - data < BLOCK_HEADER_SIZE) {
+      SAGE_PRINTLOG("sageBlockGroup::readPacked : the group is shorter than its blocks");
+      return -1;
+    }
+
+    memcpy(block->getBuffer(), data, BLOCK_HEADER_SIZE);
+    block->updateBlockConfig();
+    data += BLOCK_HEADER_SIZE;
+
+    int len = blockSize - BLOCK_HEADER_SIZE;
+    if (block->getPayloadSize() > 0)
+      len = block->getPayloadSize();
+    if (len > blockSize - BLOCK_HEADER_SIZE || end - data < len) {
+      SAGE_PRINTLOG("sageBlockGroup::readPacked : the group is shorter than its blocks");
+      return -1;
+    }
+
+    memcpy(block->getPixelBuffer(), data, len);
+    data += len;
+  }
+
+  return recvSize;
+}
+
 int sageBlockGroup::sendDatagram(int sockFd)
 {
   if (!iovs) {
@@ -412,9 +575,10 @@ int sageBlockGroup::sendDatagram(int sockFd)
   }
 
   int sendSize = 0;
-  sprintf(header, "%d %d %d", blockNum, frameID, configID);
-
-  int iovNum = blockNum+1;
+  if (packedSize > 0)
+    sprintf(header, "%d %d %d %d", blockNum, frameID, configID, packedSize);
+  else
+    sprintf(header, "%d %d %d", blockNum, frameID, configID);
 
 #ifdef WIN32
   DWORD WSAFlags = 0;
@@ -538,10 +702,14 @@ sageBlockGroup::~sageBlockGroup()
 
   if (iovs)
     delete [] iovs;
+
+  if (packBuf)
+    delete [] packBuf;
 }
 
 sageBlockBuf::sageBlockBuf(int bufSize, int grpSize, int blkSize, char opt) :
-  waitingData(false), frameInterval(100000), firstGroup(true)
+  waitingData(false), blockingRead(true), frameInterval(100000), bufferSize(bufSize),
+  groupSize(grpSize), blockSize(blkSize), groupNum(0), firstGroup(true)
 {
   if (bufSize <= 0 || grpSize <= 0 || blkSize <= 0) {
     SAGE_PRINTLOG("sageBlockBuf::sageBlockBuf : error in buffer parameter");
@@ -553,6 +721,7 @@ sageBlockBuf::sageBlockBuf(int bufSize, int grpSize, int blkSize, char opt) :
   int blockNum = grpSize / blkSize; // number of blocks in a blockGroup
 
   int bufLen = bufSize / (blockNum * blkSize); // number of blockGroups in a bufSize
+  groupNum = bufLen;
 
   int bScale = 1;
 
@@ -580,6 +749,7 @@ sageBlockBuf::sageBlockBuf(int bufSize, int grpSize, int blkSize, char opt) :
     }
     else {
       buf = new sageCircBufSingle(bufLen*bScale, false);
+      blockingRead = false;
       waitingData = true;
     }
   }
@@ -658,12 +828,10 @@ int sageBlockBuf::findNextFrame(int id)
   sageBlockGroup *sbg = NULL;
 
   while (loop) {
+    // blocks until data arrives, NULL if the reader is gone
     sbg = front(id);
-
-    while(!sbg) {
-      next(id);
-      sbg = front(id);
-    }
+    if (!sbg)
+      return -1;
 
     if (sbg->getFlag() == sageBlockGroup::END_FRAME )
       loop = false;
@@ -713,6 +881,40 @@ int sageBlockBuf::addReader(streamerConfig &config, int frameID)
   return startFrame;
 }
 
+int sageBlockBuf::skipToNewestFrame(int id)
+{
+  if (!multiReader)
+    return 0;
+
+  sageCircBufMulti *mBuf = (sageCircBufMulti *)buf;
+  int num = mBuf->unread(id);
+
+  // the newest complete frame starts after the last but one END_FRAME
+  int lastEnd = -1, prevEnd = -1, endNum = 0;
+  for (int i=0; i<num; i++) {
+    sageBlockGroup *sbg = (sageBlockGroup *)mBuf->peek(id, i);
+    if (sbg && sbg->getFlag() == sageBlockGroup::END_FRAME) {
+      prevEnd = lastEnd;
+      lastEnd = i;
+      endNum++;
+    }
+  }
+
+  if (prevEnd < 0)
+    return 0;
+
+  // an END_FRAME right in front belongs to the frame sent last
+  sageBlockGroup *first = (sageBlockGroup *)mBuf->peek(id, 0);
+  int skipped = endNum - 1;
+  if (first && first->getFlag() == sageBlockGroup::END_FRAME)
+    skipped--;
+
+  for (int i=0; i<=prevEnd; i++)
+    next(id);
+
+  return skipped;
+}
+
 sageBlockGroup* sageBlockBuf::front(int id, int minFrame)
 {
   sageBlockGroup *sbg = NULL;
@@ -724,7 +926,13 @@ sageBlockGroup* sageBlockBuf::front(int id, int minFrame)
       return NULL;
 
     if (sbg && sbg->getFlag() == sageBlockGroup::PIXEL_DATA && sbg->getFrameID() < minFrame) {
-      while(findNextFrame(id) < minFrame);
+      int nextFrame;
+      do {
+        nextFrame = findNextFrame(id);
+      } while (nextFrame >= 0 && nextFrame < minFrame);
+
+      if (nextFrame < 0)
+        return NULL;
       sbg = (sageBlockGroup *)mBuf->front(id);
     }
   }
@@ -882,6 +1090,68 @@ void sageBlockBuf::releaseLock()
     ctrlPool->releaseLock();
 }
 
+bool sageBlockBuf::recycle()
+{
+  if (multiReader || !buf || !dataPool)
+    return false;
+
+  std::vector<sageBlockGroup *> dataGrps, ctrlGrps;
+
+  // consumed entries are NULL, whatever is left is owned by the buffer
+  for (int i=0; i<buf->size(); i++) {
+    sageBlockGroup *sbg = (sageBlockGroup *)(*buf)[i];
+    if (!sbg)
+      continue;
+    if (sbg->getFlag() == sageBlockGroup::PIXEL_DATA)
+      dataGrps.push_back(sbg);
+    else
+      ctrlGrps.push_back(sbg);
+  }
+
+  for (int i=0; i<dataPool->size(); i++) {
+    sageBlockGroup *sbg = (sageBlockGroup *)(*dataPool)[i];
+    if (sbg)
+      dataGrps.push_back(sbg);
+  }
+
+  if (ctrlPool) {
+    for (int i=0; i<ctrlPool->size(); i++) {
+      sageBlockGroup *sbg = (sageBlockGroup *)(*ctrlPool)[i];
+      if (sbg)
+        ctrlGrps.push_back(sbg);
+    }
+  }
+
+  buf->clearEntries();
+  dataPool->clearEntries();
+  ((sageCircBufSingle *)buf)->reactivate(blockingRead);
+  dataPool->reactivate(true);
+  if (ctrlPool) {
+    ctrlPool->clearEntries();
+    ctrlPool->reactivate(true);
+  }
+
+  for (int i=0; i<dataGrps.size(); i++)
+    dataPool->pushBack((sageBufEntry)dataGrps[i]);
+  for (int i=0; i<ctrlGrps.size(); i++) {
+    if (ctrlPool)
+      ctrlPool->pushBack((sageBufEntry)ctrlGrps[i]);
+    else
+      delete ctrlGrps[i];
+  }
+
+  waitingData = !blockingRead;
+  frameInterval = 100000;
+  frameCounter.reset();
+  firstGroup = true;
+
+  // a receiver that stopped in the middle of a group keeps it
+  if (dataGrps.size() != groupNum || (ctrlPool && ctrlGrps.size() != groupNum))
+    return false;
+
+  return true;
+}
+
 bool sageBlockBuf::clear(sageBuf *groupBuf)
 {
   if (groupBuf) {
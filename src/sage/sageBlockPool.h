@@ -98,14 +98,29 @@ protected:
 #else
   struct iovec *iovs;
 #endif
+  int iovNum; /**< number of iovecs set up by genIOV() */
+  int iovCap; /**< number of iovecs allocated */
+
+  // blocks with a payload shorter than the block (see
+  // sagePixelBlock::setPayloadSize) are sent back to back, and the group
+  // header gives their bytes
+  int packedSize; /**< bytes of the blocks of a packed group, 0 if not packed */
+  char *packBuf;  /**< a packed group is read into this and moved into the blocks */
+  int packCap;
+
+  int readPacked(int sockFd);
+
+  bool reserveIOV(int num);
+  void setIOV(int idx, char *base, int len);
+  int  getIOVLen(int idx);
 
 public:
   static const int PIXEL_DATA;
   static const int CONFIG_UPDATE;
   static const int END_FRAME;
 
-  sageBlockGroup() : buf(NULL), iovs(NULL), frameID(0), flag(sageBlockGroup::END_FRAME),
-                     blockNum(0), refCnt(0), deRefCnt(0), frameSize(0) {}
+  sageBlockGroup() : buf(NULL), iovs(NULL), iovNum(0), iovCap(0), packedSize(0), packBuf(NULL), packCap(0),
+                     frameID(0), flag(sageBlockGroup::END_FRAME), blockNum(0), refCnt(0), deRefCnt(0), frameSize(0) {}
   sageBlockGroup(int blkSize, int grpSize, char opt);
   bool pushBack(sagePixelBlock* block);
   sagePixelBlock* front();
@@ -138,6 +153,12 @@ public:
   void clearHeaders();
   void clearBuffers();
   bool updateConfig();
+  /**
+   * builds the iovecs for the group header and the blocks. Blocks extracted
+   * in place (see sageBlockFrame::extractPixelBlock) are sent as their header,
+   * the rows in the frame and the padding up to the block size, so the data
+   * on the wire is the same as for copied blocks.
+   */
   bool genIOV();
   bool setRefCnt();
 
@@ -168,7 +189,10 @@ protected:
   sageCircBufSingle *ctrlPool;
   bool waitingData;
   bool multiReader;
+  bool blockingRead;
   double frameInterval;
+  int bufferSize, groupSize, blockSize;
+  int groupNum; /**< number of data (and control) groups the buffer owns */
 
   sageTimer frameTimer;
   sageCounter frameCounter;
@@ -193,14 +217,35 @@ public:
 
   bool isFull() { return false; }
   void getBufInfo(char *bufStatus);
+  inline int getStatus() { return buf->getStatus(); }
 
   inline bool isWaitingData() { return waitingData; }
 
+  /**
+   * moves reader id to the newest complete frame if more than one complete
+   * frame is waiting for it, so that a slow reader doesn't hold the buffer
+   * (and the other readers) back. Returns the number of frames skipped
+   */
+  int skipToNewestFrame(int id);
+
   int addReader(streamerConfig &con, int tbn);
   inline void removeReader(int id) { ((sageCircBufMulti *)buf)->removeReader(id); }
   bool clear(sageBuf *groupBuf);
   void releaseLock();
 
+  /**
+   * puts every block group back into its pool and undoes releaseLock(), so
+   * the buffer can be handed to the next application. Only for single reader
+   * buffers whose writer and reader are gone. Returns false if groups are
+   * missing, the buffer should be deleted then
+   */
+  bool recycle();
+
+  inline int getBufSize()   { return bufferSize; }
+  inline int getGroupSize() { return groupSize; }
+  inline int getBlockSize() { return blockSize; }
+  inline int getGroupNum()  { return groupNum; }
+
   double getFrameInterval() { return frameInterval; }
 
   ~sageBlockBuf();
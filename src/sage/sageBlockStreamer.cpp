@@ -43,9 +43,26 @@
 //#include "streamInfo.h"
 #include "sageBlockPartition.h"
 #include "sageBlockPool.h"
+#include "sageTelemetry.h"
+#include "sageTrace.h"
+#include "sageAffinity.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telFrames = telemetry.counter("sage_sail_frames_total", "frames streamed by the app");
+static int telBytes = telemetry.counter("sage_sail_bytes_total", "bytes streamed by the app");
+static int telWait = telemetry.histogram("sage_sail_frame_wait_us", "time the streamer waits for the app to render a frame, in microsecs");
+static int telSyncWait = telemetry.histogram("sage_sail_sync_wait_us", "time the nodes of a parallel app wait for each other, in microsecs");
+static int telSend = telemetry.histogram("sage_sail_send_us", "time to split a frame into blocks and send it, in microsecs");
+static int telSyncRtt = telemetry.histogram("sage_sail_sync_rtt_us", "round trip from a sync update of a parallel app to the release of its frame, in microsecs");
+static int telEyeSkipped = telemetry.counter("sage_sail_s3d_skipped_blocks_total", "stereo eye blocks left out because the receivers have them already");
+static int telEyeShared = telemetry.counter("sage_sail_s3d_shared_blocks_total", "right eye blocks left out because they are the same as the left eye");
+static int telEyeResidual = telemetry.counter("sage_sail_s3d_residual_blocks_total", "right eye blocks sent as their difference to the left eye");
+static int telEyeSaved = telemetry.counter("sage_sail_s3d_residual_saved_bytes_total", "bytes of right eye blocks saved by sending the difference to the left eye");
+static sageTrace &trace = sageTrace::instance();
 
 sageBlockStreamer::sageBlockStreamer(streamerConfig &conf, int pixSize) : compFactor(1.0),
-                                                                          compX(1.0), compY(1.0), doubleBuf(NULL)
+                                                                          compX(1.0), compY(1.0), doubleBuf(NULL), syncedFrame(0),
+                                                                          s3dPlanes(false), s3dConfigID(-1), s3dKeyFrame(0)
 {
   config = conf;
   blockSize = config.blockSize;
@@ -81,6 +98,9 @@ int sageBlockStreamer::createDoubleBuffer()
     compFactor = 16.0;
   }
 
+  // the network thread reads every pixel of the frames
+  affinityPlacement placement("network");
+
   // imageviewer(staticApp) doesn't need to have double buffer -S
   pixelBuf[0] = new sageBlockFrame(config.resX, config.resY, bytesPerPixel, compX, compY);
   *pixelBuf[0] = config.imageMap;
@@ -121,6 +141,22 @@ void sageBlockStreamer::setNwConfig(sageNwConfig &nc)
                   config.blockX, config.blockY);
   }
 
+  // the UDP module sends groups from its own thread after the frame has
+  // been released, so pixels have to be copied into the blocks
+  if (config.zeroCopy && config.protocol != SAGE_TCP) {
+    SAGE_PRINTLOG("sageBlockStreamer::setNwConfig : zero-copy streaming needs TCP, copying pixel blocks");
+    config.zeroCopy = false;
+  }
+
+  // the receivers reassemble the eyes from the block flags, every block
+  // has to get there and go through no bridge
+  s3dPlanes = config.s3dPlanes;
+  if (s3dPlanes && (config.pixFmt != PIXFMT_RGBS3D || config.protocol != SAGE_TCP ||
+                    config.bridgeOn || config.swexp)) {
+    SAGE_PRINTLOG("sageBlockStreamer::setNwConfig : stereo planes need an RGBS3D stream over TCP, sending interleaved eyes");
+    s3dPlanes = false;
+  }
+
   //   if ( config.swexp ) {
   //   // When stream to SAGENext wall, image doesn't need to be partitioned because there's only one SDM.
   //     partition = 0;
@@ -132,7 +168,10 @@ void sageBlockStreamer::setNwConfig(sageNwConfig &nc)
   buf->initFrame(partition);
   buf = (sageBlockFrame *)doubleBuf->getBuffer(1);
   buf->initFrame(partition);
-  blockSize = (int)ceil(config.blockX*config.blockY*bytesPerPixel/compFactor) + BLOCK_HEADER_SIZE;
+  if (s3dPlanes)
+    blockSize = config.blockX*config.blockY*bytesPerPixel/2 + BLOCK_HEADER_SIZE;
+  else
+    blockSize = (int)ceil(config.blockX*config.blockY*bytesPerPixel/compFactor) + BLOCK_HEADER_SIZE;
   partition->initBlockTable();
   //   }
 
@@ -145,6 +184,7 @@ void sageBlockStreamer::setNwConfig(sageNwConfig &nc)
   //   if ( config.swexp )
   //     nbg = 0;
   //   else
+  affinityPlacement placement("network");
   nbg = new sageBlockGroup(blockSize, doubleBuf->bufSize(), GRP_MEM_ALLOC | GRP_CIRCULAR);
 }
 
@@ -235,11 +275,14 @@ int sageBlockStreamer::streamPixelData(sageBlockFrame *buf)
     return -1;
   }
 
-  bool flag = true;
+  bool flag = !s3dPlanes;
   buf->resetBlockIndex();
 
   //SAGE_PRINTLOG("%d stream frame %d", config.rank, frameID);
 
+  if (s3dPlanes && streamS3DPlanes(buf) < 0)
+    return -1;
+
   int cnt = 0;
   while (flag) {
     sagePixelBlock *pBlock = nbg->front();
@@ -250,7 +293,10 @@ int sageBlockStreamer::streamPixelData(sageBlockFrame *buf)
     }
     //SAGE_PRINTLOG("pBlock %s", (char *)pBlock->getBuffer());
 
-    flag = buf->extractPixelBlock(pBlock, config.rowOrd);
+    // with zeroCopy the block refers to rows of buf, which stays valid
+    // until streamLoop() releases it after all groups have been flushed
+    flag = buf->extractPixelBlock(pBlock, config.rowOrd, config.zeroCopy);
+    pBlock->setPTS(buf->getPTS());
 
     if (sendPixelBlock(pBlock) < 0)
       return -1;
@@ -283,49 +329,208 @@ int sageBlockStreamer::streamPixelData(sageBlockFrame *buf)
   return 0;
 }
 
-int sageBlockStreamer::streamLoop()
+char* sageBlockStreamer::eyeBuffer(int eye, int blockID)
 {
-  while (streamerOn) {
+  if (blockID >= (int)eyeRef[eye].size())
+    eyeRef[eye].resize(blockID+1, NULL);
 
-    //int syncFrame = 0;
-    //      SAGE_PRINTLOG("\n========= wait for a frame ========\n");
-    sageBlockFrame *buf = (sageBlockFrame *)doubleBuf->getBackBuffer(); // wait on notEmpty condition
-    //      SAGE_PRINTLOG("\n========= got a frame ==========\n");
+  if (!eyeRef[eye][blockID])
+    eyeRef[eye][blockID] = new char[config.blockX*config.blockY*bytesPerPixel/2];
 
-    /* sungwon experimental */
+  return eyeRef[eye][blockID];
+}
 
-    /*
-      if ( 0 affinityFlag ) {
-      #if ! defined (__APPLE__)
-      cpu_set_t cpuset;
-      CPU_ZERO(&cpuset);
+int sageBlockStreamer::streamS3DPlanes(sageBlockFrame *buf)
+{
+  bool delta = (config.s3dCoding & S3D_CODE_DELTA) != 0;
+  bool predict = (config.s3dCoding & S3D_CODE_PREDICT) != 0;
+
+  // the receivers may have new montages after a reconfiguration, so all
+  // blocks are sent then, and every s3dRefresh frames if it is set
+  bool keyFrame = (configID != s3dConfigID) ||
+    (config.s3dRefresh > 0 && frameID - s3dKeyFrame >= config.s3dRefresh);
+  if (keyFrame) {
+    s3dConfigID = configID;
+    s3dKeyFrame = frameID;
+  }
 
-      pthread_mutex_lock(&affinityMutex);
-      std::list<int>::iterator it;
-      for ( it=cpulist.begin(); it!=cpulist.end(); it++) {
-      CPU_SET((*it), &cpuset);
-      }
-      affinityFlag = false; // reset flag
-      pthread_mutex_unlock(&affinityMutex);
+  rcvFed.assign(rcvNodeNum, false);
 
-      if ( pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0 ) {
-      perror("pthread_setaffinity_np");
-      }
-      if ( pthread_getaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0 ) {
-      perror("pthread_getaffinity_np");
-      }
-      else {
-      SAGE_PRINTLOG("SBS::%s() : cpu affinity : ", __FUNCTION__);
-      for (int i=0; i<CPU_SETSIZE; i++) {
-      if (CPU_ISSET(i, &cpuset)) {
-      SAGE_PRINTLOG("%d ", i);
+  bool flag = true;
+  while (flag) {
+    sagePixelBlock *left = nbg->front();
+    nbg->next();
+    // the right block stays in nbg until it is sent
+    sagePixelBlock *right = nbg->front();
+    if (!left || !right) {
+      SAGE_PRINTLOG("sageBlockStreamer::streamS3DPlanes : pixel block is NULL");
+      return -1;
+    }
+
+    flag = buf->extractS3DPlanes(left, right, config.rowOrd);
+    left->setPTS(buf->getPTS());
+    right->setPTS(buf->getPTS());
+
+    // blocks that aren't sent go back to the pool right away, the network
+    // thread only returns the sent ones
+    pixelBlockMap *map = partition->getBlockMap(left->getID());
+    if (!map) {
+      nbg->pushBack(left);
+      continue;
+    }
+
+    int bytes = left->width*left->height*bytesPerPixel/2;
+    char *leftPixels = left->getPixelBuffer();
+    char *rightPixels = right->getPixelBuffer();
+    char *leftRef = NULL, *rightRef = NULL;
+
+    bool leftChanged = true, rightChanged = true;
+    if (delta) {
+      leftRef = eyeBuffer(0, left->getID());
+      rightRef = eyeBuffer(1, left->getID());
+      if (!keyFrame) {
+        leftChanged = (memcmp(leftPixels, leftRef, bytes) != 0);
+        rightChanged = (memcmp(rightPixels, rightRef, bytes) != 0);
       }
+    }
+    bool same = predict && memcmp(leftPixels, rightPixels, bytes) == 0;
+
+    bool sendLeft = leftChanged || (same && rightChanged);
+    bool sendRight = !same && rightChanged;
+
+    // the receiver has this left eye by the time the right one arrives, so
+    // the right eye can go as its difference to it. A code that saves less
+    // than a quarter of the block isn't worth decoding
+    int codeLen = -1;
+    if (predict && sendRight) {
+      if ((int)eyeCode.size() < bytes)
+        eyeCode.resize(bytes);
+      codeLen = sageEncodeEyeResidual(leftPixels, rightPixels, left->width, left->height,
+                                      &eyeCode[0], bytes*3/4);
+    }
+
+    // a receiver only finishes frames it got pixels of
+    if (!sendLeft && !sendRight) {
+      for (pixelBlockMap *m = map; m; m = m->next) {
+        if (!rcvFed[m->infoID])
+          sendLeft = true;
       }
-      SAGE_PRINTLOG("\n");
+    }
+
+    if (sendLeft) {
+      left->setPlane(same ? SAGE_PLANE_BOTH : SAGE_PLANE_LEFT);
+      if (sendPixelBlock(left) < 0)
+        return -1;
+      if (delta) {
+        memcpy(leftRef, leftPixels, bytes);
+        if (same)
+          memcpy(rightRef, leftPixels, bytes);
       }
-      #endif
+    }
+    else {
+      nbg->pushBack(left);
+      telemetry.add(telEyeSkipped);
+    }
+
+    if (sendRight) {
+      nbg->next();
+      if (delta)
+        memcpy(rightRef, rightPixels, bytes);
+
+      if (codeLen > 0) {
+        memcpy(rightPixels, &eyeCode[0], codeLen);
+        right->setPayloadSize(codeLen);
+        right->setPlane(SAGE_PLANE_RESIDUAL);
+        telemetry.add(telEyeResidual);
+        telemetry.add(telEyeSaved, bytes - codeLen);
       }
-    */
+      else
+        right->setPlane(SAGE_PLANE_RIGHT);
+
+      if (sendPixelBlock(right) < 0)
+        return -1;
+    }
+    else
+      telemetry.add(same ? telEyeShared : telEyeSkipped);
+
+    if (sendLeft || sendRight) {
+      for (pixelBlockMap *m = map; m; m = m->next)
+        rcvFed[m->infoID] = true;
+    }
+  }
+
+  return 0;
+}
+
+int sageBlockStreamer::readSync()
+{
+  char *msgStr = NULL;
+  int frame = config.syncClientObj->waitForSyncData(msgStr);
+  if (frame < 0)
+    return -1;
+
+  // the sync master may release several reported frames at once
+  double now = sage::getTime();
+  while (syncUpdates.size() > 0 && syncUpdates.front().first <= frame) {
+    if (syncUpdates.front().first == frame)
+      telemetry.observe(telSyncRtt, (long long)(now - syncUpdates.front().second));
+    syncUpdates.pop_front();
+  }
+
+  syncedFrame = MAX(syncedFrame, frame);
+
+  if (msgStr) {
+    // every node has streamed frame-1+syncPipeline at most, so all of them
+    // can switch at frame+syncPipeline. Before the first configuration the
+    // nodes wait for every frame and switch right away
+    int startFrame = frame;
+    if (!firstConfiguration)
+      startFrame += config.syncPipeline;
+    syncConfigs.push_back(std::pair<int, char *>(startFrame, msgStr));
+  }
+
+  return 0;
+}
+
+int sageBlockStreamer::syncParallel()
+{
+  sageSyncClient *syncClient = config.syncClientObj;
+  int depth = firstConfiguration ? 0 : config.syncPipeline;
+
+  if (config.syncPipeline > 0)
+    syncClient->sendSlaveUpdate(frameID, 0, 0, SAGE_UPDATE_PIPELINE);
+  else
+    syncClient->sendSlaveUpdate(frameID);
+  syncUpdates.push_back(std::pair<int, double>(frameID, sage::getTime()));
+
+  // wait for the frame depth frames back, and take the syncs that are in
+  while (syncedFrame < frameID - depth || (depth > 0 && syncClient->isSyncReady())) {
+    if (readSync() < 0)
+      return -1;
+  }
+
+  while (syncConfigs.size() > 0 && syncConfigs.front().first <= frameID) {
+    reconfigureStreams(syncConfigs.front().second);
+    delete [] syncConfigs.front().second;
+    syncConfigs.pop_front();
+    firstConfiguration = false;
+  }
+
+  return 0;
+}
+
+int sageBlockStreamer::streamLoop()
+{
+  while (streamerOn) {
+
+    //int syncFrame = 0;
+    //      SAGE_PRINTLOG("\n========= wait for a frame ========\n");
+    double waitStart = sage::getTime();
+    double traceStart = trace.now();
+    sageBlockFrame *buf = (sageBlockFrame *)doubleBuf->getBackBuffer(); // wait on notEmpty condition
+    telemetry.observe(telWait, (long long)(sage::getTime() - waitStart));
+    trace.record(TRACE_RENDER, winID, frameID, traceStart, trace.now());
+    //      SAGE_PRINTLOG("\n========= got a frame ==========\n");
 
     if ( config.swexp ) {
       //buf->updateBufferHeader(frameID, config.resX, config.resY);
@@ -343,15 +548,9 @@ int sageBlockStreamer::streamLoop()
 
     char *msgStr = NULL;
     if (config.nodeNum > 1) {
-      config.syncClientObj->sendSlaveUpdate(frameID);
-      //SAGE_PRINTLOG("send update %d", config.rank);
-      config.syncClientObj->waitForSyncData(msgStr);
-      //SAGE_PRINTLOG("receive sync %d", config.rank);
-      if (msgStr) {
-        //SAGE_PRINTLOG("reconfigure %s", msgStr);
-        reconfigureStreams(msgStr);
-        //firstConfiguration = false;
-      }
+      telemetryTimer syncTimer(telSyncWait);
+      traceScope syncTrace(TRACE_SYNC, winID, frameID);
+      syncParallel();
     }
     else {
       pthread_mutex_lock(reconfigMutex);
@@ -368,10 +567,22 @@ int sageBlockStreamer::streamLoop()
     if (config.nodeNum == 1)
       checkInterval();
 
+    double sendStart = sage::getTime();
+    unsigned long sentBefore = totalBandWidth;
+    int sentFrame = frameID;
+    traceStart = trace.now();
+
     if (streamPixelData(buf) < 0) {
       streamerOn = false;
     }
 
+    telemetry.observe(telSend, (long long)(sage::getTime() - sendStart));
+    trace.record(TRACE_SEND, winID, sentFrame, traceStart, trace.now());
+    telemetry.add(telFrames);
+    // the performance report resets totalBandWidth now and then
+    if (totalBandWidth > sentBefore)
+      telemetry.add(telBytes, totalBandWidth - sentBefore);
+
     // signal notFull condition
     doubleBuf->releaseBackBuffer();
     //      SAGE_PRINTLOG("releaseBackBuffer() returned");
@@ -398,6 +609,14 @@ void sageBlockStreamer::shutdown()
 
 sageBlockStreamer::~sageBlockStreamer()
 {
+  for (int i=0; i<syncConfigs.size(); i++)
+    delete [] syncConfigs[i].second;
+
+  for (int eye=0; eye<2; eye++) {
+    for (int i=0; i<eyeRef[eye].size(); i++)
+      delete [] eyeRef[eye][i];
+  }
+
   if (doubleBuf)
     delete doubleBuf;
 
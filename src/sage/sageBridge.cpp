@@ -49,6 +49,7 @@
 #include "sageSync.h"
 #include "sageBlockQueue.h"
 #include "sageEvent.h"
+#include "sageTelemetry.h"
 
 sageBridge::~sageBridge()
 {
@@ -62,7 +63,8 @@ sageBridge::~sageBridge()
 }
 
 sageBridge::sageBridge(int argc, char **argv) : syncPort(0), syncGroupID(0), audioPort(44000),
-                                                allocPolicy(ALLOC_SINGLE_NODE), enableSync(1)
+                                                allocPolicy(ALLOC_SINGLE_NODE), enableSync(1),
+                                                lastRxBytes(0), lastTxBytes(0), lastCpuBusy(0), lastCpuTotal(0)
 {
   nwCfg = new sageNwConfig;
   for (int i=0; i<MAX_INST_NUM; i++)
@@ -113,6 +115,11 @@ sageBridge::sageBridge(int argc, char **argv) : syncPort(0), syncGroupID(0), aud
       SAGE_PRINTLOG("sageBrdige::%s() : can't create performance report thread", __FUNCTION__);
     }
   }
+
+  char expName[SAGE_NAME_LEN], expLabels[SAGE_NAME_LEN];
+  sprintf(expName, "bridge-%d", shared->nodeID);
+  sprintf(expLabels, "proc=\"bridge\",node=\"%d\"", shared->nodeID);
+  sageTelemetry::instance().startExport(expName, expLabels);
 }
 
 int sageBridge::initMaster(char *cFile)
@@ -435,32 +442,143 @@ int sageBridge::perfReport()
       appInstList[i]->sendPerformanceInfo();
   }
 
+  if (loadTimer.getTimeSec() >= NODE_LOAD_INTERVAL) {
+    char loadStr[TOKEN_LEN];
+    measureNodeLoad(loadStr);
+    shared->eventQueue->sendEvent(EVENT_NODE_LOAD_INFO, loadStr);
+  }
+
   return 0;
 }
 
+/**
+ * measures the network, CPU and block buffer load of this node since the
+ * last call and prints "nodeID nicLoad cpuLoad bufLoad" into loadStr
+ */
+int sageBridge::measureNodeLoad(char *loadStr)
+{
+  // bytes received and sent on all interfaces but the loopback
+  unsigned long long rxBytes = 0, txBytes = 0;
+  FILE *fp = fopen("/proc/net/dev", "r");
+  if (fp) {
+    char line[TOKEN_LEN];
+    while (fgets(line, TOKEN_LEN, fp)) {
+      char *colon = strchr(line, ':');
+      if (!colon)
+        continue;
+
+      *colon = '\0';
+      char ifName[TOKEN_LEN];
+      if (sscanf(line, "%s", ifName) != 1 || strcmp(ifName, "lo") == 0)
+        continue;
+
+      unsigned long long rx, tx, skip;
+      if (sscanf(colon+1, "%llu %llu %llu %llu %llu %llu %llu %llu %llu", &rx, &skip, &skip,
+                 &skip, &skip, &skip, &skip, &skip, &tx) == 9) {
+        rxBytes += rx;
+        txBytes += tx;
+      }
+    }
+    fclose(fp);
+  }
+
+  // busy and total time of all CPUs
+  unsigned long long cpuBusy = 0, cpuTotal = 0;
+  fp = fopen("/proc/stat", "r");
+  if (fp) {
+    unsigned long long user, nice, sys, idle, iowait = 0, irq = 0, softirq = 0;
+    if (fscanf(fp, "cpu %llu %llu %llu %llu %llu %llu %llu", &user, &nice, &sys, &idle,
+               &iowait, &irq, &softirq) >= 4) {
+      cpuBusy = user + nice + sys + irq + softirq;
+      cpuTotal = cpuBusy + idle + iowait;
+    }
+    fclose(fp);
+  }
+
+  double elapsed = loadTimer.getTimeUS(true);
+
+  float nicLoad = 0.0, cpuLoad = 0.0, bufLoad = 0.0;
+
+  // the first call only takes the counters
+  if (lastCpuTotal > 0 && elapsed > 0) {
+    unsigned long long rx = (rxBytes > lastRxBytes) ? rxBytes - lastRxBytes : 0;
+    unsigned long long tx = (txBytes > lastTxBytes) ? txBytes - lastTxBytes : 0;
+
+    // maxBandWidth is in Mbit/s, that is bits per micro-second
+    if (nwCfg->maxBandWidth > 0)
+      nicLoad = (float)(MAX(rx, tx) * 8.0 / (elapsed * nwCfg->maxBandWidth));
+
+    if (cpuTotal > lastCpuTotal)
+      cpuLoad = (float)(cpuBusy - lastCpuBusy) / (cpuTotal - lastCpuTotal);
+  }
+
+  lastRxBytes = rxBytes;
+  lastTxBytes = txBytes;
+  lastCpuBusy = cpuBusy;
+  lastCpuTotal = cpuTotal;
+
+  for (int i=0; i<instNum; i++) {
+    appInstance *inst = appInstList[i];
+    if (inst)
+      bufLoad = MAX(bufLoad, inst->bufStatus()/100.0f);
+  }
+
+  sprintf(loadStr, "%d %5.3f %5.3f %5.3f", shared->nodeID, nicLoad, cpuLoad, bufLoad);
+
+  return 0;
+}
+
+/**
+ * stores a load report of a node on the master
+ */
+int sageBridge::updateNodeLoad(char *loadStr)
+{
+  int nodeID;
+  float nicLoad, cpuLoad, bufLoad;
+
+  if (sscanf(loadStr, "%d %f %f %f", &nodeID, &nicLoad, &cpuLoad, &bufLoad) < 4 ||
+      nodeID < 0 || nodeID >= MAX_BRIDGE_NODE) {
+    SAGE_PRINTLOG("sageBridge::updateNodeLoad : invalid load report %s", loadStr);
+    return -1;
+  }
+
+  bridgeNodeLoad &load = nodeLoad[nodeID];
+  load.nicLoad = nicLoad;
+  load.cpuLoad = cpuLoad;
+  load.bufLoad = bufLoad;
+
+  // by now the streams of the new apps show up in the report
+  if (load.newApps > 0 && load.placeTimer.getTimeSec() > NODE_LOAD_SETTLE)
+    load.newApps = 0;
+
+  return 0;
+}
+
+/**
+ * picks the bridge node for a new app from the load the nodes measured
+ * themselves, so that heavy streams don't end up on the same node
+ */
 int sageBridge::findMinLoadNode()
 {
   int nodeSel = 0;
-  double minLoad = 0;
+  float minLoad = 0;
 
   for (int i=0; i<shared->nodeNum; i++) {
-    double loadSum = 0.0;
-    for (int j=0; j<instNum; j++) {
-      if (appInstList[j] && appInstList[j]->allocInfoList[0].nodeID == i)
-        loadSum += appInstList[j]->curBandWidth;
-    }
+    bridgeNodeLoad &load = nodeLoad[i];
+    float score = load.score();
 
-    if (i == 0) {
-      minLoad = loadSum;
-    }
-    else if (minLoad > loadSum) {
+    if (i == 0 || minLoad > score) {
       nodeSel = i;
-      minLoad = loadSum;
+      minLoad = score;
     }
 
-    SAGE_PRINTLOG("node %d load %d", i, loadSum);
+    SAGE_PRINTLOG("node %d load : nic %4.2f cpu %4.2f buffer %4.2f new apps %d", i,
+                  load.nicLoad, load.cpuLoad, load.bufLoad, load.newApps);
   }
 
+  nodeLoad[nodeSel].newApps++;
+  nodeLoad[nodeSel].placeTimer.reset();
+
   return nodeSel;
 }
 
@@ -942,6 +1060,11 @@ int sageBridge::parseMessage(sageMessage &msg, int clientID)
       break;
     }
 
+    case BRIDGE_NODE_LOAD : {
+      updateNodeLoad(msgData);
+      break;
+    }
+
     case BRIDGE_APP_INST_READY : {
       int instID = msg.getDest();
       appInstance *inst = findAppInstance(instID);
@@ -1105,6 +1228,14 @@ int sageBridge::parseEvent(sageEvent *event)
     break;
   }
 
+  case EVENT_NODE_LOAD_INFO : {
+    if (master)
+      updateNodeLoad(event->eventMsg);
+    else
+      msgInf->msgToServer(0, BRIDGE_NODE_LOAD, event->eventMsg);
+    break;
+  }
+
   case EVENT_MASTER_PERF_INFO : {
     int fsClientID;
     sscanf(event->eventMsg, "%d", &fsClientID);
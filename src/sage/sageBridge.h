@@ -45,6 +45,14 @@
 
 #define MAX_BRIDGE_NODE 100
 
+// how often each node measures its own load (in seconds)
+#define NODE_LOAD_INTERVAL 1.0
+
+// load added to a node for every app placed on it that may not show up
+// in its reports yet, and how long (in seconds) that takes at most
+#define NODE_LOAD_NEW_APP  0.3
+#define NODE_LOAD_SETTLE   5.0
+
 class messageInterface;
 class sageBridge;
 class streamProtocol;
@@ -64,6 +72,22 @@ typedef struct {
   streamProtocol *nwObj;
 } nwCheckThreadParam;
 
+/**
+ * load of a bridge node as last reported to the master.
+ * All values are fractions between 0 and 1
+ */
+class bridgeNodeLoad {
+public:
+  float nicLoad;   // busier direction of the NICs relative to maxBandWidth
+  float cpuLoad;   // busy time of all CPUs
+  float bufLoad;   // fullest block buffer of the apps on the node
+  int newApps;     // apps placed on the node within NODE_LOAD_SETTLE
+  sageTimer placeTimer;
+
+  bridgeNodeLoad() : nicLoad(0.0), cpuLoad(0.0), bufLoad(0.0), newApps(0) {}
+  float score() { return nicLoad + cpuLoad + bufLoad + newApps*NODE_LOAD_NEW_APP; }
+};
+
 class sageBridge {
 protected:
   bridgeSharedData *shared;
@@ -87,6 +111,13 @@ protected:
   sageSyncServer *syncServerObj;
   //sageSyncClient *syncClientObj;
 
+  bridgeNodeLoad nodeLoad[MAX_BRIDGE_NODE];   // kept by the master
+
+  // counters of the last load measurement on this node
+  sageTimer loadTimer;
+  unsigned long long lastRxBytes, lastTxBytes;
+  unsigned long long lastCpuBusy, lastCpuTotal;
+
   bool bridgeEnd;
   int syncGroupID;
   int enableSync;
@@ -111,6 +142,8 @@ protected:
   int parseEvent(sageEvent *event);
 
   int findMinLoadNode();
+  int measureNodeLoad(char *loadStr);
+  int updateNodeLoad(char *loadStr);
   int startPerformanceReport(sageMessage &msg);
   int stopPerformanceReport(sageMessage &msg);
   int perfReport();
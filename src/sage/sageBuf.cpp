@@ -63,6 +63,15 @@ void sageBuf::resetIdx()
   writeIdx = 0;
 }
 
+void sageBuf::clearEntries()
+{
+  pthread_mutex_lock(&bufLock);
+  for (int i=0; i<bufLen; i++)
+    entries[i] = NULL;
+  reset();
+  pthread_mutex_unlock(&bufLock);
+}
+
 void sageBuf::initArray(int size)
 {
   bufLen = size;
@@ -391,17 +400,34 @@ sageBufEntry sageCircBufMulti::front(int id)
 
   if (blocking) {
     pthread_mutex_lock(&bufLock);
-    while(readers[id].empty) {
+    // removeReader() and releaseLock() wake up waiting readers
+    while(readers[id].empty && readers[id].active && blocking) {
       pthread_cond_wait(&notEmpty, &bufLock);
     }
     pthread_mutex_unlock(&bufLock);
   }
-  else if (readers[id].empty)
+
+  if (readers[id].empty || !readers[id].active)
     return NULL;
 
   return entries[readers[id].readIdx];
 }
 
+int sageCircBufMulti::unread(int id)
+{
+  int num = 0;
+
+  pthread_mutex_lock(&bufLock);
+  if (readers[id].active && !readers[id].empty) {
+    num = distToWriteIdx(readers[id].readIdx);
+    if (num == 0)
+      num = bufLen;  // the reader is a full lap behind
+  }
+  pthread_mutex_unlock(&bufLock);
+
+  return num;
+}
+
 sageBufEntry sageCircBufMulti::next(int id)
 {
   if (readers[id].empty || !readers[id].active) {
@@ -81,6 +81,7 @@ public:
 
   void reset();
   void resetIdx();
+  void clearEntries(); /**< drops all entries without touching them */
   int getStatus() { return entryNum*100/bufLen; }
   virtual void setBlockingFlag(bool blk) {}
   virtual bool pushBack(sageBufEntry entry) = 0;
@@ -127,6 +128,7 @@ public:
 
   void setBlockingFlag(bool blk) { blocking = blk; }
   void releaseLock();
+  inline void reactivate(bool blk) { blocking = blk, active = true; }
 };
 
 class sageRAB : public sageBuf {
@@ -185,6 +187,13 @@ public:
   void removeReader(int id);
   inline bool isActive(int id) { return readers[id].active; }
 
+  /**
+   * number of entries reader id hasn't passed yet. These can't be
+   * overwritten until the reader moves on, so peek() may look at them
+   */
+  int unread(int id);
+  inline sageBufEntry peek(int id, int k) { return entries[(readers[id].readIdx + k) % bufLen]; }
+
   bool pushBack(sageBufEntry entry);
   sageBufEntry front(int id);
   sageBufEntry next(int id);
@@ -0,0 +1,193 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageClock.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageClock.h"
+#include <errno.h>
+
+sageClock::sageClock() : sampleNum(0), target(0.0), offset(0.0), slewTime(0.0)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  epoch = (double)tv.tv_sec*1000000.0 + (double)tv.tv_usec - sage::getTime();
+
+  pthread_mutex_init(&lock, NULL);
+}
+
+sageClock& sageClock::instance()
+{
+  static sageClock clock;
+  return clock;
+}
+
+double sageClock::now()
+{
+  pthread_mutex_lock(&lock);
+  double t = local();
+
+  if (offset != target) {
+    double step = (t - slewTime) * CLOCK_MAX_SLEW / 1000000.0;
+    double error = target - offset;
+    offset += MAX(-step, MIN(step, error));
+  }
+  slewTime = t;
+  t += offset;
+  pthread_mutex_unlock(&lock);
+
+  return t;
+}
+
+void sageClock::addSample(double masterTime, double localTime)
+{
+  pthread_mutex_lock(&lock);
+  samples[sampleNum % CLOCK_SAMPLES] = masterTime - localTime;
+  sampleNum++;
+
+  // a sample is the offset minus the network delay, the largest recent one
+  // had the shortest delay
+  int num = MIN(sampleNum, CLOCK_SAMPLES);
+  target = samples[0];
+  for (int i=1; i<num; i++) {
+    if (samples[i] > target)
+      target = samples[i];
+  }
+
+  if (sampleNum == 1 || fabs(target - offset) > CLOCK_STEP_LIMIT) {
+    if (sampleNum > 1)
+      SAGE_PRINTLOG("sageClock : stepped by %.0f us", target - offset);
+    offset = target;
+    slewTime = local();
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+double sageClock::getOffset()
+{
+  pthread_mutex_lock(&lock);
+  double o = target;
+  pthread_mutex_unlock(&lock);
+
+  return o;
+}
+
+void sagePlayout::arrival(double pts, double now)
+{
+  lags[lagNum % PLAYOUT_WINDOW] = now - pts;
+  lagNum++;
+
+  int num = MIN(lagNum, PLAYOUT_WINDOW);
+  double best = lags[0];
+  for (int i=1; i<num; i++) {
+    if (lags[i] < best)
+      best = lags[i];
+  }
+
+  // slew like the clock, so the sender drifting away doesn't make the
+  // presentation jump
+  if (lagNum == 1 || fabs(best - lag) > CLOCK_STEP_LIMIT) {
+    lag = best;
+  }
+  else {
+    double step = (now - lagTime) * CLOCK_MAX_SLEW / 1000000.0;
+    lag += MAX(-step, MIN(step, best - lag));
+  }
+  lagTime = now;
+}
+
+double sagePacer::monotonic()
+{
+#if defined(__linux__)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec*1000000.0 + (double)ts.tv_nsec/1000.0;
+#else
+  return sage::getTime();
+#endif
+}
+
+double sagePacer::wait()
+{
+  double now = monotonic();
+
+  // the first frame, or the loop fell behind : start over from now
+  if (deadline == 0.0 || now - deadline > interval*PACER_MAX_LATE)
+    deadline = now;
+
+  if (deadline > now) {
+#if defined(__linux__)
+    struct timespec ts;
+    ts.tv_sec = (time_t)(deadline / 1000000.0);
+    ts.tv_nsec = (long)((deadline - (double)ts.tv_sec*1000000.0) * 1000.0);
+    if (ts.tv_nsec > 999999999)
+      ts.tv_nsec = 999999999;
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+      ;
+#else
+    sage::usleep((unsigned long)(deadline - now));
+#endif
+    now = monotonic();
+  }
+
+  double late = MAX(now - deadline, 0.0);
+  deadline += interval;
+
+  return late;
+}
+
+bool sagePacer::isDue(double early, double *late)
+{
+  double now = monotonic();
+
+  if (deadline == 0.0 || now - deadline > interval*PACER_MAX_LATE)
+    deadline = now;
+
+  if (now < deadline - early)
+    return false;
+
+  if (late)
+    *late = MAX(now - deadline, 0.0);
+  deadline += interval;
+
+  return true;
+}
+
+void sagePacer::holdOff()
+{
+  deadline = MAX(deadline, monotonic() + interval);
+}
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageClock.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_CLOCK_H
+#define SAGE_CLOCK_H
+
+#include "sageBase.h"
+#include "misc.h"
+
+// master clock samples the offset is estimated from
+#define CLOCK_SAMPLES 64
+
+// the most a clock is corrected per second, in microsecs
+#define CLOCK_MAX_SLEW 500.0
+
+// errors larger than that are stepped instead of slewed, in microsecs
+#define CLOCK_STEP_LIMIT 50000.0
+
+// arrivals the sender clock of a stream is tracked over
+#define PLAYOUT_WINDOW 128
+
+// a paced loop this many intervals behind starts over instead of catching up
+#define PACER_MAX_LATE 1.0
+
+/**
+ * The cluster clock, in microsecs. It is the wall clock of the sync master:
+ * every message of the master carries its time and addSample() is called
+ * when it arrives. A sample is the offset minus the network delay, so the
+ * largest of the last few is the estimate. The offset is slewed towards
+ * the estimate, now() never jumps back unless the error is too large to
+ * slew. Without samples the cluster clock is the local wall clock.
+ */
+class sageClock {
+private:
+  double epoch;  // wall clock - sage::getTime(), in microsecs
+
+  pthread_mutex_t lock;
+  double samples[CLOCK_SAMPLES];
+  int sampleNum;
+
+  double target;    // estimated master clock - local clock
+  double offset;    // the part of it applied so far
+  double slewTime;  // local time of the last slew
+
+  sageClock();
+
+public:
+  static sageClock& instance();
+
+  /** local wall clock */
+  inline double local() { return sage::getTime() + epoch; }
+
+  /** cluster clock */
+  double now();
+
+  /**
+   * a reading of the master clock, taken when its message arrived at
+   * localTime. Both are wall clock times in microsecs
+   */
+  void addSample(double masterTime, double localTime);
+
+  inline bool isSynced() { return sampleNum > 0; }
+
+  /** estimated master clock - local clock */
+  double getOffset();
+};
+
+/**
+ * Maps the presentation timestamps of a stream to the cluster clock.
+ * Senders stamp frames and audio blocks with their own cluster clock, the
+ * smallest lag between arrival and timestamp over the last arrivals is the
+ * clock difference plus the shortest transfer. Everything is presented
+ * delay microsecs after that, so the lag is slewed like the clock and
+ * receivers with the same delay present a frame and its audio together.
+ * Not thread safe, one thread feeds and reads it.
+ */
+class sagePlayout {
+private:
+  double lags[PLAYOUT_WINDOW];  // arrival - timestamp
+  int lagNum;
+  double lag;      // applied lag
+  double lagTime;  // cluster time of the last arrival
+  double delay;
+
+public:
+  sagePlayout() : lagNum(0), lag(0.0), lagTime(0.0), delay(0.0) {}
+
+  /** presentation delay in microsecs, 0 turns scheduling off */
+  inline void setDelay(double us) { delay = us; }
+  inline bool isOn() { return delay > 0.0; }
+
+  /** a frame or block stamped pts arrived at cluster time now */
+  void arrival(double pts, double now);
+
+  /** cluster time the frame or block stamped pts is presented at */
+  inline double presentTime(double pts) { return pts + lag + delay; }
+
+  inline void reset() { lagNum = 0; }
+};
+
+/**
+ * Paces a loop at a fixed rate on absolute deadlines of the monotonic
+ * clock. A deadline is the one before plus the interval, so neither the
+ * work between two calls nor waking up late add up over the frames, and
+ * intervals like 41708.3 us for 24 fps aren't rounded. wait() sleeps with
+ * clock_nanosleep(TIMER_ABSTIME) where there is one. Not thread safe, one
+ * loop owns a pacer.
+ */
+class sagePacer {
+private:
+  double interval;  // in microsecs
+  double deadline;  // monotonic time of the next frame, 0 before the first
+
+public:
+  sagePacer() : interval(0.0), deadline(0.0) {}
+
+  /** monotonic clock in microsecs */
+  static double monotonic();
+
+  inline void setInterval(double us) { interval = us; }
+  inline void setRate(double fps) { interval = (fps > 0.0) ? 1000000.0/fps : 0.0; }
+  inline double getInterval() { return interval; }
+
+  /** the next call goes right away and the deadlines start from there */
+  inline void reset() { deadline = 0.0; }
+
+  /**
+   * sleeps until the next deadline and moves it on. Returns how late it
+   * woke up in microsecs, the pacing jitter
+   */
+  double wait();
+
+  /**
+   * for loops that can't sleep : true, and the deadline moves on, if it is
+   * at most early microsecs ahead. late gets the jitter
+   */
+  bool isDue(double early, double *late = NULL);
+
+  /**
+   * moves the next deadline to at least an interval from now, for loops
+   * where the interval is a minimum gap and not a rate to catch up with
+   */
+  void holdOff();
+};
+
+#endif
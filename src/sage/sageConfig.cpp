@@ -41,9 +41,11 @@
 #include "sageConfig.h"
 #include "sageBlock.h"
 #include "sageSync.h"
+#include "sageAffinity.h"
 
 streamerConfig::streamerConfig() : rank(0), resX(0), resY(0), rowOrd(TOP_TO_BOTTOM),
-                                   master(true), protocol(SAGE_TCP), asyncUpdate(true), blockX(64), blockY(64), blockSize(0),
+                                   master(true), protocol(SAGE_TCP), asyncUpdate(true), zeroCopy(false), syncPipeline(0),
+                                   s3dPlanes(false), s3dCoding(S3D_CODE_DELTA | S3D_CODE_PREDICT), s3dRefresh(0), blockX(64), blockY(64), blockSize(0),
                                    compression(NO_COMP), pixFmt(PIXFMT_888), streamType(SAGE_BLOCK_HARD_SYNC),
                                    syncClientObj(NULL), frameRate(30), totalWidth(0), totalHeight(0), groupSize(32767),
   audioOn(false), audioPort(0), audioDeviceNum(0), audioKeyFrame(100), audioProtocol(SAGE_TCP),
@@ -226,6 +228,42 @@ int sailConfig::init(char *fname)
       sage::tolower(token);
       asyncUpdate = (strcmp(token, "true") == 0);
     }
+    else if (strcmp(token, "ZEROCOPY") == 0) {
+      getToken(fp, token);
+      sage::tolower(token);
+      zeroCopy = (strcmp(token, "true") == 0);
+    }
+    else if (strcmp(token, "SYNCPIPELINE") == 0) {
+      getToken(fp, token);
+      syncPipeline = MAX(atoi(token), 0);
+    }
+    else if (strcmp(token, "S3DPLANES") == 0) {
+      getToken(fp, token);
+      sage::tolower(token);
+      s3dPlanes = (strcmp(token, "true") == 0);
+    }
+    else if (strcmp(token, "S3DCODING") == 0) {
+      getToken(fp, token);
+      sage::tolower(token);
+      if (strcmp(token, "none") == 0)
+        s3dCoding = 0;
+      else if (strcmp(token, "delta") == 0)
+        s3dCoding = S3D_CODE_DELTA;
+      else if (strcmp(token, "predict") == 0)
+        s3dCoding = S3D_CODE_PREDICT;
+      else
+        s3dCoding = S3D_CODE_DELTA | S3D_CODE_PREDICT;
+    }
+    else if (strcmp(token, "S3DREFRESH") == 0) {
+      getToken(fp, token);
+      s3dRefresh = MAX(atoi(token), 0);
+    }
+    else if (strcmp(token, "AFFINITY") == 0) {
+      char spec[TOKEN_LEN];
+      getToken(fp, token);
+      getToken(fp, spec);
+      sageAffinity::instance().set(token, spec);
+    }
     else if (strcmp(token, "SYNCMODE") == 0) {
       getToken(fp, token);
       syncMode = atoi(token);
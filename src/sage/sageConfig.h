@@ -43,6 +43,10 @@
 
 #include "sage.h"
 
+// how a stereo stream sent in planes saves bandwidth
+#define S3D_CODE_DELTA    1   // an eye that did not change since the last frame
+#define S3D_CODE_PREDICT  2   // a right eye predicted from the left eye
+
 class sageSyncServer;
 class sageSyncClient;
 class syncGroup;
@@ -62,6 +66,11 @@ public:
   int   rowOrd;      // row order flag
   bool  master;      // is master node or not
   bool  asyncUpdate;
+  bool  zeroCopy;    // send pixels from the frame buffer without copying them into blocks (TCP only)
+  int   syncPipeline; // frames the nodes of a parallel app may stream ahead of the sender sync
+  bool  s3dPlanes;   // send the eyes of PIXFMT_RGBS3D as separate planes (TCP only)
+  int   s3dCoding;   // S3D_CODE_DELTA | S3D_CODE_PREDICT
+  int   s3dRefresh;  // frames between complete stereo frames, 0 for after reconfigurations only
   sageCompressType compression;
   int  frameRate;
   int  syncMode;
@@ -161,8 +170,9 @@ public:
   int displayID;
   bool audioOn;
   char renderNodeIP[SAGE_IP_LEN];
+  double regTime; // when the app registered (REG_APP), in microsecs
 
-  appInExec() : displayID(0) {}
+  appInExec() : displayID(0), regTime(0.0) {}
 };
 
 #endif
@@ -0,0 +1,159 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageConvBench.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+/*
+ * Times the pixel conversions of sagePixelConvert with and without the SIMD
+ * kernels, and checks that both give the same pixels.
+ *
+ *   sageConvBench [width height [iterations]]
+ */
+
+#include "sagePixelConvert.h"
+#include "misc.h"
+
+struct convCase {
+  sageConvFmt src;
+  sagePixFmt dst;
+  const char *dstName;
+  bool flip;
+};
+
+static const convCase cases[] = {
+  { CONVFMT_RGB,     PIXFMT_888,      "888",      true  },
+  { CONVFMT_RGB,     PIXFMT_888_INV,  "888_INV",  false },
+  { CONVFMT_BGR,     PIXFMT_888,      "888",      false },
+  { CONVFMT_RGB,     PIXFMT_8888,     "8888",     false },
+  { CONVFMT_RGB,     PIXFMT_8888_INV, "8888_INV", false },
+  { CONVFMT_RGBA,    PIXFMT_888,      "888",      false },
+  { CONVFMT_BGRA,    PIXFMT_888,      "888",      false },
+  { CONVFMT_BGRA,    PIXFMT_888,      "888",      true  },
+  { CONVFMT_BGRA,    PIXFMT_YUV,      "YUV",      false },
+  { CONVFMT_UYVY,    PIXFMT_888,      "888",      false },
+  { CONVFMT_YUYV,    PIXFMT_888,      "888",      false },
+  { CONVFMT_YUYV,    PIXFMT_YUV,      "YUV",      false },
+  { CONVFMT_YUV420,  PIXFMT_888,      "888",      false },
+  { CONVFMT_YUV420,  PIXFMT_YUV,      "YUV",      false },
+  { CONVFMT_565,     PIXFMT_888,      "888",      false },
+  { CONVFMT_555,     PIXFMT_888,      "888",      false },
+  { CONVFMT_RGB,     PIXFMT_565,      "565",      false },
+  { CONVFMT_RGB,     PIXFMT_555,      "555",      false },
+  { CONVFMT_RGB_SBS, PIXFMT_RGBS3D,   "RGBS3D",   false }
+};
+
+// milliseconds per image
+static double timeConversion(const convCase &c, unsigned char *src, unsigned char *dst,
+                             int w, int h, int iterations)
+{
+  sageTimer timer;
+  for (int i=0; i<iterations; i++)
+    sageConvertImage(src, c.src, dst, c.dst, w, h, c.flip);
+
+  return timer.getTimeUS() / 1000.0 / iterations;
+}
+
+int main(int argc, char **argv)
+{
+  int w = 1920, h = 1080, iterations = 50;
+
+  if (argc >= 3) {
+    w = atoi(argv[1]);
+    h = atoi(argv[2]);
+  }
+  if (argc >= 4)
+    iterations = atoi(argv[3]);
+
+  if (w <= 0 || h <= 0 || iterations <= 0) {
+    fprintf(stderr, "usage: %s [width height [iterations]]\n", argv[0]);
+    return -1;
+  }
+
+  bool hasSIMD = sageConvertSIMD(true);
+  printf("%dx%d, %d iterations, SIMD kernels %s\n\n", w, h, iterations,
+         hasSIMD ? "available" : "not available");
+  printf("%-18s %12s %12s %8s\n", "conversion", "scalar ms", "simd ms", "speedup");
+
+  // largest source and destination : side by side RGB and RGBS3D
+  int size = w*h*6;
+  unsigned char *src = new unsigned char[size];
+  unsigned char *ref = new unsigned char[size];
+  unsigned char *out = new unsigned char[size];
+
+  srand(1);
+  for (int i=0; i<size; i++)
+    src[i] = rand() & 0xff;
+
+  int failed = 0;
+  for (int i=0; i<(int)(sizeof(cases)/sizeof(cases[0])); i++) {
+    const convCase &c = cases[i];
+    int outSize = w*h*getPixelSize(c.dst);
+
+    char name[64];
+    sprintf(name, "%s->%s%s", sageConvFmtName(c.src), c.dstName, c.flip ? " flip" : "");
+
+    sageConvertSIMD(false);
+    if (sageConvertImage(src, c.src, ref, c.dst, w, h, c.flip) < 0) {
+      printf("%-18s not supported\n", name);
+      failed++;
+      continue;
+    }
+    double scalarTime = timeConversion(c, src, ref, w, h, iterations);
+
+    if (!hasSIMD) {
+      printf("%-18s %12.2f\n", name, scalarTime);
+      continue;
+    }
+
+    sageConvertSIMD(true);
+    memset(out, 0, outSize);
+    sageConvertImage(src, c.src, out, c.dst, w, h, c.flip);
+    bool same = (memcmp(ref, out, outSize) == 0);
+    double simdTime = timeConversion(c, src, out, w, h, iterations);
+
+    printf("%-18s %12.2f %12.2f %7.1fx%s\n", name, scalarTime, simdTime,
+           scalarTime / simdTime, same ? "" : "  MISMATCH");
+    if (!same)
+      failed++;
+  }
+
+  delete [] src;
+  delete [] ref;
+  delete [] out;
+
+  return failed ? -1 : 0;
+}
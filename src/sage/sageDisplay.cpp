@@ -47,6 +47,14 @@
 #include "drawObjects.h"
 #include "overlayApp.h"
 #include "image.h"
+#include "sageTelemetry.h"
+#include "sageTrace.h"
+#include "sageScreenCapture.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telRefresh = telemetry.counter("sage_sdm_refresh_total", "screen refreshes of the display node");
+static int telDraw = telemetry.histogram("sage_sdm_draw_us", "time to draw the damaged tiles, in microsecs");
+static int telBarrier = telemetry.histogram("sage_sdm_barrier_wait_us", "time spent in the swap buffer barrier, in microsecs");
 
 #if ! defined(WIN32)
 /////////////////////////////////////////////////////////////////////////
@@ -135,6 +143,13 @@ void sageMontage::loadPixelBlock(sagePixelBlock *block)
   sageTex->loadPixelBlock(block);
 }
 
+void sageMontage::loadPixelBlocks(sageBlockCopy *copies, int num)
+{
+  context->switchContext(tileIdx);
+
+  sageTex->loadPixelBlocks(copies, num);
+}
+
 void sageMontage::uploadTexture()
 {
   sageTex->uploadTexture();
@@ -153,6 +168,25 @@ void sageMontage::deleteTexture()
   sageTex->deleteTexture();
 }
 
+void sageMontage::reserveTexture(int w, int h)
+{
+  context->switchContext(tileIdx);
+
+  sageTex->reserve(w, h);
+}
+
+void sageMontage::reset()
+{
+  depth = 1.0;
+  monIdx = -1;
+  visible = true;
+  winID = 0;
+  otherMontage = NULL;
+  lastTime = 0;
+  doFade = true;
+  alpha = 0;
+}
+
 void sageMontage::draw(int _tempAlpha)
 {
   sageTex->draw(depth, alpha, _tempAlpha, left, right, bottom, top);
@@ -181,7 +215,7 @@ void sageMontage::update(double now)
 
 
 sageDisplay::sageDisplay(displayContext *dct, struct sageDisplayConfig &cfg):
-  context(dct), dirty(false), drawObj(dirty, cfg), activetile(-1), numframes(0)
+  context(dct), dirty(false), drawObj(dirty, tileDamage, cfg), activetile(-1), numframes(0)
 {
   configStruct = cfg;
   tileNum = cfg.dimX * cfg.dimY;
@@ -189,12 +223,17 @@ sageDisplay::sageDisplay(displayContext *dct, struct sageDisplayConfig &cfg):
     SAGE_PRINTLOG("sageDisplay::init() : The tile number exceeds the maximum");
   }
 
+  for (int i=0; i<MAX_TILES_PER_NODE; i++)
+    tileDamage[i] = DAMAGE_FRAMES;
+
   for (int i=0; i<tileNum; i++) {
     noOfMontages[i] = 0;
     for (int j=0; j<MAX_MONTAGE_NUM; j++)
       montages[i][j] = NULL;
   }
 
+  capture = new sageScreenCapture(tileNum, cfg.width, cfg.height);
+
 #if defined(WIN32)
   SAGE_PRINTLOG("Init GL functions: %p %p\n", glCompressedTexImage2D, glCompressedTexSubImage2D);
   glCompressedTexImage2D  = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)
@@ -209,7 +248,7 @@ sageDisplay::sageDisplay(displayContext *dct, struct sageDisplayConfig &cfg):
 int sageDisplay::changeBGColor(int red, int green, int blue)
 {
   context->changeBackground(red, green, blue);
-  dirty = true;
+  setDirty();
 
   return 0;
 }
@@ -229,6 +268,7 @@ int sageDisplay::addMontage(sageMontage *mon)
   for (int i=0; i<MAX_MONTAGE_NUM; i++) {
     if (montages[mon->tileIdx][i] == NULL) {
       montages[mon->tileIdx][i] = mon;
+      montagesById[mon->tileIdx][mon->winID] = mon;
       mon->monIdx = i;
       if (i+1 > noOfMontages[mon->tileIdx])
         noOfMontages[mon->tileIdx] = i+1;
@@ -251,7 +291,11 @@ int sageDisplay::removeMontage(sageMontage *mon)
     return 0;
 
   montages[mon->tileIdx][mon->monIdx] = NULL;
+  if (montagesById[mon->tileIdx].count(mon->winID) > 0 &&
+      montagesById[mon->tileIdx][mon->winID] == mon)
+    montagesById[mon->tileIdx].erase(mon->winID);
   mon->monIdx = -1;
+  damageTile(mon->tileIdx);
 
   return 0;
 }
@@ -268,6 +312,8 @@ int sageDisplay::replaceMontage(sageMontage *mon)
 
   mon->visible = true;
   montages[mon->tileIdx][mon->monIdx] = mon;
+  montagesById[mon->tileIdx][mon->winID] = mon;
+  damageTile(mon->tileIdx);
 
   if (mon->sageTex->needsUpload()) {
     mon->uploadTexture();
@@ -284,7 +330,9 @@ void sageDisplay::onAppShutdown(int winID)
 void sageDisplay::update()
 {
   double currentTime = sage::getTime();  // in microsecs
-  bool doRefresh = false;
+
+  // hand the finished readbacks to the capture workers
+  capture->poll();
 
   for (int i=0; i<tileNum; i++)   {
     for (int j=0; j<noOfMontages[i]; j++) {
@@ -302,7 +350,7 @@ void sageDisplay::update()
         }
         else {
           if (mon->doFade)
-            doRefresh = true;
+            damageTile(i);
 
           mon->update(currentTime);
 
@@ -314,25 +362,28 @@ void sageDisplay::update()
     }
   }
 
-  if (doRefresh)
-    dirty = true;
-
   drawObj.update();
 }
 
+// The area of tile i in window coordinates
+sageRect sageDisplay::getTileViewport(int i)
+{
+  sageRect tileRect = configStruct.tileRect[i];
+  tileRect.updateBoundary();
+
+  tileRect.x = (i % configStruct.dimX) * configStruct.width;
+  tileRect.y = (i / configStruct.dimX) * configStruct.height;
+
+  return tileRect;
+}
+
 // Setup a tile for display
 // optimization; if only one tile per machine (no setup over and over)
 // - Luc -
 void sageDisplay::setupTile(int i)
 {
   if (i != activetile) {
-    sageRect tileRect = configStruct.tileRect[i];
-    tileRect.updateBoundary();
-
-    int tileX = (i % configStruct.dimX) * configStruct.width;
-    int tileY = (i / configStruct.dimX) * configStruct.height;
-    tileRect.x = tileX;
-    tileRect.y = tileY;
+    sageRect tileRect = getTileViewport(i);
 
     context->setupViewport(i, tileRect);
     glMatrixMode(GL_PROJECTION);
@@ -360,32 +411,50 @@ void sageDisplay::setupTile(int i)
 int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool drawOverlays)
 {
   static double pixel_time = sage::getTime();
+  static int refreshNum = 0;
   //SAGE_PRINTLOG("UpdateScreen - %d", barrierFlag);
 
-  context->clearScreen();
+  double drawStart = sage::getTime();
+
+  // trace times are wall clock times
+  sageTrace &trace = sageTrace::instance();
+  double traceBase = trace.now() - drawStart;
+  refreshNum++;
+
+  // the screenshot pass and contexts that can't clear a single tile
+  // need every tile, otherwise only the tiles damaged since the back
+  // buffer was drawn are redrawn. Without a known buffer age the back
+  // buffer may hold anything, so everything is redrawn then too
+  int age = context->bufferAge();
+  bool partial = (drawOverlays && context->canClearTile() && age > 0 && age <= DAMAGE_FRAMES);
+  int stale = DAMAGE_FRAMES - age;   // damage counters at or below this are in the back buffer
+
+  int damagedTiles = 0;
+  for (int i=0; i<tileNum; i++)
+    if (tileDamage[i] > stale)
+      damagedTiles++;
+
+  bool fullRedraw = (!partial || damagedTiles == tileNum);
+  if (fullRedraw)
+    context->clearScreen();
+
+  // the apps sorted by z order (cached until a depth changes)
+  std::vector<int> &appsByZ = drawObj.getAppsByZ();
 
   for (int i=0; i<tileNum; i++)   {
+    if (!fullRedraw && tileDamage[i] <= stale)
+      continue;
+
     // Prepare the OpenGL context (viewport, settings, ...)
     setupTile(i);
 
-    // for drawing minimized apps later
-    std::vector<sageMontage*>minimizedMontages;
-
-    // first, sort the apps by z order
-    std::map<float, int>appsByZ;
-    std::map<const int, appInfo>::iterator iter;
-    for (iter = drawObj.apps.begin(); iter != drawObj.apps.end(); iter++) {
-      appsByZ[(*iter).second.z] = (*iter).first;
+    if (!fullRedraw) {
+      sageRect viewport = getTileViewport(i);
+      context->clearTile(i, viewport);
     }
 
-
-    // draw montages in order... so first sort them by depth
-    std::map<int, sageMontage*>montagesById;
-    for (int j=0; j<noOfMontages[i]; j++) {
-      sageMontage *mon = montages[i][j];
-      if (mon)
-        montagesById[ mon->winID ] = mon;
-    }
+    // for drawing minimized apps later
+    std::vector<sageMontage*>minimizedMontages;
 
     sageRect tileRect = configStruct.tileRect[i];
 
@@ -394,15 +463,16 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
       drawObj.draw(tileRect, SAGE_PRE_DRAW);
 
     // now draw all the apps and their overlays in order based on app z
-    // (reverse order of appsByZ map)
-    std::map<float, int>::reverse_iterator rit;
+    // (reverse order of appsByZ)
+    std::vector<int>::reverse_iterator rit;
     for (rit = appsByZ.rbegin(); rit != appsByZ.rend(); rit++)
     {
       // does the montage for this app exist on this tile?
       // If so, draw it, if not still draw it's overlays
       sageMontage *mon = NULL;
-      if (montagesById.count((*rit).second) > 0) {
-        mon = montagesById[(*rit).second];
+      std::map<int, sageMontage*>::iterator found = montagesById[i].find(*rit);
+      if (found != montagesById[i].end()) {
+        mon = (*found).second;
       }
 
 
@@ -410,7 +480,7 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
       {
         // start fading out the app if we are closing it
         int tempAlpha = -1;
-        overlayApp * appOverlay = (overlayApp*) drawObj.getAppOverlay((*rit).second);
+        overlayApp * appOverlay = (overlayApp*) drawObj.getAppOverlay(*rit);
         if (appOverlay && appOverlay->closing)
           tempAlpha = (int) 255 * appOverlay->curtainAlpha;
 
@@ -419,7 +489,7 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
 
         // draw the app-related overlays
         if (drawOverlays)
-          drawObj.draw(tileRect, SAGE_INTER_DRAW, (*rit).second);
+          drawObj.draw(tileRect, SAGE_INTER_DRAW, *rit);
       }
       else if(mon && (drawObj.apps[mon->winID]).minimized) {
         // we will draw minimized apps on top, later
@@ -429,7 +499,7 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
       else {
         // draw the app-related overlays
         if (drawOverlays)
-          drawObj.draw(tileRect, SAGE_INTER_DRAW, (*rit).second);
+          drawObj.draw(tileRect, SAGE_INTER_DRAW, *rit);
       }
     }
 
@@ -455,8 +525,27 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
 
     context->refreshTile(i);
 
+    // damaged since the last pass, not just redrawn into an older back buffer
+    if (tileDamage[i] == DAMAGE_FRAMES)
+      capture->tileDamaged(i);
   }
 
+  // one more swap since each tile was damaged
+  for (int i=0; drawOverlays && i<tileNum; i++)
+    if (tileDamage[i] > 0)
+      tileDamage[i]--;
+
+  // the next pass has to put the overlays back everywhere
+  if (!drawOverlays)
+    setDirty();
+  else if (capture->recordDue())
+    recordFrame();
+
+  double barrierStart = sage::getTime();
+  telemetry.observe(telDraw, (long long)(barrierStart - drawStart));
+  telemetry.add(telRefresh);
+  trace.record(TRACE_DRAW, -1, refreshNum, drawStart + traceBase, barrierStart + traceBase);
+
   /** BARRIER **/
 
   if ( barrierFlag ) {
@@ -465,6 +554,9 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
     shared->syncClientObj->recvRefreshBarrier(false); // blocking (set true for nonblock)
     //SAGE_PRINTLOG("node %d recved frm barrier\n", shared->nodeID);
 
+    double barrierEnd = sage::getTime();
+    telemetry.observe(telBarrier, (long long)(barrierEnd - barrierStart));
+    trace.record(TRACE_BARRIER, -1, refreshNum, barrierStart + traceBase, barrierEnd + traceBase);
   }
 
 #ifdef DELAY_COMPENSATION
@@ -491,8 +583,10 @@ int sageDisplay::updateScreen(dispSharedData *shared, bool barrierFlag, bool dra
 
   glFlush();
   if (drawOverlays) {
+    double swapStart = sage::getTime();
     context->refreshScreen();  // actual swapBuffer occurs in here at displayConext's instance
     dirty = false;
+    trace.record(TRACE_SWAP, -1, refreshNum, swapStart + traceBase, sage::getTime() + traceBase);
   }
 
 #if 0
@@ -587,72 +681,63 @@ void sageDisplay::drawAppShadow(int winID)
 
 
 
-void sageDisplay::saveScreenshot(char *data)
+void sageDisplay::getWallTile(int i, int &tileX, int &tileY)
 {
-  // first redraw once without the overlays... we don't want them in the screenshot
-  //updateScreen(NULL, false, false);
+  sageRect tileRect = configStruct.tileRect[i];
+  tileRect.updateBoundary();
+
+  // Luc changed
+  tileX = (int) (tileRect.right / configStruct.width) -1;
+  tileY = (int) (tileRect.top / configStruct.height) -1;
+}
 
-  unsigned char *rgbBuffer;
+void sageDisplay::saveScreenshot(char *data)
+{
   char saveDir[512];   // just the directory where to save the files
-  char imagePath[512];  // includes image names as well
-  int dispW, dispH, numX, numY;  // total sage display w and h
-  int tileOffsetX, tileOffsetY, tileX, tileY;
+  char imageName[512];
+  int dispW, dispH;  // total sage display w and h
+  int tileX, tileY;
   int downsize;  // should the images be downsized? NO if we are just grabbing a section of the display
   sscanf((char *)data, "%s %d %d %d", saveDir, &downsize, &dispW, &dispH);
   //SAGE_PRINTLOG("data [%s] - %s %d %d %d", data, saveDir, downsize, dispW, dispH);
 
-  // We do RGB readback, so alignment should be 1, not 4 (default)
-  int align;
-  glGetIntegerv(GL_PACK_ALIGNMENT, &align);
-  glPixelStorei(GL_PACK_ALIGNMENT, 1);
-
-  glReadBuffer(GL_BACK);
+  // the tiles are read back asynchronously, then flipped and written
+  // as JPEG by the capture workers
   for (int i=0; i<tileNum; i++)   {
+    getWallTile(i, tileX, tileY);
+    sprintf(imageName, "screen-%d-%d.jpg", tileX, tileY);
 
-    sageRect tileRect = configStruct.tileRect[i];
-    tileRect.updateBoundary();
-
-    tileOffsetX = (i % configStruct.dimX) * configStruct.width;
-    tileOffsetY = (i / configStruct.dimX) * configStruct.height;
-
-    numX = sage::round(dispW / (float)tileRect.width);
-    numY = sage::round(dispH / (float)tileRect.height);
-
-    //tileX = numX - (int) roundf(dispW / (float)tileRect.right);
-    //tileY = numY - (int) roundf(dispH / (float)tileRect.top);
-    // Luc changed
-    tileX = (int) (tileRect.right / configStruct.width) -1;
-    tileY = (int) (tileRect.top / configStruct.height) -1;
-
-    // make the full path to the image
-    sprintf(imagePath, "%s/screen-%d-%d.jpg", saveDir, tileX, tileY);
-
-    // read the framebuffer
-    rgbBuffer = (unsigned char *) malloc( configStruct.width*configStruct.height*3 );
-    memset(rgbBuffer, 0, configStruct.width*configStruct.height*3 );
-    glReadPixels(tileOffsetX, tileOffsetY, configStruct.width, configStruct.height, GL_RGB, GL_UNSIGNED_BYTE, rgbBuffer);
-    glFinish();
-    //SAGE_PRINTLOG("Reading: %d x %d  - %d x %d - size %d", tileOffsetX, tileOffsetY, configStruct.width, configStruct.height, configStruct.width*configStruct.height*3);
+    sageRect viewport = getTileViewport(i);
+    capture->readTile(CAPTURE_SCREENSHOT, viewport.x, viewport.y, saveDir, imageName);
+  }
+}
 
-    // Now using RLK image functions (see image.h)
-    image_flip(configStruct.width, configStruct.height, 3, 1, rgbBuffer);
-    image_write(imagePath, configStruct.width, configStruct.height, 3, 1, rgbBuffer);
+void sageDisplay::recordWall(char *data)
+{
+  capture->setRecording(data);
+}
 
-    free(rgbBuffer);
+void sageDisplay::recordFrame()
+{
+  int tileX, tileY;
 
-    //SAGE_PRINTLOG("Tile %d of %d -- %d x %d -- Screenshot saved to: %s", i, tileNum, tileX, tileY, imagePath);
-    //SAGE_PRINTLOG("\t tileX: numX %d dispW %d tileRect.right %f -> %d", numX, dispW, tileRect.right, tileX);
-    //SAGE_PRINTLOG("\t tile offset %d x %d - round %d", tileOffsetX, tileOffsetY, (int) roundf(dispW / (float)tileRect.right) );
+  for (int i=0; i<tileNum; i++)   {
+    getWallTile(i, tileX, tileY);
+    sageRect viewport = getTileViewport(i);
+    capture->recordTile(i, viewport.x, viewport.y, tileX, tileY);
   }
-
-  // restore the alignment values, in case so other code changed it
-  glPixelStorei(GL_PACK_ALIGNMENT, align);
 }
 
 int sageDisplay::addDrawObjectInstance(char *data)
 {
   drawObj.addObjectInstance(data);
-  dirty = true;
+
+  return 0;
+}
+
+int sageDisplay::addDrawObjectInstance(drawObjectRecord *rec)
+{
+  drawObj.addObjectInstance(rec);
 
   return 0;
 }
@@ -660,7 +745,6 @@ int sageDisplay::addDrawObjectInstance(char *data)
 int sageDisplay::updateObjectPosition(char *data)
 {
   drawObj.updateObjectPosition(data);
-  dirty = true;
 
   return 0;
 }
@@ -670,7 +754,6 @@ int sageDisplay::removeDrawObject(char *data)
   int id;
   sscanf(data, "%d", &id);
   drawObj.removeObject(id);
-  dirty = true;
 
   return 0;
 }
@@ -678,7 +761,6 @@ int sageDisplay::removeDrawObject(char *data)
 int sageDisplay::forwardObjectMessage(char *data)
 {
   drawObj.forwardObjectMessage(data);
-  dirty = true;
 
   return 0;
 }
@@ -686,7 +768,6 @@ int sageDisplay::forwardObjectMessage(char *data)
 int sageDisplay::showObject(char *data)
 {
   drawObj.showObject(data);
-  dirty = true;
 
   return 0;
 }
@@ -694,7 +775,6 @@ int sageDisplay::showObject(char *data)
 int sageDisplay::updateAppBounds(int winID, int x, int y, int w, int h, sageRotation orientation)
 {
   drawObj.updateAppBounds(winID, x, y, w, h, orientation);
-  dirty = true;
 
   return 0;
 }
@@ -705,7 +785,6 @@ int sageDisplay::updateAppBounds(char *data)
   int x,y,w,h,winID;
   sscanf(data, "%d %d %d %d %d %d", &winID, &x, &y, &w, &h, (int *)&orientation);
   updateAppBounds(winID, x, y, w, h, orientation);
-  dirty = true;
 
   return 0;
 }
@@ -713,7 +792,6 @@ int sageDisplay::updateAppBounds(char *data)
 int sageDisplay::updateAppDepth(int winID, float depth)
 {
   drawObj.updateAppDepth(winID, depth);
-  dirty = true;
 
   return 0;
 }
@@ -721,6 +799,7 @@ int sageDisplay::updateAppDepth(int winID, float depth)
 
 sageDisplay::~sageDisplay()
 {
+  delete capture;
 } //End of sageDisplay::~sageDisplay()
 
 
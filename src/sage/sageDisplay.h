@@ -159,6 +159,7 @@ void  __msecDelay_RDTSC ( int& msec)
 
 class sageBlock;
 class sagePixelBlock;
+class sageScreenCapture;
 
 
 // The following structure holds the parameters of the montage comprising the final window
@@ -193,8 +194,11 @@ public:
   bool checkDispInfo(sagePixelBlock *block);
   void renewTexture();
   void deleteTexture();
+  void reserveTexture(int w, int h);
+  void reset(); // back to the state of a new montage, the texture is kept
   void genTexCoord();
   void loadPixelBlock(sagePixelBlock *block);  // load a pixel block into texture memory
+  void loadPixelBlocks(sageBlockCopy *copies, int num);  // load blocks sorted with sageBlockCopyOrder
   void update(double now);
   void setAlpha(int a);
 
@@ -224,11 +228,17 @@ protected:
   sageDisplayConfig configStruct;
   sageMontage*      montages[MAX_TILES_PER_NODE][MAX_MONTAGE_NUM];
   int      noOfMontages[MAX_TILES_PER_NODE];
+  std::map<int, sageMontage*> montagesById[MAX_TILES_PER_NODE];
+  int      tileDamage[MAX_TILES_PER_NODE]; // refreshes left before a tile is clean
   int      tileNum;
   bool     dirty;
   int      activetile;
   long     numframes;
   sageDraw drawObj;
+  sageScreenCapture *capture;  // screenshots and wall recording
+
+  void getWallTile(int i, int &tileX, int &tileY);  // position of tile i in the whole wall
+  void recordFrame();
 
 public:
   sageDisplay(displayContext *dct, struct sageDisplayConfig &cfg);
@@ -240,7 +250,9 @@ public:
   int changeBGColor(int red, int green, int blue);
 
   void saveScreenshot(char *data);
+  void recordWall(char *data);  // "dir [interval in ms]" or "stop"
   int addDrawObjectInstance(char *data);
+  int addDrawObjectInstance(drawObjectRecord *rec);
   int updateObjectPosition(char *data);
   int removeDrawObject(char *data);
   int forwardObjectMessage(char *data);
@@ -252,8 +264,11 @@ public:
   void drawAppShadow(int winID);
   void drawAppMontage(sageMontage *mon, int tempAlpha=-1);
   void setupTile(int i);
+  sageRect getTileViewport(int i);
 
-  inline void setDirty() { dirty = true; }
+  inline void setDirty() { drawObj.setDirty(); }
+  inline void damageTile(int idx) { drawObj.damageTile(idx); }
+  inline void damageRect(sageRect &rect) { drawObj.damageRect(rect); }
   inline bool isDirty() { return dirty; }
   inline sageRect& getTileRect(int idx) { return configStruct.tileRect[idx]; }
   inline int getTileNum() { return tileNum; }
@@ -46,6 +46,14 @@
 #include "sageReceiver.h"
 #include "sageSync.h"
 #include "sageDisplay.h"
+#include "sageDrawTemplate.h"
+#include "sageResourcePool.h"
+#include "sageTelemetry.h"
+#include "sageTrace.h"
+#include "sageClock.h"
+#include "sageAffinity.h"
+
+static int telApps = sageTelemetry::instance().gauge("sage_sdm_apps", "apps streaming to the display node");
 #include "sageTcpModule.h"
 #include "sageUdpModule.h"
 #include "pixelDownloader.h"
@@ -190,7 +198,6 @@ sageDisplayManager::sageDisplayManager(int argc, char **argv) : syncServerObj(NU
   }
 
   rcvEnd = false;
-  sprintf(CLEAR_STR, "0 0 0 0 0 0");
 
   pthread_t thId;
 
@@ -238,6 +245,15 @@ int sageDisplayManager::init(char *data)
     return -1;
   }
 
+  getToken(data, token);
+  int poolSize = atoi(token);
+  getToken(data, token);
+  int prewarmNum = atoi(token);
+  getToken(data, token);
+  sagePixFmt prewarmFmt = (sagePixFmt)atoi(token);
+  getToken(data, token);
+  shared->avDelay = atoi(token)*1000.0;
+
   getToken(data, masterIp);
 
   getToken(data, token);
@@ -268,11 +284,20 @@ int sageDisplayManager::init(char *data)
       dispCfg.tileRect[i*dimX + j].y = atoi(token);
       dispCfg.tileRect[i*dimX + j].width = screenWidth;
       dispCfg.tileRect[i*dimX + j].height = screenHeight;
-      getToken(data, token);
+      tokenNum = getToken(data, token);
       revY[i*dimX + j] = atoi(token);
     }
   }
 
+  // thread placement of the node, "name=spec" to the end
+  while (tokenNum > 0) {
+    tokenNum = getToken(data, token);
+    sageAffinity::instance().set(token);
+  }
+
+  // the threads started from here on inherit the cpus of this one
+  sageAffinity::instance().bind("display");
+
   //shared->tileTable.generateTable();
 
   //SAGE_PRINTLOG("SDM::init() : SDM %d init message has successfully parsed",shared->nodeID);
@@ -313,6 +338,17 @@ int sageDisplayManager::init(char *data)
   //SAGE_PRINTLOG("sageDisplayManager::init() : SDM %d is creating sageDisplay object", shared->nodeID);
   shared->displayObj = new sageDisplay(shared->context, dispCfg);
 
+  char name[SAGE_NAME_LEN], labels[SAGE_NAME_LEN];
+  sprintf(name, "sdm-%d", shared->nodeID);
+  sprintf(labels, "proc=\"sdm\",node=\"%d\"", shared->nodeID);
+  sageTelemetry::instance().startExport(name, labels);
+  sageTrace::instance().start(name);
+
+  // textures and buffers of closed apps are kept for the next ones
+  shared->resPool = new sageResourcePool(shared, poolSize);
+  if (prewarmNum > 0)
+    shared->resPool->prewarm(prewarmFmt, prewarmNum);
+
   if (initNetworks() < 0)
     return -1;
 
@@ -415,6 +451,18 @@ void* sageDisplayManager::msgCheckThread(void *args)
     msg = new sageMessage;
     if (This->rcvMessageBlk(*msg) > 0 && !This->rcvEnd) {
       //SAGE_PRINTLOG("message arrive");
+
+      // widgets are parsed here and not on the display thread, the
+      // display thread only gets the ids and the parsed template
+      if (msg->getCode() == ADD_OBJECT) {
+        drawObjectRecord *rec = sageDrawTemplateCache::instance().prepare((char *)msg->getData());
+        if (rec)
+          This->shared->eventQueue->sendEvent(EVENT_NEW_OBJECT, 0, (void *)rec);
+        msg->destroy();
+        delete msg;
+        continue;
+      }
+
       This->shared->eventQueue->sendEvent(EVENT_NEW_MESSAGE, 0, (void *)msg);
 
 
@@ -437,6 +485,7 @@ void* sageDisplayManager::syncCheckThread(void *args)
   static int printmessage = 1;
   sageDisplayManager *This = (sageDisplayManager *)args;
   SAGE_PRINTLOG("sageDisplayManager::syncCheckThread() has started at SDM %d", This->shared->nodeID);
+  sageAffinity::instance().bind("sync");
 
   int syncMsgLen = -1;
   while (!This->rcvEnd) {
@@ -465,6 +514,12 @@ void* sageDisplayManager::syncCheckThread(void *args)
 
     char *syncMsg = syncEvent->eventMsg;
     if (This->shared->syncClientObj->waitForSync(syncMsg, syncMsgLen) == 0) {
+      if (This->syncLevel > 0) {
+        int *intMsg = (int *)syncMsg;
+        sageClock &clock = sageClock::instance();
+        clock.addSample((double)intMsg[1]*1000000.0 + intMsg[2], clock.local());
+      }
+
       //SAGE_PRINTLOG("rcv sync %s", syncEvent->eventMsg);
       /**
        * This is important !
@@ -620,6 +675,14 @@ int sageDisplayManager::initStreams(char *msg, streamProtocol *nwObj)
 }
 
 
+void sageDisplayManager::presentHeldFrames()
+{
+  for (int i=0; i<downloaderList.size(); i++) {
+    if (downloaderList[i]->getStatus() == PDL_WAIT_PTS)
+      downloaderList[i]->checkPresentTime();
+  }
+}
+
 pixelDownloader* sageDisplayManager::findApp(int id, int& index)
 {
   pixelDownloader* temp_app= NULL;
@@ -728,13 +791,23 @@ int sageDisplayManager::updateDisplay(char *msg)
   return 0;
 }
 
-int sageDisplayManager::clearDisplay(int instID)
+int sageDisplayManager::clearDisplay(char *msg)
 {
+  int instID, confID;
+  sscanf(msg, "%d %d", &instID, &confID);
+
+  // an empty window layout under the configuration ID of the message
+  char clearStr[TOKEN_LEN];
+  sprintf(clearStr, "%d 0 0 0 0 0 0", confID);
+
   int index;
   pixelDownloader*  temp_app = findApp(instID, index);
 
-  if (temp_app)
-    temp_app->enqueConfig(CLEAR_STR);
+  if (temp_app) {
+    temp_app->enqueConfig(clearStr);
+    if (temp_app->getStatus() == PDL_WAIT_CONFIG)
+      temp_app->fetchSageBlocks();
+  }
   else {
     /*
       if (reconfigStr[instID]) {
@@ -746,8 +819,8 @@ int sageDisplayManager::clearDisplay(int instID)
     dwloader->instID = instID;
     downloaderList.push_back(dwloader);
 
-    char* str_config = new char[strlen(CLEAR_STR)+1];
-    strcpy(str_config, CLEAR_STR);
+    char* str_config = new char[strlen(clearStr)+1];
+    strcpy(str_config, clearStr);
     reconfigStr.push_back(str_config);
     //SAGE_PRINTLOG("sageDisplayManager::clearDisplay() : valify size %d = %d",downloaderList.size(), reconfigStr.size());
   }
@@ -818,13 +891,20 @@ int sageDisplayManager::parseEvent(sageEvent *event)
     break;
   }
 
+  case EVENT_NEW_OBJECT : {
+    shared->displayObj->addDrawObjectInstance((drawObjectRecord *)event->param);
+    break;
+  }
+
   case EVENT_SYNC_MESSAGE : {
+    presentHeldFrames();
     //processSync((char *)event->eventMsg);
     processSync( event );
     break;
   }
 
   case EVENT_REFRESH_SCREEN : {
+    presentHeldFrames();
     shared->displayObj->update(); // without this nothing will be displayed
     if ( shared->displayObj->isDirty() )
       shared->displayObj->updateScreen(shared, false); // barrier flag false
@@ -858,6 +938,22 @@ int sageDisplayManager::parseEvent(sageEvent *event)
     }
     break;
   }
+
+  case EVENT_FIRST_FRAME : {
+    int instID;
+    double setupTime, firstTime;
+    sscanf((char *)event->eventMsg, "%d %lf %lf", &instID, &setupTime, &firstTime);
+
+    char info[TOKEN_LEN];
+    sprintf(info, "%d %d %.2f %.2f", instID, shared->nodeID, setupTime/1000.0, firstTime/1000.0);
+    sendMessage(DISP_APP_FIRST_FRAME, info);
+
+    char poolInfo[TOKEN_LEN];
+    shared->resPool->getPoolInfo(poolInfo);
+    SAGE_PRINTLOG("[%d] SDM : app %d first frame %.2f ms after setup started (setup %.2f ms), %s",
+                  shared->nodeID, instID, firstTime/1000.0, setupTime/1000.0, poolInfo);
+    break;
+  }
   }
 
   delete event;
@@ -890,7 +986,7 @@ int sageDisplayManager::parseMessage(sageMessage *msg)
   }
 
   case RCV_CLEAR_DISPLAY : {
-    clearDisplay(atoi((char *)msg->getData()));
+    clearDisplay((char *)msg->getData());
     break;
   }
 
@@ -941,6 +1037,24 @@ int sageDisplayManager::parseMessage(sageMessage *msg)
     break;
   }
 
+  case RECORD_WALL : {
+    shared->displayObj->recordWall((char *)msg->getData());
+    break;
+  }
+
+  case RECORD_STREAM : {
+    int instID, index;
+    char dir[SAGE_NAME_LEN];
+    if (sscanf((char *)msg->getData(), "%d %255s", &instID, dir) < 2)
+      break;
+
+    // each node records the part of the stream it receives
+    pixelDownloader *PDL = findApp(instID, index);
+    if (PDL)
+      PDL->recordStream(dir);
+    break;
+  }
+
   case ADD_OBJECT : {
     shared->displayObj->addDrawObjectInstance((char *)msg->getData());
     break;
@@ -997,7 +1111,7 @@ int sageDisplayManager::processSync(sageEvent *e)
   //std::vector<pixelDownloader*>::iterator iter;
   int index;
   int numIndex = e->buflen / sizeof(int);
-  numIndex = numIndex - 1; // The first element is the message length in Byte
+  numIndex = numIndex - SYNC_MSG_HEADER; // the message length in Byte and the master clock
   numIndex = numIndex / 2; // this is the number of app which have updated in this round
   for ( int i=0; i<numIndex; i++ ) {
     /**
@@ -1005,16 +1119,16 @@ int sageDisplayManager::processSync(sageEvent *e)
      */
     //if ( intMsg[2*i+1] < 0 ) break;
 
-    PDL = findApp(intMsg[2*i+1], index);
+    PDL = findApp(intMsg[2*i+SYNC_MSG_HEADER], index);
     if ( PDL ) {
       swapMontageDone = true;
 
 #ifdef DEBUG_SYNC
-      SAGE_PRINTLOG("[%d,%d] SDM::processSync() : It's ready for frame %d\n", shared->nodeID, intMsg[2*i], intMsg[2*i+1]);
+      SAGE_PRINTLOG("[%d,%d] SDM::processSync() : It's ready for frame %d\n", shared->nodeID, intMsg[2*i+SYNC_MSG_HEADER], intMsg[2*i+SYNC_MSG_HEADER+1]);
 #endif
 
       // trigger to swapMontage
-      PDL->processSync(intMsg[2*i+2]);
+      PDL->processSync(intMsg[2*i+SYNC_MSG_HEADER+1]);
 
       // if PDL is waiting sync
       /*
@@ -1089,7 +1203,7 @@ int sageDisplayManager::processSync(sageEvent *e)
   } // end switch(syncLevel)
 
   for ( int i=0; i<numIndex; i++ ) {
-    PDL = findApp(intMsg[2*i+1], index);
+    PDL = findApp(intMsg[2*i+SYNC_MSG_HEADER], index);
     // if PDL is waiting sync
     if (PDL  &&  PDL->getStatus() == PDL_WAIT_SYNC) {
       // wake it up
@@ -1110,6 +1224,8 @@ void sageDisplayManager::mainLoop()
 
 int sageDisplayManager::perfReport()
 {
+  sageTelemetry::instance().set(telApps, downloaderList.size());
+
   std::vector<pixelDownloader*>::iterator iter;
   pixelDownloader* temp_app= NULL;
   char *frameStr = NULL;
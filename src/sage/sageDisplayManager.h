@@ -159,12 +159,16 @@ private:
 
 
   /**
-   * it's called when a message RCV_UPDATE_DISPLAY is received from fsManager
+   * it's called when a message RCV_UPDATE_DISPLAY is received from fsManager.
+   * The message is the app instance ID, the configuration ID and the window layout
    */
   int updateDisplay(char *msg);
-  int clearDisplay(int instID);
 
-  char CLEAR_STR[TOKEN_LEN];
+  /**
+   * RCV_CLEAR_DISPLAY : the window left this display, msg is the instance ID
+   * and the configuration ID
+   */
+  int clearDisplay(char *msg);
 
   /**
    * keeps checking network connection and generates EVENT_NEW_CONNECTION event if new connection has arrived.
@@ -198,6 +202,12 @@ private:
 
   pixelDownloader* findApp(int id, int& index);
 
+  /**
+   * lets the apps holding a timestamped frame go on once the frame is due,
+   * called on every refresh and sync message
+   */
+  void presentHeldFrames();
+
 public:
   /**
    * if syncMaster is true, sageSyncServer object is created here, and sageSyncServer::init() is called.<BR>
@@ -39,6 +39,7 @@
  *****************************************************************************/
 
 #include "sageDraw.h"
+#include "sageDrawTemplate.h"
 #include "overlayApp.h"
 #include "overlayPointer.h"
 #include "overlayButton.h"
@@ -50,12 +51,16 @@
 #include "overlaySplitter.h"
 #include "overlayThumbnail.h"
 #include "overlayEnduranceThumbnail.h"
+#include <algorithm>
+#include <limits.h>
 
 
-sageDraw::sageDraw(bool &dirty, sageDisplayConfig cfg) : dirtyBit(dirty), dispCfg(cfg)
+sageDraw::sageDraw(bool &dirty, int *damage, sageDisplayConfig cfg) : dirtyBit(dirty),
+  tileDamage(damage), dispCfg(cfg), zOrderChanged(true)
 {
   dispCfg = cfg;
   displayID = cfg.displayID;
+  tileNum = MIN(cfg.dimX * cfg.dimY, MAX_TILES_PER_NODE);
   objList.clear();
   //sage::initUtil();
   sageDrawObject::initFonts();
@@ -125,9 +130,116 @@ void sageDraw::update()
 
 void sageDraw::setDirty()
 {
+  for (int i=0; i<tileNum; i++)
+    tileDamage[i] = DAMAGE_FRAMES;
   dirtyBit=true;
 }
 
+void sageDraw::setDirty(sageDrawObject *obj)
+{
+  // menus pop up outside of their own bounds
+  if ((*obj) == MENU) {
+    setDirty();
+    return;
+  }
+
+  // repaint where the object was and where it is now
+  damageRect(obj->damagedBounds);
+  obj->damagedBounds = obj->getDrawBounds();
+  damageRect(obj->damagedBounds);
+}
+
+void sageDraw::damageRect(sageRect rect)
+{
+  if (rect.width <= 0 || rect.height <= 0)
+    return;
+
+  for (int i=0; i<tileNum; i++) {
+    sageRect tileRect = dispCfg.tileRect[i];
+    if (tileRect.crop(rect)) {
+      tileDamage[i] = DAMAGE_FRAMES;
+      dirtyBit = true;
+    }
+  }
+}
+
+void sageDraw::damageTile(int idx)
+{
+  if (idx < 0 || idx >= tileNum)
+    return;
+
+  tileDamage[idx] = DAMAGE_FRAMES;
+  dirtyBit = true;
+}
+
+void sageDraw::damageApp(int winID)
+{
+  if (apps.count(winID) == 0)
+    return;
+
+  appInfo &a = apps[winID];
+  damageRect(sageRect(a.x-APP_DAMAGE_MARGIN, a.y-APP_DAMAGE_MARGIN,
+                      a.w+2*APP_DAMAGE_MARGIN, a.h+2*APP_DAMAGE_MARGIN));
+
+  // the overlays tied to the app may reach outside of the app itself
+  std::map<std::pair<int,int>, std::map<int, sageDrawObject *> >::iterator iter;
+  for (iter = drawIndex.lower_bound(std::make_pair(winID, INT_MIN));
+       iter != drawIndex.end() && (*iter).first.first == winID; iter++) {
+    std::map<int, sageDrawObject *>::iterator it;
+    for (it = (*iter).second.begin(); it != (*iter).second.end(); it++)
+      setDirty((*it).second);
+  }
+}
+
+// sort by z and then by winID so that the order is stable
+static bool zOrderLess(const std::pair<float,int> &a, const std::pair<float,int> &b)
+{
+  if (a.first != b.first)
+    return a.first < b.first;
+  return a.second < b.second;
+}
+
+std::vector<int>& sageDraw::getAppsByZ()
+{
+  // apps may have been added through the apps[] operator too
+  if (zOrderChanged || zOrder.size() != apps.size()) {
+    std::vector<std::pair<float,int> > byZ;
+    std::map<const int, appInfo>::iterator iter;
+    for (iter = apps.begin(); iter != apps.end(); iter++)
+      byZ.push_back(std::make_pair((*iter).second.z, (*iter).first));
+    std::sort(byZ.begin(), byZ.end(), zOrderLess);
+
+    zOrder.clear();
+    for (int i=0; i<byZ.size(); i++)
+      zOrder.push_back(byZ[i].second);
+    zOrderChanged = false;
+  }
+
+  return zOrder;
+}
+
+void sageDraw::addToIndex(int id, sageDrawObject *obj)
+{
+  if ((*obj) == MENU)
+    menuIndex[id] = obj;
+
+  // only the top-level parents are drawn directly
+  if (displayID == obj->displayID && obj->parentID == -1)
+    drawIndex[std::make_pair(obj->winID, obj->drawOrder)][id] = obj;
+}
+
+void sageDraw::removeFromIndex(int id, sageDrawObject *obj)
+{
+  menuIndex.erase(id);
+
+  std::pair<int,int> key = std::make_pair(obj->winID, obj->drawOrder);
+  if (drawIndex.count(key) > 0) {
+    drawIndex[key].erase(id);
+    if (drawIndex[key].empty())
+      drawIndex.erase(key);
+  }
+}
+
 
 // Draw the parents that are of the specified drawOrder and
 // that are related to specified winID.
@@ -138,33 +250,19 @@ void sageDraw::setDirty()
 
 void sageDraw::draw(sageRect rect, int drawOrder, int winID)
 {
-  std::vector<sageDrawObject*>menuObjects;
-
   GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
 
-  // loop through all the widgets, find the ones with the
-  // corresponding drawOrder and draw them
-  std::map<const int, sageDrawObject *>::iterator iter;
-  for (iter = objList.begin(); iter != objList.end(); iter++) {
-
-    // if we are drawing global widgets, remember to draw all
-    // the menus because they should be drawn on top of everything
-    if (drawOrder == SAGE_INTER_DRAW && winID == -1 &&
-        (*(*iter).second) == MENU)
-      menuObjects.push_back((*iter).second);
-
-    // draw the object if it satisfies all the criteria
-    if ((*iter).second &&
-        (*iter).second->visible &&
-        displayID==(*iter).second->displayID &&
-        (*iter).second->drawOrder == drawOrder &&
-        (winID == (*iter).second->winID) &&
-        (*iter).second->parentID == -1)   // top-level parents only
-    {
-
-      //(*iter).second->setViewport(rect);
-      (*iter).second->redraw();
-      glColor4f(1.0, 1.0, 1.0, 1.0);   // reset the color
+  // only look at the widgets with the corresponding winID and drawOrder
+  std::map<std::pair<int,int>, std::map<int, sageDrawObject *> >::iterator index;
+  index = drawIndex.find(std::make_pair(winID, drawOrder));
+  if (index != drawIndex.end()) {
+    std::map<int, sageDrawObject *>::iterator iter;
+    for (iter = (*index).second.begin(); iter != (*index).second.end(); iter++) {
+      if ((*iter).second->visible) {
+        //(*iter).second->setViewport(rect);
+        (*iter).second->redraw();
+        sageDrawBatch::overlay().color(1.0, 1.0, 1.0, 1.0);   // reset the color
+      }
     }
   }
 
@@ -174,11 +272,16 @@ void sageDraw::draw(sageRect rect, int drawOrder, int winID)
     delayedDrawQueue.pop();
   }
 
-  // finally draw the menus
-  if (!menuObjects.empty())
-    for(int i=0; i<menuObjects.size(); i++)
-      ((overlayMenu*)menuObjects[i])->drawMenu();
+  // if we are drawing global widgets, draw all the menus last
+  // because they should be drawn on top of everything
+  if (drawOrder == SAGE_INTER_DRAW && winID == -1) {
+    std::map<int, sageDrawObject *>::iterator iter;
+    for (iter = menuIndex.begin(); iter != menuIndex.end(); iter++)
+      ((overlayMenu*)(*iter).second)->drawMenu();
+  }
 
+  // everything recorded for this pass goes out in a few draw calls
+  sageDrawBatch::overlay().flush();
 
   GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
 
@@ -193,32 +296,33 @@ void sageDraw::delayDraw(sageDrawObject *obj)
 // add object instances to be drawn in run-time
 int sageDraw::addObjectInstance(char *data)
 {
-  char objectType[SAGE_NAME_LEN];
-  int objID, widgetID, winID;
+  drawObjectRecord *rec = sageDrawTemplateCache::instance().prepare(data);
+  if (!rec)
+    return 1;
 
-  // parse the first part before the xml document
-  sscanf(data, "%d %s %d %d", &objID, &objectType, &widgetID, &winID);
+  return addObjectInstance(rec);
+}
 
-  // parse the beginning of the xml document
-  TiXmlDocument xml;
-  xml.Parse(sage::tokenSeek(data, 4));
-  if (xml.Error()) {
-    SAGE_PRINTLOG("\n\nError while parsing drawObject XML: %s\n",xml.ErrorDesc());
-    return 1;
-  }
+// same, from a record prepared by the message thread
+int sageDraw::addObjectInstance(drawObjectRecord *rec)
+{
+  sageDrawTemplate *tmpl = rec->tmpl;
+  int objID = rec->objID;
 
   // create the draw object based on the type
-  sageDrawObject *newInst = createDrawObject(objectType);
+  sageDrawObject *newInst = createDrawObject(tmpl->objectType);
   if (!newInst)  {
-    SAGE_PRINTLOG("\n\nNo object created for type: %s\n", objectType);
+    SAGE_PRINTLOG("\n\nNo object created for type: %s\n", tmpl->objectType);
+    sageDrawTemplateCache::instance().release(rec);
     return 1;
   }
 
-  // the object will parse the rest of the info from xml
-  newInst->parseXml(xml.RootElement());
-  newInst->widgetID = widgetID;
-  newInst->winID = winID;
-  newInst->init(objID, this, objectType);
+  // the object will parse the rest of the info from its xml, with the shared graphics
+  newInst->parseXml(rec->widget, tmpl);
+  newInst->widgetID = rec->widgetID;
+  newInst->winID = rec->winID;
+  newInst->init(objID, this, tmpl->objectType);
+  sageDrawTemplateCache::instance().release(rec);
 
   //if (winID > -1)
   //SAGE_PRINTLOG("===>>>> ADDING DISP OBJECT: widgetID %d, winID %d\n", newInst->widgetID, newInst->winID);
@@ -246,7 +350,11 @@ int sageDraw::addObjectInstance(char *data)
 
   // add the object to the draw list
   if (doAdd == 1) {
+    if (objList.count(objID) > 0)
+      removeFromIndex(objID, objList[objID]);
     objList[objID] = newInst;
+    addToIndex(objID, newInst);
+    setDirty(newInst);
 
     // maybe just-added object is somebody's parent so add
     // previously arrived children
@@ -273,6 +381,8 @@ void sageDraw::checkObjectQueue()
     for (it = objQueue.begin(); it != objQueue.end();) {
       if (addToParent(*it) == 1) {
         objList[(*it)->getID()] = *it;
+        addToIndex((*it)->getID(), *it);
+        setDirty(*it);
         objQueue.erase(it++);
         numAdded++;
       }
@@ -333,15 +443,19 @@ int sageDraw::removeObject(int id)
     if (obj->parentID != -1 &&   // if the obj is a part of a parent
         objList.count(obj->parentID)>0)
       objList[obj->parentID]->removeChild(id);
-    delete obj;
+    setDirty(obj);
+    removeFromIndex(id, obj);
     objList.erase(id);
+    delete obj;
   }
   return 0;
 }
 
 void sageDraw::onAppShutdown(int winID)
 {
+  damageApp(winID);
   apps.erase(winID);
+  zOrderChanged = true;
 }
 
 
@@ -352,8 +466,10 @@ int sageDraw::showObject(char *data)
   sscanf(data, "%d %d", &id, &doShow);
 
   // find the object we are changing and update it
-  if (objList.count(id) > 0)
+  if (objList.count(id) > 0) {
     objList[id]->showObject(bool(doShow));
+    setDirty(objList[id]);
+  }
 
   return 0;
 }
@@ -387,12 +503,23 @@ int sageDraw::forwardObjectMessage(char *data)
         sscanf(sage::tokenSeek(oneMessage, 2), "%d %d %d %d %d %d %f", &winID, &x, &y, &w, &h, &r, &z);
         updateInitialBounds(winID, x, y, w, h, (sageRotation)r, z);
       }
-      else if(msgCode == SHOW_SIZERS)
+      else if(msgCode == SHOW_SIZERS) {
         sscanf(sage::tokenSeek(oneMessage, 2), "%d", &doShowSizers);
-      else if (msgCode >= 0 && msgCode <= COMMON_WIDGET_EVENTS)
-        objList[objId]->parseMessage( oneMessage );
-      else
-        objList[objId]->parseCommonMessage( oneMessage );
+        setDirty();
+      }
+      else {
+        // the message may move the object so damage both positions, and it
+        // may change its display, app or drawOrder so index it again
+        sageDrawObject *obj = objList[objId];
+        setDirty(obj);
+        removeFromIndex(objId, obj);
+        if (msgCode >= 0 && msgCode <= COMMON_WIDGET_EVENTS)
+          obj->parseMessage( oneMessage );
+        else
+          obj->parseCommonMessage( oneMessage );
+        addToIndex(objId, obj);
+        setDirty(obj);
+      }
     }
     oneMessage = strtok(NULL, "\n");
   }
@@ -403,6 +530,8 @@ int sageDraw::forwardObjectMessage(char *data)
 
 void sageDraw::updateAppBounds(int winID, int x, int y, int w, int h, sageRotation orientation)
 {
+  damageApp(winID);
+
   // remember each app's bounds
   apps[winID].x = x;
   apps[winID].y = y;
@@ -419,13 +548,19 @@ void sageDraw::updateAppBounds(int winID, int x, int y, int w, int h, sageRotati
         (*iter).second->winID == winID && // tied to this app
         (*iter).second->parentID == -1)    // top level parents only
       (*iter).second->updateParentBounds(x, y, w, h, orientation);
+
+  damageApp(winID);
 }
 
 
 void sageDraw::updateAppDepth(int winID, float depth)
 {
   // remember this app's info
-  apps[winID].z = depth;
+  if (apps.count(winID) == 0 || apps[winID].z != depth) {
+    apps[winID].z = depth;
+    zOrderChanged = true;
+    damageApp(winID);
+  }
 
   // find the object (if any) that is tied to this app and update it
   std::map<const int, sageDrawObject *>::iterator iter;
@@ -442,6 +577,8 @@ void sageDraw::resetApp(int winID)
   if (apps.count(winID) == 0)
     return;
 
+  damageApp(winID);
+
   // find the object (if any) that is tied to this app and update it
   std::map<const int, sageDrawObject *>::iterator iter;
   for (iter = objList.begin(); iter != objList.end(); iter++) {
@@ -456,11 +593,15 @@ void sageDraw::resetApp(int winID)
                                          apps[winID].rot);
     }
   }
+
+  damageApp(winID);
 }
 
 
 void sageDraw::updateInitialBounds(int winID, int x, int y, int w, int h, sageRotation orientation, float depth)
 {
+  damageApp(winID);
+
   // remember each app's bounds
   apps[winID].x = x;
   apps[winID].y = y;
@@ -469,6 +610,7 @@ void sageDraw::updateInitialBounds(int winID, int x, int y, int w, int h, sageRo
   apps[winID].z = depth;
   apps[winID].rot = orientation;
   apps[winID].mouseOver = false;;
+  zOrderChanged = true;
 
   std::map<const int, sageDrawObject *>::iterator iter;
 
@@ -480,6 +622,8 @@ void sageDraw::updateInitialBounds(int winID, int x, int y, int w, int h, sageRo
       (*iter).second->updateParentBounds(x, y, w, h, orientation);
       (*iter).second->updateParentDepth(depth);
     }
+
+  damageApp(winID);
 }
 
 
@@ -487,4 +631,5 @@ void sageDraw::updateInitialBounds(int winID, int x, int y, int w, int h, sageRo
 void sageDraw::minimizeApp(int winID, bool minimized)
 {
   apps[winID].minimized = minimized;
+  damageApp(winID);
 }
@@ -61,9 +61,11 @@
 #include <map>
 #include <set>
 #include <queue>
+#include <vector>
 
 
 class sageDrawObject;
+struct drawObjectRecord;
 
 #if defined(__APPLE__)
 #include <OpenGL/gl.h>   // Header File For The OpenGL Library
@@ -86,6 +88,15 @@ struct appInfo {
 // defined in sageShader.cpp
 int GLprintError(const char *file, int line);
 
+// number of refreshes a damaged tile is redrawn for (one per color buffer),
+// deeper swap chains redraw the whole screen
+#define DAMAGE_FRAMES          2
+
+// extra pixels damaged around apps and overlays so that drop shadows
+// and outlines drawn just outside their bounds get repainted too
+#define APP_DAMAGE_MARGIN      100
+#define OVERLAY_DAMAGE_MARGIN  20
+
 
 class sageDraw {
 private:
@@ -97,11 +108,24 @@ private:
   std::set<sageDrawObject *> objQueue;
 
   bool &dirtyBit;
+  int *tileDamage;   // per tile refresh counters owned by sageDisplay
+  int tileNum;
   int displayID;
   sageDisplayConfig dispCfg;
 
+  // top-level objects of this display keyed by (winID, drawOrder) and then
+  // by their ID so that draw() doesn't have to scan the whole objList
+  std::map<std::pair<int,int>, std::map<int, sageDrawObject *> > drawIndex;
+  std::map<int, sageDrawObject *> menuIndex;
+
+  // winIDs ordered by app z, rebuilt only when the depths change
+  std::vector<int> zOrder;
+  bool zOrderChanged;
+
   int addToParent(sageDrawObject* drawObj);
   void checkObjectQueue();
+  void addToIndex(int id, sageDrawObject *obj);
+  void removeFromIndex(int id, sageDrawObject *obj);
 
   // a queue of objects that temporarily need to be
   // drawn after their top-level parents (e.g. selected thumbnail)
@@ -111,14 +135,19 @@ public:
 
   int doShowSizers;
 
-  sageDraw(bool &dirty, sageDisplayConfig cfg);
+  sageDraw(bool &dirty, int *damage, sageDisplayConfig cfg);
   sageDrawObject * createDrawObject(char *name);
   sageDrawObject * getDrawObject(int id);
   sageDrawObject * getAppOverlay(int appId);
   int addObjectInstance(char *data);
+  int addObjectInstance(drawObjectRecord *rec);
   int removeObject(int id);
 
-  void setDirty();
+  void setDirty();   // damages all the tiles
+  void setDirty(sageDrawObject *obj);   // damages the tiles under obj only
+  void damageRect(sageRect rect);   // rect in global display coordinates
+  void damageTile(int idx);
+  void damageApp(int winID);
   void update();  // updates all the drawObjects... if needed
   void draw(sageRect rect, int drawOrder, int winID=-1);  // draw all objects
   void delayDraw(sageDrawObject *obj);  // draw objects after their top-level parents
@@ -133,6 +162,7 @@ public:
   void updateAppDepth(int winID, float depth);
   void resetApp(int winID);
   void minimizeApp(int winID, bool minimized);
+  std::vector<int>& getAppsByZ();   // ordered from the lowest z to the highest
   ~sageDraw();
 
   // all of the applications' info
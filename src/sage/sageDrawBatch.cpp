@@ -0,0 +1,366 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageDrawBatch.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageDrawBatch.h"
+#include "misc.h"
+#include <math.h>
+
+// state recorded since the last flush, applied to GL when flushing
+#define DIRTY_COLOR    1
+#define DIRTY_TEXTURE  2
+#define DIRTY_LINE     4
+#define DIRTY_STIPPLE  8
+
+sageDrawBatch::sageDrawBatch() : primMode(GL_TRIANGLES), inPrim(false), immediate(false), tex(0), lineW(1.0),
+                                 stippleFactor(0), stipplePattern(0xffff), drawCalls(0), dirty(0)
+{
+  current.x = current.y = current.z = 0.0;
+  current.s = current.t = 0.0;
+  current.r = current.g = current.b = current.a = 255;
+
+  m[0] = m[3] = 1.0;
+  m[1] = m[2] = m[4] = m[5] = 0.0;
+}
+
+sageDrawBatch& sageDrawBatch::overlay()
+{
+  static sageDrawBatch batch;
+  return batch;
+}
+
+void sageDrawBatch::color(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+  // same clamping as glColor4f
+  current.r = (GLubyte)(MAX(0.0, MIN(1.0, r)) * 255.0 + 0.5);
+  current.g = (GLubyte)(MAX(0.0, MIN(1.0, g)) * 255.0 + 0.5);
+  current.b = (GLubyte)(MAX(0.0, MIN(1.0, b)) * 255.0 + 0.5);
+  current.a = (GLubyte)(MAX(0.0, MIN(1.0, a)) * 255.0 + 0.5);
+  dirty |= DIRTY_COLOR;
+}
+
+void sageDrawBatch::colorub(GLubyte r, GLubyte g, GLubyte b, GLubyte a)
+{
+  current.r = r;
+  current.g = g;
+  current.b = b;
+  current.a = a;
+  dirty |= DIRTY_COLOR;
+}
+
+void sageDrawBatch::bindTexture(GLuint t)
+{
+  tex = t;
+  dirty |= DIRTY_TEXTURE;
+}
+
+void sageDrawBatch::disableTexture()
+{
+  tex = 0;
+  dirty |= DIRTY_TEXTURE;
+}
+
+void sageDrawBatch::lineWidth(GLfloat w)
+{
+  lineW = w;
+  dirty |= DIRTY_LINE;
+}
+
+void sageDrawBatch::lineStipple(GLint factor, GLushort pattern)
+{
+  stippleFactor = factor;
+  stipplePattern = pattern;
+  dirty |= DIRTY_STIPPLE;
+}
+
+void sageDrawBatch::disableStipple()
+{
+  stippleFactor = 0;
+  dirty |= DIRTY_STIPPLE;
+}
+
+void sageDrawBatch::pushMatrix()
+{
+  matrixStack.insert(matrixStack.end(), m, m+6);
+}
+
+void sageDrawBatch::popMatrix()
+{
+  if (matrixStack.size() < 6)
+    return;
+
+  std::copy(matrixStack.end()-6, matrixStack.end(), m);
+  matrixStack.resize(matrixStack.size()-6);
+}
+
+// the transformations multiply the current matrix on the right, like GL
+void sageDrawBatch::translate(GLfloat x, GLfloat y)
+{
+  m[4] += m[0]*x + m[2]*y;
+  m[5] += m[1]*x + m[3]*y;
+}
+
+void sageDrawBatch::rotate(GLfloat deg)
+{
+  GLfloat c = cos(deg*M_PI/180.0), s = sin(deg*M_PI/180.0);
+  GLfloat a0 = m[0], a1 = m[1];
+
+  m[0] = a0*c + m[2]*s;
+  m[1] = a1*c + m[3]*s;
+  m[2] = m[2]*c - a0*s;
+  m[3] = m[3]*c - a1*s;
+}
+
+void sageDrawBatch::scale(GLfloat sx, GLfloat sy)
+{
+  m[0] *= sx;
+  m[1] *= sx;
+  m[2] *= sy;
+  m[3] *= sy;
+}
+
+void sageDrawBatch::begin(GLenum mode)
+{
+  primMode = mode;
+  inPrim = true;
+  prim.clear();
+}
+
+void sageDrawBatch::vertex(GLfloat x, GLfloat y, GLfloat z)
+{
+  if (!inPrim)
+    return;
+
+  batchVertex v = current;
+  v.x = m[0]*x + m[2]*y + m[4];
+  v.y = m[1]*x + m[3]*y + m[5];
+  v.z = z;
+  prim.push_back(v);
+}
+
+void sageDrawBatch::emit(const batchVertex &v)
+{
+  verts.push_back(v);
+  runs.back().count++;
+}
+
+void sageDrawBatch::end()
+{
+  inPrim = false;
+
+  int n = (int)prim.size();
+  bool lines = (primMode == GL_LINES || primMode == GL_LINE_STRIP || primMode == GL_LINE_LOOP);
+  GLenum mode = lines ? GL_LINES : GL_TRIANGLES;
+
+  if (n < (lines ? 2 : 3))
+    return;
+
+  // start a new run if the state changed, line state only matters to lines
+  batchRun r;
+  r.mode = mode;
+  r.tex = tex;
+  r.lineWidth = lines ? lineW : 0;
+  r.stippleFactor = lines ? stippleFactor : 0;
+  r.stipplePattern = lines ? stipplePattern : 0;
+  r.first = (int)verts.size();
+  r.count = 0;
+
+  if (runs.empty()) {
+    runs.push_back(r);
+  }
+  else {
+    batchRun &last = runs.back();
+    if (last.mode != r.mode || last.tex != r.tex || last.lineWidth != r.lineWidth ||
+        last.stippleFactor != r.stippleFactor || last.stipplePattern != r.stipplePattern)
+      runs.push_back(r);
+  }
+
+  switch(primMode) {
+  case GL_TRIANGLES:
+    for (int i=0; i+2<n; i+=3) {
+      emit(prim[i]);
+      emit(prim[i+1]);
+      emit(prim[i+2]);
+    }
+    break;
+
+  case GL_QUADS:
+    for (int i=0; i+3<n; i+=4) {
+      emit(prim[i]);
+      emit(prim[i+1]);
+      emit(prim[i+2]);
+      emit(prim[i]);
+      emit(prim[i+2]);
+      emit(prim[i+3]);
+    }
+    break;
+
+  case GL_TRIANGLE_STRIP:
+    for (int i=2; i<n; i++) {
+      emit(prim[i-2]);
+      emit(prim[i-1]);
+      emit(prim[i]);
+    }
+    break;
+
+  case GL_POLYGON:
+  case GL_TRIANGLE_FAN:
+    for (int i=2; i<n; i++) {
+      emit(prim[0]);
+      emit(prim[i-1]);
+      emit(prim[i]);
+    }
+    break;
+
+  case GL_LINES:
+    for (int i=0; i+1<n; i+=2) {
+      emit(prim[i]);
+      emit(prim[i+1]);
+    }
+    break;
+
+  case GL_LINE_STRIP:
+  case GL_LINE_LOOP:
+    for (int i=1; i<n; i++) {
+      emit(prim[i-1]);
+      emit(prim[i]);
+    }
+    if (primMode == GL_LINE_LOOP && n > 2) {
+      emit(prim[n-1]);
+      emit(prim[0]);
+    }
+    break;
+  }
+
+  if (immediate)
+    flush();
+}
+
+void sageDrawBatch::flush()
+{
+  drawCalls = 0;
+
+  if (!runs.empty()) {
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, sizeof(batchVertex), &verts[0].x);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(batchVertex), &verts[0].s);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(batchVertex), &verts[0].r);
+
+    // only change the GL state between runs when it differs
+    int texOn = -1, stippleOn = -1;
+    GLuint boundTex = 0;
+    GLfloat width = -1.0;
+
+    for (int i=0; i<(int)runs.size(); i++) {
+      batchRun &r = runs[i];
+
+      if (r.tex) {
+        if (texOn != 1)
+          glEnable(GL_TEXTURE_2D);
+        if (texOn != 1 || boundTex != r.tex)
+          glBindTexture(GL_TEXTURE_2D, r.tex);
+        texOn = 1;
+        boundTex = r.tex;
+      }
+      else if (texOn != 0) {
+        glDisable(GL_TEXTURE_2D);
+        texOn = 0;
+      }
+
+      if (r.mode == GL_LINES) {
+        if (r.lineWidth != width) {
+          glLineWidth(r.lineWidth);
+          width = r.lineWidth;
+        }
+        if (r.stippleFactor > 0) {
+          glEnable(GL_LINE_STIPPLE);
+          glLineStipple(r.stippleFactor, r.stipplePattern);
+          stippleOn = 1;
+        }
+        else if (stippleOn != 0) {
+          glDisable(GL_LINE_STIPPLE);
+          stippleOn = 0;
+        }
+      }
+
+      glDrawArrays(r.mode, r.first, r.count);
+      drawCalls++;
+    }
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+  }
+
+  // leave GL in the state the recorded calls would have left it in
+  if (!runs.empty() || (dirty & DIRTY_COLOR))
+    glColor4ub(current.r, current.g, current.b, current.a);
+
+  if (!runs.empty() || (dirty & DIRTY_TEXTURE)) {
+    if (tex) {
+      glEnable(GL_TEXTURE_2D);
+      glBindTexture(GL_TEXTURE_2D, tex);
+    }
+    else
+      glDisable(GL_TEXTURE_2D);
+  }
+
+  if (dirty & DIRTY_LINE)
+    glLineWidth(lineW);
+
+  if (dirty & DIRTY_STIPPLE) {
+    if (stippleFactor > 0) {
+      glEnable(GL_LINE_STIPPLE);
+      glLineStipple(stippleFactor, stipplePattern);
+    }
+    else
+      glDisable(GL_LINE_STIPPLE);
+  }
+
+  clear();
+}
+
+void sageDrawBatch::clear()
+{
+  verts.clear();
+  runs.clear();
+  dirty = 0;
+}
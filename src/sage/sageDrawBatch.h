@@ -0,0 +1,143 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageDrawBatch.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_DRAW_BATCH_H
+#define SAGE_DRAW_BATCH_H
+
+#if defined(__APPLE__)
+#include <OpenGL/gl.h>   // Header File For The OpenGL Library
+#else
+#include <GL/gl.h>   // Header File For The OpenGL Library
+#endif
+
+#include <vector>
+
+struct batchVertex {
+  GLfloat x, y, z;
+  GLfloat s, t;
+  GLubyte r, g, b, a;
+};
+
+// consecutive primitives drawn with the same GL state
+struct batchRun {
+  GLenum mode;   // GL_TRIANGLES or GL_LINES
+  GLuint tex;    // 0 : texturing disabled
+  GLfloat lineWidth;
+  GLint stippleFactor;   // 0 : no stipple
+  GLushort stipplePattern;
+  int first, count;
+};
+
+/**
+ * Records the overlay drawing into one vertex array instead of issuing
+ * glBegin/glEnd for every primitive. The calls mirror the GL immediate mode
+ * ones (begin/vertex/end, color, texture, line state, matrix stack) so the
+ * drawing order and the look are kept. Quads and polygons become triangles,
+ * line loops and strips become lines, and everything is transformed on the
+ * CPU. flush() draws all the recorded primitives with one glDrawArrays per
+ * state change, it must be called before drawing anything with GL directly.
+ */
+class sageDrawBatch {
+private:
+  std::vector<batchVertex> verts;
+  std::vector<batchRun> runs;
+  std::vector<batchVertex> prim;   // vertices between begin() and end()
+  GLenum primMode;
+  bool inPrim;
+  bool immediate;   // flush after every primitive
+
+  // current state, as the GL one after the recorded calls
+  batchVertex current;
+  GLuint tex;
+  GLfloat lineW;
+  GLint stippleFactor;
+  GLushort stipplePattern;
+
+  // 2D affine transformation: x' = m[0]*x + m[2]*y + m[4], y' = m[1]*x + m[3]*y + m[5]
+  GLfloat m[6];
+  std::vector<GLfloat> matrixStack;
+
+  int drawCalls;   // done by the last flush()
+  unsigned int dirty;   // state set since the last flush()
+
+  void emit(const batchVertex &v);
+
+public:
+  sageDrawBatch();
+
+  // the batch all the overlays of the display manager draw into
+  static sageDrawBatch& overlay();
+
+  void begin(GLenum mode);  // GL_QUADS, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_POLYGON, GL_LINES, GL_LINE_STRIP or GL_LINE_LOOP
+  void end();
+  void vertex(GLfloat x, GLfloat y, GLfloat z);
+  void texCoord(GLfloat s, GLfloat t) { current.s = s; current.t = t; }
+  void color(GLfloat r, GLfloat g, GLfloat b, GLfloat a = 1.0);
+  void colorub(GLubyte r, GLubyte g, GLubyte b, GLubyte a = 255);
+
+  void bindTexture(GLuint t);   // glEnable(GL_TEXTURE_2D) and glBindTexture()
+  void disableTexture();
+  void lineWidth(GLfloat w);
+  GLfloat getLineWidth() { return lineW; }
+  void lineStipple(GLint factor, GLushort pattern);
+  void disableStipple();
+
+  void pushMatrix();
+  void popMatrix();
+  void translate(GLfloat x, GLfloat y);
+  void rotate(GLfloat deg);
+  void scale(GLfloat sx, GLfloat sy);
+
+  // draws and empties the batch
+  void flush();
+
+  // draws every primitive as soon as it ends, for code that still sets
+  // the GL matrices itself
+  void setImmediate(bool on) { immediate = on; }
+  bool isImmediate() { return immediate; }
+
+  // forgets the recorded primitives without drawing them
+  void clear();
+
+  int vertexCount() { return (int)verts.size(); }
+  int runCount() { return (int)runs.size(); }
+  int lastDrawCalls() { return drawCalls; }
+};
+
+#endif
@@ -0,0 +1,199 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageDrawBench.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+/*
+ * Records a synthetic overlay scene into a sageDrawBatch, the way the
+ * display manager draws the app frames, titles and widget panels, and
+ * compares the number of draw calls with the old glBegin/glEnd drawing.
+ * No GL context is needed, the batch is never flushed.
+ *
+ *   sageDrawBench [apps [frames]]
+ */
+
+#include "sageDrawBatch.h"
+#include "misc.h"
+
+#define GLYPH_TEX    1
+#define BUTTON_TEX   2
+#define CORNER_TEX   3
+
+#define BUTTONS      6
+#define TITLE_CHARS  24
+
+// glBegin/glEnd pairs and texture binds the same scene used to take
+struct immediateCount {
+  int begins;
+  int binds;
+};
+
+static void drawText(sageDrawBatch &batch, float x, float y, float z, int len, immediateCount &imm)
+{
+  // one quad per glyph from the font atlas, used to be one texture per glyph
+  batch.bindTexture(GLYPH_TEX);
+  batch.colorub(255, 255, 255, 200);
+  batch.begin(GL_QUADS);
+  for (int i=0; i<len; i++) {
+    float gx = x + i*9;
+    batch.texCoord(0.0, 0.0);  batch.vertex(gx, y+16, z);
+    batch.texCoord(0.1, 0.0);  batch.vertex(gx+8, y+16, z);
+    batch.texCoord(0.1, 0.1);  batch.vertex(gx+8, y, z);
+    batch.texCoord(0.0, 0.1);  batch.vertex(gx, y, z);
+  }
+  batch.end();
+
+  imm.begins += len;
+  imm.binds += len;
+}
+
+static void drawApp(sageDrawBatch &batch, float left, float bottom, float w, float h,
+                    immediateCount &imm)
+{
+  float z = 0.0;
+  float right = left+w, top = bottom+h;
+
+  // outline
+  batch.disableTexture();
+  batch.lineWidth(2);
+  batch.begin(GL_LINE_LOOP);
+  batch.color(0.5, 0.5, 0.5, 0.8);
+  batch.vertex(left, bottom, z);
+  batch.vertex(left, top, z);
+  batch.vertex(right, top, z);
+  batch.vertex(right, bottom, z);
+  batch.end();
+  imm.begins++;
+
+  // corners
+  batch.bindTexture(CORNER_TEX);
+  batch.color(1.0, 1.0, 1.0, 0.6);
+  for (int i=0; i<4; i++) {
+    batch.pushMatrix();
+    batch.translate(i%2 ? right : left, i/2 ? top : bottom);
+    batch.rotate(90.0*i);
+    batch.begin(GL_QUADS);
+    batch.texCoord(0.0, 1.0);  batch.vertex(0, 0, z);
+    batch.texCoord(1.0, 1.0);  batch.vertex(40, 0, z);
+    batch.texCoord(1.0, 0.0);  batch.vertex(40, 40, z);
+    batch.texCoord(0.0, 0.0);  batch.vertex(0, 40, z);
+    batch.end();
+    batch.popMatrix();
+    imm.begins++;
+    imm.binds++;
+  }
+
+  // title bar
+  batch.disableTexture();
+  batch.color(0.2, 0.2, 0.2, 0.7);
+  batch.begin(GL_QUADS);
+  batch.vertex(left, top, z);
+  batch.vertex(right, top, z);
+  batch.vertex(right, top+20, z);
+  batch.vertex(left, top+20, z);
+  batch.end();
+  imm.begins++;
+  drawText(batch, left+4, top+2, z, TITLE_CHARS, imm);
+
+  // widget panel with its buttons and their labels
+  batch.disableTexture();
+  batch.color(0.0, 0.0, 0.0, 0.5);
+  batch.begin(GL_POLYGON);
+  for (int i=0; i<=180; i+=10)
+    batch.vertex(left+cos(i*3.14159/180.0)*30, bottom+sin(i*3.14159/180.0)*30, z);
+  batch.end();
+  imm.begins++;
+
+  for (int i=0; i<BUTTONS; i++) {
+    float bx = left + 10 + i*50;
+    batch.pushMatrix();
+    batch.translate(bx, bottom+10);
+    batch.bindTexture(BUTTON_TEX);
+    batch.color(1.0, 1.0, 1.0, 0.8);
+    batch.begin(GL_QUADS);
+    batch.texCoord(0.0, 1.0);  batch.vertex(0, 0, z);
+    batch.texCoord(1.0, 1.0);  batch.vertex(40, 0, z);
+    batch.texCoord(1.0, 0.0);  batch.vertex(40, 30, z);
+    batch.texCoord(0.0, 0.0);  batch.vertex(0, 30, z);
+    batch.end();
+    batch.popMatrix();
+    imm.begins++;
+    imm.binds++;
+
+    drawText(batch, bx+2, bottom+14, z, 4, imm);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int apps = 50, frames = 500;
+
+  if (argc >= 2)
+    apps = atoi(argv[1]);
+  if (argc >= 3)
+    frames = atoi(argv[2]);
+
+  if (apps <= 0 || frames <= 0) {
+    fprintf(stderr, "usage: %s [apps [frames]]\n", argv[0]);
+    return -1;
+  }
+
+  sageDrawBatch batch;
+  immediateCount imm;
+  int vertices = 0, runs = 0;
+
+  sageTimer timer;
+  for (int f=0; f<frames; f++) {
+    imm.begins = imm.binds = 0;
+    for (int i=0; i<apps; i++)
+      drawApp(batch, (i%10)*400, (i/10)*300, 360, 260, imm);
+
+    vertices = batch.vertexCount();
+    runs = batch.runCount();
+    batch.clear();
+  }
+  double us = timer.getTimeUS() / frames;
+
+  printf("%d apps, %d frames\n", apps, frames);
+  printf("recording          %10.1f us per frame\n", us);
+  printf("vertices           %10d\n", vertices);
+  printf("glBegin/glEnd      %10d draw calls, %d texture binds\n", imm.begins, imm.binds);
+  printf("batched            %10d draw calls (%.1fx fewer)\n", runs,
+         runs ? (double)imm.begins / runs : 0.0);
+
+  return 0;
+}
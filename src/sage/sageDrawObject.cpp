@@ -41,6 +41,7 @@
 //#include <GL/glew.h>
 
 #include "sageDrawObject.h"
+#include "sageDrawTemplate.h"
 namespace Magick {
 #include <wand/magick-wand.h>
 }
@@ -66,7 +67,7 @@ float sageDrawObject::selPulseDir = 7;
 bool sageDrawObject::selUpdated = false;
 
 
-sageDrawObject::sageDrawObject()
+sageDrawObject::sageDrawObject() : batch(sageDrawBatch::overlay())
 {
   objectID = 0;
   displayID = 0;
@@ -83,6 +84,8 @@ sageDrawObject::sageDrawObject()
   zOffset = 0.0;
   scale = 1.0;
   delayDraw = false;
+  batched = false;
+  tmpl = NULL;
   selected = false;
 
   fontColor = DEFAULT_FONT_COLOR;
@@ -302,7 +305,21 @@ void sageDrawObject::fade(fadeDir dir, int startAlpha, int endAlpha)
 
 void sageDrawObject::setDirty()
 {
-  drawParent->setDirty();
+  drawParent->setDirty(this);
+}
+
+sageRect sageDrawObject::getDrawBounds()
+{
+  sageRect b(x-OVERLAY_DAMAGE_MARGIN, y-OVERLAY_DAMAGE_MARGIN,
+             width+2*OVERLAY_DAMAGE_MARGIN, height+2*OVERLAY_DAMAGE_MARGIN);
+
+  // tooltips are drawn to the right of the widget
+  if (!tooltip.empty()) {
+    b.width += ttWidth + ttSize;
+    b.height += ttSize;
+  }
+
+  return b;
 }
 
 
@@ -310,8 +327,11 @@ void sageDrawObject::setDirty()
 /*                              XML STUFF                               */
 //----------------------------------------------------------------------//
 
-void sageDrawObject::parseXml(TiXmlElement *root)
+void sageDrawObject::parseXml(TiXmlElement *root, sageDrawTemplate *t)
 {
+  // images come already decoded with a template
+  tmpl = t;
+
   // initialize some members
   int isGlobal=1;
   int dDraw=1;  //delay draw
@@ -422,8 +442,8 @@ void sageDrawObject::parseXml(TiXmlElement *root)
     parentBounds.updateBoundary();
   }
 
-  // parse the graphics stuff
-  TiXmlElement *graphics = root->FirstChildElement("graphics");
+  // parse the graphics stuff, a template keeps them for all its widgets
+  TiXmlElement *graphics = tmpl ? tmpl->getGraphics() : root->FirstChildElement("graphics");
   if (graphics) {
 
     // font color if present
@@ -479,6 +499,18 @@ void sageDrawObject::parseXml(TiXmlElement *root)
     // now call the subclass' method to parse widget specific info
     parseSpecificInfo(specific);
   }
+
+  tmpl = NULL;
+}
+
+
+// returns new texture object on success, 0 otherwise
+GLuint sageDrawObject::getTexture(TiXmlElement *parent, const char *elementName)
+{
+  if (tmpl)
+    return tmpl->getTexture(parent, elementName);
+  else
+    return getTextureFromXml(parent, elementName);
 }
 
 
@@ -754,10 +786,18 @@ void sageDrawObject::redraw(bool delayedCall)
   // draw the widget now or delay it
   if (delayDraw && !delayedCall)
     drawParent->delayDraw(this);
-  else
+  else {
+    // objects still using the GL matrices draw their batched parts
+    // (text, tooltips) right away, after everything recorded before them
+    if (!batched)
+      batch.flush();
+    batch.setImmediate(!batched);
     draw();
+    batch.setImmediate(false);
+  }
 
   if (drawDimBounds) {
+    batch.flush();
     glPushAttrib(GL_ALL_ATTRIB_BITS);
     glDisable(GL_TEXTURE_2D);
     glColor4f(1,1,1,1);
@@ -787,28 +827,28 @@ void sageDrawObject::drawTooltip()
     float degInRad = 0.0;
     float radius = ttSize/2.0+ttSize/8.0;
 
-    glDisable(GL_TEXTURE_2D);
-    glPushMatrix();
-    glTranslatef(0.0, ttSize/2.0+ttSize/16.0, 0);
-    glColor4f(0.0, 0.0, 0.0, 0.5);
+    batch.disableTexture();
+    batch.pushMatrix();
+    batch.translate(0.0, ttSize/2.0+ttSize/16.0);
+    batch.color(0.0, 0.0, 0.0, 0.5);
 
     // left half circle
-    glBegin(GL_POLYGON);
+    batch.begin(GL_POLYGON);
     for (int i=90; i <= 270; i+=10)
     {
       degInRad = i*DEG2RAD;
-      glVertex3f(cos(degInRad)*radius,sin(degInRad)*radius, z);
+      batch.vertex(cos(degInRad)*radius,sin(degInRad)*radius, z);
     }
 
     // right half circle
     for (int i=270; i <= 450; i+=10)
     {
       degInRad = i*DEG2RAD;
-      glVertex3f(cos(degInRad)*radius+ttWidth,sin(degInRad)*radius, z);
+      batch.vertex(cos(degInRad)*radius+ttWidth,sin(degInRad)*radius, z);
     }
-    glEnd();
+    batch.end();
 
-    glPopMatrix();
+    batch.popMatrix();
 
     // draw the label
     ft = getFont(ttSize);
@@ -967,31 +1007,29 @@ GLuint getTextureFromXml(TiXmlElement *parent, const char *elementName)
 }
 
 // returns new texture object on success, 0 otherwise
-GLuint getTextureFromBuffer(const char *imgData, int len)
+GLuint getTextureFromRGBA(const GLubyte *rgba, unsigned int w_tex, unsigned int h_tex)
 {
-  unsigned int w_tex, h_tex;
-  GLubyte *rgba = NULL;
   GLuint t = 0;
 
-  if (getRGBA((void *)imgData, len, &rgba, w_tex, h_tex)) {
-    glGenTextures (1, &t);
-    glBindTexture (GL_TEXTURE_2D, t);
-    gluBuild2DMipmaps(GL_TEXTURE_2D, GL_RGBA, w_tex, h_tex, GL_RGBA, GL_UNSIGNED_BYTE, (GLubyte*) rgba);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glGenTextures (1, &t);
+  glBindTexture (GL_TEXTURE_2D, t);
+  gluBuild2DMipmaps(GL_TEXTURE_2D, GL_RGBA, w_tex, h_tex, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
 
-    //glGenTextures(1, &t);
-    //glBindTexture(GL_TEXTURE_2D, t);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    //glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w_tex, h_tex, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLubyte*)rgba);
-    //glGenerateMipmap(GL_TEXTURE_2D);  //Generate mipmaps now!!!
+  return t;
+}
 
+// returns new texture object on success, 0 otherwise
+GLuint getTextureFromBuffer(const char *imgData, int len)
+{
+  unsigned int w_tex, h_tex;
+  GLubyte *rgba = NULL;
+  GLuint t = 0;
 
-    GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
-  }
+  if (getRGBA((void *)imgData, len, &rgba, w_tex, h_tex))
+    t = getTextureFromRGBA(rgba, w_tex, h_tex);
   free(rgba);
   return t;
 }
@@ -1009,23 +1047,8 @@ GLuint getTextureFromFile(const char *filename)
   char filePath[256];
   sprintf(filePath, "%s/%s",sageDir, filename);
 
-  if (getRGBA(filePath, &rgba, w_tex, h_tex)) {
-    glGenTextures (1, &t);
-    glBindTexture (GL_TEXTURE_2D, t);
-    gluBuild2DMipmaps(GL_TEXTURE_2D, GL_RGBA, w_tex, h_tex, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
-    //glGenTextures(1, &t);
-    //glBindTexture(GL_TEXTURE_2D, t);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    //glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    //glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w_tex, h_tex, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLubyte*)rgba);
-    //glGenerateMipmap(GL_TEXTURE_2D);  //Generate mipmaps now!!!
-
-  }
+  if (getRGBA(filePath, &rgba, w_tex, h_tex))
+    t = getTextureFromRGBA(rgba, w_tex, h_tex);
   free(rgba);
   return t;
 }
@@ -46,6 +46,7 @@
 #include "sageBase.h"
 #include "sageDraw.h"
 #include "font.h"
+#include "sageDrawBatch.h"
 //#include <wand/magick-wand.h>
 #include <map>
 #include <string>
@@ -62,12 +63,14 @@
 #endif
 
 class sageDraw;
+class sageDrawTemplate;
 
 
 // for loading textures easily
 GLuint getTextureFromXml(TiXmlElement *parent, const char *elementName);
 GLuint getTextureFromFile(const char *filename);
 GLuint getTextureFromBuffer(const char *imgData, int len);
+GLuint getTextureFromRGBA(const GLubyte *rgba, unsigned int w_tex, unsigned int h_tex);
 
 int getRGBA(char *filename, GLubyte **rgba,
             unsigned int &width, unsigned int &height);
@@ -91,6 +94,9 @@ protected:
   float appZ;
   float zOffset;  // for placing widgets on different levels
   bool delayDraw; // some objects need to be drawn later (eg thumbnails)
+  bool batched;   // draws through the batch only, without touching the GL matrices
+  sageDrawBatch &batch;
+  sageDrawTemplate *tmpl;   // only set while parsing the XML
   bool selected;
 
   // ordered hash of all the children in the sizer (keys are the order)
@@ -131,6 +137,7 @@ public:
   sageRect parentBounds;  // used if the object is tied to the app
   bool parentBoundsSet;
   bool visible;
+  sageRect damagedBounds;  // area damaged the last time this object changed
   bool slideHidden;   // whether the widget is "slided" out of view... if allowed
   bool canSlide;
   int slideY;
@@ -176,9 +183,11 @@ public:
   void updateParentDepth(float depth);
   void updateFontPosition();  // where the label is within the widget
   void fitAroundLabel();
-  void parseXml(TiXmlElement *root);
+  void parseXml(TiXmlElement *root, sageDrawTemplate *t=NULL);
+  GLuint getTexture(TiXmlElement *parent, const char *elementName);
   Font * getFont(int h);
   void setDirty();  // i.e. "please refresh the screen"
+  sageRect getDrawBounds();  // area touched when drawn, tooltip included
   bool operator==(const char *wType);
   bool operator!=(const char *wType);
   int lineW(float lw) { return MIN( MAX(1, int(lw)), 4); }
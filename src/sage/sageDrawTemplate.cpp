@@ -0,0 +1,247 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageDrawTemplate.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageDrawTemplate.h"
+#include "misc.h"
+
+sageDrawTemplate::sageDrawTemplate() : graphics(NULL), refs(0), lastUse(0)
+{
+  objectType[0] = '\0';
+}
+
+sageDrawTemplate::~sageDrawTemplate()
+{
+  std::map<std::string, templateImage>::iterator it;
+  for (it = images.begin(); it != images.end(); it++)
+    free((*it).second.rgba);
+  images.clear();
+  delete graphics;
+}
+
+// decodes every element with an image format, the way getTextureFromXml() reads them
+int sageDrawTemplate::init(const char *type, TiXmlElement *g)
+{
+  strncpy(objectType, type, SAGE_NAME_LEN-1);
+  objectType[SAGE_NAME_LEN-1] = '\0';
+
+  if (!g)
+    return 0;
+
+  TiXmlElement *el;
+  for (el = g->FirstChildElement(); el; el = el->NextSiblingElement()) {
+    // FirstChildElement() finds the first one of a name only
+    int format = -1;
+    if (el->QueryIntAttribute("format", &format) != TIXML_SUCCESS || !el->GetText() ||
+        images.count(el->Value()) > 0)
+      continue;
+
+    templateImage img;
+    img.rgba = NULL;
+    int ok = 0;
+
+    if (format == FILE_FMT) {
+      // relative to the sage directory, as in getTextureFromFile()
+      char *sageDir = getenv("SAGE_DIRECTORY");
+      char filePath[256];
+      sprintf(filePath, "%s/%s", sageDir, el->GetText());
+      ok = getRGBA(filePath, &img.rgba, img.width, img.height);
+    }
+    else if (format == IMAGE_FMT) {
+      std::string b64 (el->GetText());
+      std::string decoded (Base64::decode(b64));
+      ok = getRGBA(decoded.data(), decoded.size(), &img.rgba, img.width, img.height);
+    }
+
+    if (ok)
+      images[el->Value()] = img;
+    else
+      free(img.rgba);
+  }
+
+  // the widgets only look up the images by name
+  graphics = g->Clone()->ToElement();
+  for (el = graphics->FirstChildElement(); el; el = el->NextSiblingElement()) {
+    int format = -1;
+    if (el->QueryIntAttribute("format", &format) == TIXML_SUCCESS)
+      el->Clear();
+  }
+
+  return 0;
+}
+
+// returns new texture object on success, 0 otherwise
+GLuint sageDrawTemplate::getTexture(TiXmlElement *parent, const char *elementName)
+{
+  if (!parent || strcmp(parent->Value(), "graphics") != 0 || images.count(elementName) == 0)
+    return 0;
+
+  templateImage &img = images[elementName];
+  return getTextureFromRGBA(img.rgba, img.width, img.height);
+}
+
+
+
+sageDrawTemplateCache::sageDrawTemplateCache() : useCount(0), hits(0), misses(0)
+{
+  pthread_mutex_init(&lock, NULL);
+}
+
+sageDrawTemplateCache::~sageDrawTemplateCache()
+{
+  std::map<std::string, sageDrawTemplate*>::iterator it;
+  for (it = templates.begin(); it != templates.end(); it++)
+    delete (*it).second;
+  templates.clear();
+  pthread_mutex_destroy(&lock);
+}
+
+sageDrawTemplateCache& sageDrawTemplateCache::instance()
+{
+  static sageDrawTemplateCache cache;
+  return cache;
+}
+
+drawObjectRecord* sageDrawTemplateCache::prepare(char *data)
+{
+  char objectType[SAGE_NAME_LEN];
+  drawObjectRecord rec;
+
+  // the ids and the type come before the xml document
+  if (sscanf(data, "%d %s %d %d", &rec.objID, objectType, &rec.widgetID, &rec.winID) != 4) {
+    SAGE_PRINTLOG("sageDrawTemplateCache::prepare : invalid object message");
+    return NULL;
+  }
+
+  char *xmlText = sage::tokenSeek(data, 4);
+  if (!xmlText) {
+    SAGE_PRINTLOG("sageDrawTemplateCache::prepare : no XML for object %d", rec.objID);
+    return NULL;
+  }
+
+  TiXmlDocument xml;
+  xml.Parse(xmlText);
+  TiXmlElement *root = xml.RootElement();
+  if (xml.Error() || !root) {
+    SAGE_PRINTLOG("sageDrawTemplateCache::prepare : error while parsing %s XML: %s", objectType, xml.ErrorDesc());
+    return NULL;
+  }
+
+  // every widget has its own ids and position in the description, the
+  // graphics are shared and kept once in the template
+  rec.widget = new TiXmlElement(root->Value());
+  TiXmlAttribute *attr;
+  for (attr = root->FirstAttribute(); attr; attr = attr->Next())
+    rec.widget->SetAttribute(attr->Name(), attr->Value());
+
+  TiXmlNode *node;
+  for (node = root->FirstChild(); node; node = node->NextSibling()) {
+    if (!node->ToElement() || strcmp(node->Value(), "graphics") != 0)
+      rec.widget->LinkEndChild(node->Clone());
+  }
+
+  TiXmlElement *graphics = root->FirstChildElement("graphics");
+  TiXmlPrinter printer;
+  if (graphics)
+    graphics->Accept(&printer);
+  std::string key = std::string(objectType) + " " + printer.Str();
+
+  pthread_mutex_lock(&lock);
+  std::map<std::string, sageDrawTemplate*>::iterator it = templates.find(key);
+  if (it != templates.end()) {
+    rec.tmpl = (*it).second;
+    hits++;
+  }
+  else {
+    // decode without the lock, the message and the display thread may
+    // both be here for the same template
+    pthread_mutex_unlock(&lock);
+    sageDrawTemplate *t = new sageDrawTemplate;
+    t->init(objectType, graphics);
+    pthread_mutex_lock(&lock);
+
+    it = templates.find(key);
+    if (it != templates.end()) {
+      delete t;
+      rec.tmpl = (*it).second;
+      hits++;
+    }
+    else {
+      templates[key] = t;
+      rec.tmpl = t;
+      misses++;
+    }
+  }
+
+  rec.tmpl->refs++;
+  rec.tmpl->lastUse = ++useCount;
+  evict();
+  pthread_mutex_unlock(&lock);
+
+  return new drawObjectRecord(rec);
+}
+
+void sageDrawTemplateCache::release(drawObjectRecord *rec)
+{
+  pthread_mutex_lock(&lock);
+  rec->tmpl->refs--;
+  evict();
+  pthread_mutex_unlock(&lock);
+
+  delete rec->widget;
+  delete rec;
+}
+
+// drops the least recently used templates nobody waits for, lock held
+void sageDrawTemplateCache::evict()
+{
+  while ((int)templates.size() > DRAW_TEMPLATE_CACHE_SIZE) {
+    std::map<std::string, sageDrawTemplate*>::iterator it, oldest = templates.end();
+    for (it = templates.begin(); it != templates.end(); it++) {
+      if ((*it).second->refs == 0 &&
+          (oldest == templates.end() || (*it).second->lastUse < (*oldest).second->lastUse))
+        oldest = it;
+    }
+
+    if (oldest == templates.end())
+      return;
+
+    delete (*oldest).second;
+    templates.erase(oldest);
+  }
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageDrawTemplate.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_DRAW_TEMPLATE_H
+#define SAGE_DRAW_TEMPLATE_H
+
+#include "sageDrawObject.h"
+#include <pthread.h>
+
+// templates kept around after their last instance is gone
+#define DRAW_TEMPLATE_CACHE_SIZE 128
+
+// an image of a widget description, decoded but not yet a texture
+struct templateImage {
+  GLubyte *rgba;
+  unsigned int width, height;
+};
+
+/**
+ * The graphics of a widget description, decoded once and shared by all the
+ * widgets of the same type with the same graphics (e.g. the frame of every
+ * app, or all the widgets of a UI that reconnects). The images it refers to
+ * are decoded when the template is made, so that the display thread only
+ * has to upload them. Everything else in a description (ids, position,
+ * label) differs between widgets and is parsed per widget.
+ * A template doesn't change once made and can be read from any thread.
+ */
+class sageDrawTemplate {
+private:
+  std::map<std::string, templateImage> images;   // by element name
+  TiXmlElement *graphics;   // the <graphics> element without the image data
+  int refs;
+  unsigned int lastUse;
+
+  friend class sageDrawTemplateCache;
+
+public:
+  char objectType[SAGE_NAME_LEN];
+
+  sageDrawTemplate();
+  ~sageDrawTemplate();
+
+  // decodes the images of a <graphics> element and keeps the rest of it
+  int init(const char *type, TiXmlElement *graphics);
+
+  // what the widgets parse their graphics info from
+  TiXmlElement* getGraphics() { return graphics; }
+
+  // same as getTextureFromXml() on the <graphics> element, but from the decoded image
+  GLuint getTexture(TiXmlElement *parent, const char *elementName);
+};
+
+// compact record of a widget to create: its ids, its description and the shared graphics
+struct drawObjectRecord {
+  int objID, widgetID, winID;
+  TiXmlElement *widget;   // the description without <graphics>, that is in tmpl
+  sageDrawTemplate *tmpl;
+};
+
+/**
+ * templates keyed by the widget type and its <graphics> element
+ */
+class sageDrawTemplateCache {
+private:
+  std::map<std::string, sageDrawTemplate*> templates;
+  pthread_mutex_t lock;
+  unsigned int useCount;
+  int hits, misses;
+
+  void evict();
+
+public:
+  sageDrawTemplateCache();
+  ~sageDrawTemplateCache();
+
+  static sageDrawTemplateCache& instance();
+
+  /**
+   * turns an ADD_OBJECT message ("objID type widgetID winID xml") into a
+   * record, decoding the images only if they haven't been seen before.
+   * Meant to be called off the display thread, but may be called from
+   * several threads. Returns NULL on error
+   */
+  drawObjectRecord* prepare(char *data);
+
+  // the record's widget was created, its template may be dropped later
+  void release(drawObjectRecord *rec);
+
+  int getHits() { return hits; }
+  int getMisses() { return misses; }
+};
+
+#endif
@@ -56,11 +56,14 @@
 #define EVENT_SYNC_MESSAGE   104
 #define EVENT_APP_CONNECTED  105
 #define EVENT_AUDIO_CONNECTION 106
+#define EVENT_NEW_OBJECT     107
+#define EVENT_FIRST_FRAME    108
 
 #define EVENT_SLAVE_PERF_INFO  200
 #define EVENT_MASTER_PERF_INFO 201
 #define EVENT_APP_SHUTDOWN     202
 #define EVENT_BRIDGE_SHUTDOWN  203
+#define EVENT_NODE_LOAD_INFO   204
 
 /**
  * sageEvent
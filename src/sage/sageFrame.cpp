@@ -64,18 +64,12 @@ int sageBlockFrame::initFrame(sageBlockPartition *part)
   return 0;
 }
 
-bool sageBlockFrame::extractPixelBlock(sagePixelBlock *block, int rowOrder)
+char* sageBlockFrame::locateBlock(sagePixelBlock *block, int rowOrder, int &stride, int &rows)
 {
-  if (!block) {
-    SAGE_PRINTLOG("sageBlockFrame::extractPixelBlock : block is NULL");
-    //return false;
-  }
-
   partition->getVisibleBlock(idx, *block);
   sageRect blockRect = *block;
   blockRect.moveOrigin(*this);
 
-  char *blockAddr;
   int yPos = 0;
   //std::cerr << "block addr " << blockRect.y*memWidth + blockRect.x*pixelSize << std::endl;
   if (rowOrder == BOTTOM_TO_TOP)
@@ -83,24 +77,14 @@ bool sageBlockFrame::extractPixelBlock(sagePixelBlock *block, int rowOrder)
   else
     yPos = (int)ceil((height-1-blockRect.y)/compressY);
 
-  blockAddr = pixelData + yPos*memWidth + blockRect.x*pixelSize;
+  stride = (rowOrder == BOTTOM_TO_TOP) ? memWidth : -memWidth;
+  rows = (int)ceil(block->height/compressY);
 
-  char *blockBuf = block->getPixelBuffer();
-
-  int srcHeight = (int)ceil(block->height/compressY);
-  int srcWidth = block->width*pixelSize;
-
-  for (int i=0; i<srcHeight; i++) {
-    memcpy(blockBuf, blockAddr, srcWidth);
-    blockBuf += srcWidth;
-    if (rowOrder == BOTTOM_TO_TOP) {
-      blockAddr += memWidth;
-    }
-    else {
-      blockAddr -= memWidth;
-    }
-  }
+  return pixelData + yPos*memWidth + blockRect.x*pixelSize;
+}
 
+bool sageBlockFrame::nextBlock(sagePixelBlock *block)
+{
   partition->adjustBlockCoord(*block);
 
   idx++;
@@ -113,6 +97,72 @@ bool sageBlockFrame::extractPixelBlock(sagePixelBlock *block, int rowOrder)
   return true;  // continue extraction
 }
 
+bool sageBlockFrame::extractPixelBlock(sagePixelBlock *block, int rowOrder, bool inPlace)
+{
+  if (!block) {
+    SAGE_PRINTLOG("sageBlockFrame::extractPixelBlock : block is NULL");
+    //return false;
+  }
+
+  int stride, srcHeight;
+  char *blockAddr = locateBlock(block, rowOrder, stride, srcHeight);
+  int srcWidth = block->width*pixelSize;
+
+  if (inPlace) {
+    block->setSource(blockAddr, stride, srcHeight, srcWidth);
+  }
+  else {
+    char *blockBuf = block->getPixelBuffer();
+    block->clearSource();
+
+    for (int i=0; i<srcHeight; i++) {
+      memcpy(blockBuf, blockAddr, srcWidth);
+      blockBuf += srcWidth;
+      blockAddr += stride;
+    }
+  }
+
+  return nextBlock(block);
+}
+
+bool sageBlockFrame::extractS3DPlanes(sagePixelBlock *left, sagePixelBlock *right, int rowOrder)
+{
+  int stride, rows;
+  char *blockAddr = locateBlock(left, rowOrder, stride, rows);
+  int width = left->width;
+
+  char *leftBuf = left->getPixelBuffer();
+  char *rightBuf = right->getPixelBuffer();
+  left->clearSource();
+  right->clearSource();
+  left->setPayloadSize(0);
+  right->setPayloadSize(0);
+
+  // RGBS3D pixels are 3 bytes of the left eye followed by 3 of the right
+  for (int i=0; i<rows; i++) {
+    char *src = blockAddr;
+    for (int j=0; j<width; j++) {
+      leftBuf[0] = src[0];
+      leftBuf[1] = src[1];
+      leftBuf[2] = src[2];
+      rightBuf[0] = src[3];
+      rightBuf[1] = src[4];
+      rightBuf[2] = src[5];
+      leftBuf += 3;
+      rightBuf += 3;
+      src += 6;
+    }
+    blockAddr += stride;
+  }
+
+  bool more = nextBlock(left);
+
+  right->sageRect::operator=(*left);
+  right->setID(left->getID());
+
+  return more;
+}
+
 int sageBlockFrame::generateBlocks(int rowOrd)
 {
   return 0;
@@ -64,13 +64,30 @@ protected:
   int memWidth;
   sageBlockPartition *partition;
 
+  // where the rows of the next visible block are in the frame
+  char* locateBlock(sagePixelBlock *block, int rowOrder, int &stride, int &rows);
+  bool nextBlock(sagePixelBlock *block);
+
 public:
   sageBlockFrame(int w, int h, int bytes, float compX = 1.0, float compY = 1.0);
 
   //inline void setBlockSize(int w, int h) { blockWidth = w, blockHeight = h; }
   int initFrame(sageBlockPartition *part);
   inline void resetBlockIndex() { idx = 0; }
-  bool extractPixelBlock(sagePixelBlock *block, int rowOrder);
+  /**
+   * fills block with the next visible block of the frame. If inPlace is true,
+   * the block only records where its rows are in the frame and
+   * sageBlockGroup::genIOV() sends them from there, so the frame must stay
+   * untouched until the block has been sent.
+   */
+  bool extractPixelBlock(sagePixelBlock *block, int rowOrder, bool inPlace = false);
+
+  /**
+   * like extractPixelBlock() for a PIXFMT_RGBS3D frame, but the eyes of the
+   * block are split into left and right, 3 bytes per pixel each. Both get
+   * the position and ID of the block
+   */
+  bool extractS3DPlanes(sagePixelBlock *left, sagePixelBlock *right, int rowOrder);
 
   int generateBlocks(int rowOrd);
   int generateSubFrame(sageRect &subRect, sageSubFrame &sFrame);
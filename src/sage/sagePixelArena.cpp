@@ -0,0 +1,264 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sagePixelArena.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sagePixelArena.h"
+#include "sageAffinity.h"
+#include "sageTelemetry.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telReserved = telemetry.gauge("sage_arena_reserved_bytes", "pixel memory mapped by the arena");
+static int telUsed = telemetry.gauge("sage_arena_used_bytes", "pixel memory handed out by the arena");
+static int telHuge = telemetry.gauge("sage_arena_huge_bytes", "arena memory on explicit huge pages");
+static int telLocked = telemetry.gauge("sage_arena_locked_bytes", "arena memory locked in RAM");
+static int telAllocs = telemetry.counter("sage_arena_allocs_total", "chunks handed out by the arena");
+static int telReuses = telemetry.counter("sage_arena_reuses_total", "chunks taken from a free list");
+static int telSlabs = telemetry.counter("sage_arena_slabs_total", "slabs and large chunks mapped");
+
+// off if the variable is "0"
+static bool envSwitch(const char *name)
+{
+  char *value = getenv(name);
+  return !(value && strcmp(value, "0") == 0);
+}
+
+sagePixelArena::sagePixelArena()
+{
+  pthread_mutex_init(&lock, NULL);
+
+#if defined(__linux__)
+  enabled = envSwitch("SAGE_PIXEL_ARENA");
+#else
+  enabled = false;
+#endif
+  lockPages = envSwitch("SAGE_PIXEL_ARENA_MLOCK");
+}
+
+sagePixelArena& sagePixelArena::instance()
+{
+  static sagePixelArena arena;
+  return arena;
+}
+
+int sagePixelArena::mapSlab(size_t size, int node)
+{
+#if defined(__linux__)
+  arenaSlab slab;
+  slab.size = (size + ARENA_PAGE_SIZE - 1) / ARENA_PAGE_SIZE * ARENA_PAGE_SIZE;
+  slab.used = 0;
+  slab.node = node;
+  slab.huge = false;
+  slab.locked = false;
+
+  void *addr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  addr = mmap(NULL, slab.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  slab.huge = (addr != MAP_FAILED);
+#endif
+
+  if (addr == MAP_FAILED) {
+    addr = mmap(NULL, slab.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      SAGE_PRINTLOG("sagePixelArena : fail to map %ld bytes", (long)slab.size);
+      return -1;
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(addr, slab.size, MADV_HUGEPAGE);
+#endif
+  }
+  slab.base = (char *)addr;
+
+  if (node >= 0)
+    sageAffinity::placeMemory(addr, slab.size, node);
+
+  // fault it in now rather than on the first frames
+  memset(addr, 0, slab.size);
+
+  if (lockPages) {
+    if (mlock(addr, slab.size) == 0)
+      slab.locked = true;
+    else {
+      lockPages = false;
+      SAGE_PRINTLOG("sagePixelArena : can't lock pixel memory (RLIMIT_MEMLOCK), going on unlocked");
+    }
+  }
+
+  telemetry.add(telReserved, slab.size);
+  telemetry.add(telSlabs);
+  if (slab.huge)
+    telemetry.add(telHuge, slab.size);
+  if (slab.locked)
+    telemetry.add(telLocked, slab.size);
+
+  // reuse the entry of an unmapped large chunk
+  for (int i=0; i<(int)slabs.size(); i++) {
+    if (!slabs[i].base) {
+      slabs[i] = slab;
+      return i;
+    }
+  }
+
+  slabs.push_back(slab);
+  return (int)slabs.size() - 1;
+#else
+  return -1;
+#endif
+}
+
+void sagePixelArena::unmapSlab(int idx)
+{
+  arenaSlab &slab = slabs[idx];
+
+  telemetry.add(telReserved, -(long long)slab.size);
+  if (slab.huge)
+    telemetry.add(telHuge, -(long long)slab.size);
+  if (slab.locked)
+    telemetry.add(telLocked, -(long long)slab.size);
+
+#if defined(__linux__)
+  munmap(slab.base, slab.size);
+#endif
+  slab.base = NULL;
+}
+
+char* sagePixelArena::alloc(size_t size)
+{
+  char *addr = NULL;
+
+  if (enabled) {
+    size = (size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+    int node = sageAffinity::instance().placementNode();
+    arenaChunk chunk;
+    chunk.size = size;
+    chunk.node = node;
+    chunk.slab = -1;
+    chunk.large = (size >= ARENA_LARGE_SIZE);
+
+    bool reused = false;
+
+    pthread_mutex_lock(&lock);
+
+    if (chunk.large) {
+      chunk.slab = mapSlab(size, node);
+      if (chunk.slab >= 0) {
+        addr = slabs[chunk.slab].base;
+        slabs[chunk.slab].used = size;
+      }
+    }
+    else {
+      std::vector<char*> &freeList = freeLists[std::make_pair(node, size)];
+      if (freeList.size() > 0) {
+        addr = freeList.back();
+        freeList.pop_back();
+        reused = true;
+        telemetry.add(telReuses);
+      }
+      else {
+        std::map<int, int>::iterator it = carving.find(node);
+        chunk.slab = (it != carving.end()) ? it->second : -1;
+
+        if (chunk.slab < 0 || slabs[chunk.slab].size - slabs[chunk.slab].used < size) {
+          // each slab as large as the node's slabs so far
+          size_t slabSize = MIN(MAX(slabBytes[node], (size_t)ARENA_PAGE_SIZE), (size_t)ARENA_MAX_SLAB);
+          chunk.slab = mapSlab(slabSize, node);
+          if (chunk.slab >= 0) {
+            carving[node] = chunk.slab;
+            slabBytes[node] += slabs[chunk.slab].size;
+          }
+        }
+
+        if (chunk.slab >= 0) {
+          addr = slabs[chunk.slab].base + slabs[chunk.slab].used;
+          slabs[chunk.slab].used += size;
+        }
+      }
+    }
+
+    if (addr)
+      chunks[addr] = chunk;
+
+    pthread_mutex_unlock(&lock);
+
+    if (addr) {
+      // fresh chunks come zeroed from the mapping, reused ones have old pixels
+      if (reused)
+        memset(addr, 0, size);
+      telemetry.add(telUsed, size);
+      telemetry.add(telAllocs);
+      return addr;
+    }
+  }
+
+  // no arena, or out of mappings
+  addr = (char *)malloc(size);
+  if (addr)
+    memset(addr, 0, size);
+
+  return addr;
+}
+
+void sagePixelArena::release(char *addr)
+{
+  if (!addr)
+    return;
+
+  if (enabled) {
+    pthread_mutex_lock(&lock);
+    std::map<char*, arenaChunk>::iterator it = chunks.find(addr);
+    if (it != chunks.end()) {
+      arenaChunk chunk = it->second;
+      if (chunk.large) {
+        unmapSlab(chunk.slab);
+        chunks.erase(it);
+      }
+      else
+        freeLists[std::make_pair(chunk.node, chunk.size)].push_back(addr);
+      pthread_mutex_unlock(&lock);
+
+      telemetry.add(telUsed, -(long long)chunk.size);
+      return;
+    }
+    pthread_mutex_unlock(&lock);
+  }
+
+  free(addr);
+}
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sagePixelArena.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_PIXEL_ARENA_H
+#define SAGE_PIXEL_ARENA_H
+
+#include "sageBase.h"
+#include "misc.h"
+#include <map>
+#include <vector>
+
+// slabs are mapped in multiples of a huge page
+#define ARENA_PAGE_SIZE  (2*1024*1024)
+
+// a node's slabs double from one huge page up to that
+#define ARENA_MAX_SLAB   (16*1024*1024)
+
+// allocations that large get a mapping of their own, frames mostly
+#define ARENA_LARGE_SIZE ARENA_PAGE_SIZE
+
+// chunks start on cache lines
+#define ARENA_ALIGN      64
+
+struct arenaSlab {
+  char *base;     // NULL once a large chunk's mapping is gone
+  size_t size;
+  size_t used;
+  int node;
+  bool huge;      // explicit huge pages, otherwise transparent ones if any
+  bool locked;
+};
+
+struct arenaChunk {
+  size_t size;
+  int node;
+  int slab;
+  bool large;
+};
+
+/**
+ * Pixel memory of the blocks and frames. Small chunks are carved from
+ * slabs of 2MB huge pages, one slab list per NUMA node, and go back to a
+ * free list of their size, as the block sizes of a stream repeat. Large
+ * ones, frames mostly, get a mapping of their own that is unmapped when
+ * they are released. The node is the one of the affinityPlacement of the
+ * allocating thread. Slabs are faulted in when mapped and mlock'ed as
+ * long as RLIMIT_MEMLOCK allows.
+ *
+ * Explicit huge pages are used if some are reserved (vm.nr_hugepages),
+ * otherwise the slabs are advised for transparent ones. SAGE_PIXEL_ARENA=0
+ * turns the arena off, SAGE_PIXEL_ARENA_MLOCK=0 the locking. On other
+ * platforms than Linux chunks come from malloc.
+ */
+class sagePixelArena {
+private:
+  pthread_mutex_t lock;
+  bool enabled;
+  bool lockPages;
+
+  std::vector<arenaSlab> slabs;
+  std::map<int, int> carving;   // node -> slab chunks are carved from
+  std::map<int, size_t> slabBytes;  // node -> bytes of its slabs, without the large chunks
+  std::map<std::pair<int, size_t>, std::vector<char*> > freeLists;
+  std::map<char*, arenaChunk> chunks;
+
+  sagePixelArena();
+
+  int mapSlab(size_t size, int node);
+  void unmapSlab(int idx);
+
+public:
+  static sagePixelArena& instance();
+
+  inline bool isEnabled() { return enabled; }
+
+  /** memory of size bytes, zeroed and faulted in. NULL if there is none */
+  char* alloc(size_t size);
+  void release(char *addr);
+};
+
+#endif
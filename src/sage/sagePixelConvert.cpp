@@ -0,0 +1,799 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sagePixelConvert.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sagePixelConvert.h"
+#include "misc.h"
+
+// SSSE3 kernels are compiled with a function attribute and picked at run time,
+// so the library still runs on CPUs without them
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define CONV_SSSE3
+#include <tmmintrin.h>
+#define SSSE3_FN __attribute__((target("ssse3")))
+#endif
+
+/**
+ * converts one row of width pixels. src holds the rows of the source planes
+ * (only src[0] for packed formats), flags are the ones of sageConvertImage()
+ */
+typedef void (*convRowFn)(const unsigned char **src, unsigned char *dst, int width, int flags);
+
+static int simdState = -1;   // -1 : CPU not probed yet
+
+static bool useSIMD()
+{
+#ifdef CONV_SSSE3
+  if (simdState < 0) {
+    __builtin_cpu_init();
+    simdState = __builtin_cpu_supports("ssse3") ? 1 : 0;
+  }
+  return simdState > 0;
+#else
+  return false;
+#endif
+}
+
+bool sageConvertSIMD(bool on)
+{
+  simdState = on ? -1 : 0;
+  return useSIMD();
+}
+
+const char* sageConvFmtName(sageConvFmt fmt)
+{
+  static const char *names[CONVFMT_MAX] = { "RGB", "BGR", "RGBA", "BGRA", "UYVY",
+                                            "YUYV", "YUV420", "565", "555", "RGB_SBS" };
+  if (fmt < 0 || fmt >= CONVFMT_MAX)
+    return "unknown";
+
+  return names[fmt];
+}
+
+int sageConvertSize(sageConvFmt fmt, int width, int height)
+{
+  int cw = (width+1)/2, ch = (height+1)/2;
+
+  switch(fmt) {
+  case CONVFMT_RGB:
+  case CONVFMT_BGR:
+    return width*height*3;
+  case CONVFMT_RGBA:
+  case CONVFMT_BGRA:
+    return width*height*4;
+  case CONVFMT_UYVY:
+  case CONVFMT_YUYV:
+    return cw*4*height;
+  case CONVFMT_YUV420:
+    return width*height + cw*ch*2;
+  case CONVFMT_565:
+  case CONVFMT_555:
+    return width*height*2;
+  case CONVFMT_RGB_SBS:
+    return width*height*6;
+  default:
+    return 0;
+  }
+}
+
+static inline unsigned char clampByte(int v)
+{
+  return (unsigned char)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+// BT.601 video range, the same matrix as the YUV shader of the display,
+// in 6 bit fixed point so the SIMD kernels give the same results
+static inline void yuvToRgb(int y, int u, int v, unsigned char *rgb)
+{
+  int c = (y - 16) * 74;
+  u -= 128;
+  v -= 128;
+  rgb[0] = clampByte((c + 102*v) >> 6);
+  rgb[1] = clampByte((c - 25*u - 52*v) >> 6);
+  rgb[2] = clampByte((c + 129*u) >> 6);
+}
+
+static inline int rgbToY(int r, int g, int b)
+{
+  return ((66*r + 129*g + 25*b + 128) >> 8) + 16;
+}
+
+static inline int rgbToU(int r, int g, int b)
+{
+  return ((-38*r - 74*g + 112*b + 128) >> 8) + 128;
+}
+
+static inline int rgbToV(int r, int g, int b)
+{
+  return ((112*r - 94*g - 18*b + 128) >> 8) + 128;
+}
+
+/*
+ * scalar kernels, also used for the pixels left over by the SIMD kernels
+ */
+
+static void swapRB(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i++, s+=3, dst+=3) {
+    dst[0] = s[2];
+    dst[1] = s[1];
+    dst[2] = s[0];
+  }
+}
+
+static void rgbaToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i++, s+=4, dst+=3) {
+    dst[0] = s[0];
+    dst[1] = s[1];
+    dst[2] = s[2];
+  }
+}
+
+static void bgraToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i++, s+=4, dst+=3) {
+    dst[0] = s[2];
+    dst[1] = s[1];
+    dst[2] = s[0];
+  }
+}
+
+static void rgbToRgba(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i++, s+=3, dst+=4) {
+    dst[0] = s[0];
+    dst[1] = s[1];
+    dst[2] = s[2];
+    dst[3] = 255;
+  }
+}
+
+static void rgbToBgra(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i++, s+=3, dst+=4) {
+    dst[0] = s[2];
+    dst[1] = s[1];
+    dst[2] = s[0];
+    dst[3] = 255;
+  }
+}
+
+// packed 4:2:2, yOff is the offset of the first luma byte in a pixel pair
+static inline void packedToRgb(const unsigned char *s, unsigned char *dst, int width, int yOff)
+{
+  int uOff = 1 - yOff, vOff = 3 - yOff;
+  for (int i=0; i<width; i+=2, s+=4, dst+=6) {
+    yuvToRgb(s[yOff], s[uOff], s[vOff], dst);
+    if (i+1 < width)
+      yuvToRgb(s[yOff+2], s[uOff], s[vOff], dst+3);
+  }
+}
+
+static void uyvyToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  packedToRgb(src[0], dst, width, 1);
+}
+
+static void yuyvToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  packedToRgb(src[0], dst, width, 0);
+}
+
+static void yuv420ToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *y = src[0], *u = src[1], *v = src[2];
+  for (int i=0; i<width; i++, dst+=3)
+    yuvToRgb(y[i], u[i/2], v[i/2], dst);
+}
+
+static void rgb565ToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned short *s = (const unsigned short *)src[0];
+  for (int i=0; i<width; i++, dst+=3) {
+    int r = s[i] >> 11, g = (s[i] >> 5) & 0x3f, b = s[i] & 0x1f;
+    dst[0] = (r << 3) | (r >> 2);
+    dst[1] = (g << 2) | (g >> 4);
+    dst[2] = (b << 3) | (b >> 2);
+  }
+}
+
+static void rgb555ToRgb(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned short *s = (const unsigned short *)src[0];
+  for (int i=0; i<width; i++, dst+=3) {
+    int r = (s[i] >> 10) & 0x1f, g = (s[i] >> 5) & 0x1f, b = s[i] & 0x1f;
+    dst[0] = (r << 3) | (r >> 2);
+    dst[1] = (g << 3) | (g >> 2);
+    dst[2] = (b << 3) | (b >> 2);
+  }
+}
+
+static void rgbTo565(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  unsigned short *d = (unsigned short *)dst;
+  for (int i=0; i<width; i++, s+=3)
+    d[i] = ((s[0] >> 3) << 11) | ((s[1] >> 2) << 5) | (s[2] >> 3);
+}
+
+static void rgbTo565Inv(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  unsigned short *d = (unsigned short *)dst;
+  for (int i=0; i<width; i++, s+=3)
+    d[i] = ((s[2] >> 3) << 11) | ((s[1] >> 2) << 5) | (s[0] >> 3);
+}
+
+// PIXFMT_555 is GL_UNSIGNED_SHORT_5_5_5_1, the alpha bit is the lowest one
+static void rgbTo5551(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  unsigned short *d = (unsigned short *)dst;
+  for (int i=0; i<width; i++, s+=3)
+    d[i] = ((s[0] >> 3) << 11) | ((s[1] >> 3) << 6) | ((s[2] >> 3) << 1) | 1;
+}
+
+static void rgbTo5551Inv(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  unsigned short *d = (unsigned short *)dst;
+  for (int i=0; i<width; i++, s+=3)
+    d[i] = ((s[2] >> 3) << 11) | ((s[1] >> 3) << 6) | ((s[0] >> 3) << 1) | 1;
+}
+
+// chroma is the average of the pixel pair
+static void rgbToUyvy(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i+=2, s+=6, dst+=4) {
+    if (i+1 == width) {
+      dst[0] = rgbToU(s[0], s[1], s[2]);
+      dst[1] = rgbToY(s[0], s[1], s[2]);
+      break;
+    }
+    int r = (s[0] + s[3] + 1) >> 1, g = (s[1] + s[4] + 1) >> 1, b = (s[2] + s[5] + 1) >> 1;
+    dst[0] = rgbToU(r, g, b);
+    dst[1] = rgbToY(s[0], s[1], s[2]);
+    dst[2] = rgbToV(r, g, b);
+    dst[3] = rgbToY(s[3], s[4], s[5]);
+  }
+}
+
+static void yuv420ToUyvy(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *y = src[0], *u = src[1], *v = src[2];
+  for (int i=0; i<width; i+=2, dst+=4) {
+    dst[0] = u[i/2];
+    dst[1] = y[i];
+    if (i+1 == width)
+      break;
+    dst[2] = v[i/2];
+    dst[3] = y[i+1];
+  }
+}
+
+static void yuyvToUyvy(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  for (int i=0; i<width; i++, s+=2, dst+=2) {
+    dst[0] = s[1];
+    dst[1] = s[0];
+  }
+}
+
+// a stereo pair side by side into PIXFMT_RGBS3D, left and right pixel interleaved
+static void sbsToS3D(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *first = src[0], *second = src[0] + width*3;
+  if (flags & CONV_SWAP_EYES) {
+    const unsigned char *t = first;
+    first = second;
+    second = t;
+  }
+
+  for (int i=0; i<width; i++, first+=3, second+=3, dst+=6) {
+    dst[0] = first[0];
+    dst[1] = first[1];
+    dst[2] = first[2];
+    dst[3] = second[0];
+    dst[4] = second[1];
+    dst[5] = second[2];
+  }
+}
+
+#ifdef CONV_SSSE3
+
+/*
+ * SIMD kernels, each one leaves the end of the row to the scalar kernel
+ */
+
+// byte shuffles to interleave 16 R, 16 G and 16 B bytes into 48 bytes of RGB
+static const unsigned char interleaveMask[3][3][16] = {
+  { { 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80, 0x80, 5 },
+    { 0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80, 0x80 },
+    { 0x80, 0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80 } },
+  { { 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80, 10, 0x80 },
+    { 5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80, 10 },
+    { 0x80, 5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80 } },
+  { { 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15, 0x80, 0x80 },
+    { 0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15, 0x80 },
+    { 10, 0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15 } }
+};
+
+static const unsigned char swapRBMask[16] = { 2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15 };
+
+static const unsigned char dropAlphaMask[2][16] = {
+  { 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0x80, 0x80, 0x80, 0x80 },
+  { 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0x80, 0x80, 0x80, 0x80 }
+};
+
+static const unsigned char addAlphaMask[2][16] = {
+  { 0, 1, 2, 0x80, 3, 4, 5, 0x80, 6, 7, 8, 0x80, 9, 10, 11, 0x80 },
+  { 2, 1, 0, 0x80, 5, 4, 3, 0x80, 8, 7, 6, 0x80, 11, 10, 9, 0x80 }
+};
+
+// side by side to RGBS3D : 8 pixels of each eye, read at byte offsets 0, 6 and 8
+static const unsigned char s3dMask[2][3][16] = {
+  { { 0, 1, 2, 0x80, 0x80, 0x80, 3, 4, 5, 0x80, 0x80, 0x80, 6, 7, 8, 0x80 },
+    { 0x80, 0x80, 3, 4, 5, 0x80, 0x80, 0x80, 6, 7, 8, 0x80, 0x80, 0x80, 9, 10 },
+    { 9, 0x80, 0x80, 0x80, 10, 11, 12, 0x80, 0x80, 0x80, 13, 14, 15, 0x80, 0x80, 0x80 } },
+  { { 0x80, 0x80, 0x80, 0, 1, 2, 0x80, 0x80, 0x80, 3, 4, 5, 0x80, 0x80, 0x80, 6 },
+    { 1, 2, 0x80, 0x80, 0x80, 3, 4, 5, 0x80, 0x80, 0x80, 6, 7, 8, 0x80, 0x80 },
+    { 0x80, 7, 8, 9, 0x80, 0x80, 0x80, 10, 11, 12, 0x80, 0x80, 0x80, 13, 14, 15 } }
+};
+
+#define LOADU(p)  _mm_loadu_si128((const __m128i *)(p))
+#define STOREU(p, v)  _mm_storeu_si128((__m128i *)(p), v)
+
+SSSE3_FN static inline void storeRGB(unsigned char *dst, __m128i r, __m128i g, __m128i b,
+                                      const __m128i *m)
+{
+  for (int i=0; i<3; i++) {
+    __m128i o = _mm_or_si128(_mm_shuffle_epi8(r, m[i*3]), _mm_shuffle_epi8(g, m[i*3+1]));
+    STOREU(dst + i*16, _mm_or_si128(o, _mm_shuffle_epi8(b, m[i*3+2])));
+  }
+}
+
+SSSE3_FN static inline void loadInterleave(__m128i *m)
+{
+  for (int i=0; i<9; i++)
+    m[i] = LOADU(interleaveMask[i/3][i%3]);
+}
+
+// 8 pixels in 16 bit lanes, same arithmetic as yuvToRgb()
+SSSE3_FN static inline void yuvToRgb8(__m128i y, __m128i u, __m128i v,
+                                       __m128i &r, __m128i &g, __m128i &b)
+{
+  const __m128i c128 = _mm_set1_epi16(128);
+  __m128i c = _mm_mullo_epi16(_mm_sub_epi16(y, _mm_set1_epi16(16)), _mm_set1_epi16(74));
+  u = _mm_sub_epi16(u, c128);
+  v = _mm_sub_epi16(v, c128);
+
+  r = _mm_srai_epi16(_mm_adds_epi16(c, _mm_mullo_epi16(v, _mm_set1_epi16(102))), 6);
+  g = _mm_subs_epi16(c, _mm_mullo_epi16(u, _mm_set1_epi16(25)));
+  g = _mm_srai_epi16(_mm_subs_epi16(g, _mm_mullo_epi16(v, _mm_set1_epi16(52))), 6);
+  b = _mm_srai_epi16(_mm_adds_epi16(c, _mm_mullo_epi16(u, _mm_set1_epi16(129))), 6);
+}
+
+SSSE3_FN static void swapRB_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *s = src[0];
+  const __m128i m = LOADU(swapRBMask);
+  int i = 0;
+
+  // 5 pixels at a time, the 16th byte is rewritten by the next step
+  for (; i+6 <= width; i+=5)
+    STOREU(dst + i*3, _mm_shuffle_epi8(LOADU(s + i*3), m));
+
+  const unsigned char *rest = s + i*3;
+  swapRB(&rest, dst + i*3, width - i, flags);
+}
+
+SSSE3_FN static inline int dropAlpha(const unsigned char *s, unsigned char *dst, int width,
+                                      const unsigned char *mask)
+{
+  const __m128i m = LOADU(mask);
+  int i = 0;
+  for (; i+6 <= width; i+=4)
+    STOREU(dst + i*3, _mm_shuffle_epi8(LOADU(s + i*4), m));
+
+  return i;
+}
+
+SSSE3_FN static void rgbaToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  int i = dropAlpha(src[0], dst, width, dropAlphaMask[0]);
+  const unsigned char *rest = src[0] + i*4;
+  rgbaToRgb(&rest, dst + i*3, width - i, flags);
+}
+
+SSSE3_FN static void bgraToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  int i = dropAlpha(src[0], dst, width, dropAlphaMask[1]);
+  const unsigned char *rest = src[0] + i*4;
+  bgraToRgb(&rest, dst + i*3, width - i, flags);
+}
+
+SSSE3_FN static inline int addAlpha(const unsigned char *s, unsigned char *dst, int width,
+                                     const unsigned char *mask)
+{
+  const __m128i m = LOADU(mask);
+  const __m128i alpha = _mm_set1_epi32(0xff000000);
+  int i = 0;
+  for (; i+6 <= width; i+=4)
+    STOREU(dst + i*4, _mm_or_si128(_mm_shuffle_epi8(LOADU(s + i*3), m), alpha));
+
+  return i;
+}
+
+SSSE3_FN static void rgbToRgba_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  int i = addAlpha(src[0], dst, width, addAlphaMask[0]);
+  const unsigned char *rest = src[0] + i*3;
+  rgbToRgba(&rest, dst + i*4, width - i, flags);
+}
+
+SSSE3_FN static void rgbToBgra_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  int i = addAlpha(src[0], dst, width, addAlphaMask[1]);
+  const unsigned char *rest = src[0] + i*3;
+  rgbToBgra(&rest, dst + i*4, width - i, flags);
+}
+
+SSSE3_FN static inline void packedToRgb_ssse3(const unsigned char *s, unsigned char *dst, int width, int yOff)
+{
+  const __m128i lo = _mm_set1_epi16(0xff);
+  __m128i m[9];
+  loadInterleave(m);
+
+  int i = 0;
+  for (; i+16 <= width; i+=16) {
+    __m128i y[2], u[2], v[2], r[2], g[2], b[2];
+    for (int k=0; k<2; k++) {
+      __m128i p = LOADU(s + i*2 + k*16);
+      __m128i uv;
+      if (yOff) {
+        y[k] = _mm_srli_epi16(p, 8);
+        uv = _mm_and_si128(p, lo);
+      }
+      else {
+        y[k] = _mm_and_si128(p, lo);
+        uv = _mm_srli_epi16(p, 8);
+      }
+      // U0 V0 U1 V1 .. into U0 U0 U1 U1 .. and V0 V0 V1 V1 ..
+      u[k] = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, _MM_SHUFFLE(2,2,0,0)), _MM_SHUFFLE(2,2,0,0));
+      v[k] = _mm_shufflehi_epi16(_mm_shufflelo_epi16(uv, _MM_SHUFFLE(3,3,1,1)), _MM_SHUFFLE(3,3,1,1));
+      yuvToRgb8(y[k], u[k], v[k], r[k], g[k], b[k]);
+    }
+    storeRGB(dst + i*3, _mm_packus_epi16(r[0], r[1]), _mm_packus_epi16(g[0], g[1]),
+             _mm_packus_epi16(b[0], b[1]), m);
+  }
+
+  packedToRgb(s + i*2, dst + i*3, width - i, yOff);
+}
+
+SSSE3_FN static void uyvyToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  packedToRgb_ssse3(src[0], dst, width, 1);
+}
+
+SSSE3_FN static void yuyvToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  packedToRgb_ssse3(src[0], dst, width, 0);
+}
+
+SSSE3_FN static void yuv420ToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i m[9];
+  loadInterleave(m);
+
+  int i = 0;
+  for (; i+16 <= width; i+=16) {
+    __m128i y = LOADU(src[0] + i);
+    __m128i u = _mm_loadl_epi64((const __m128i *)(src[1] + i/2));
+    __m128i v = _mm_loadl_epi64((const __m128i *)(src[2] + i/2));
+    u = _mm_unpacklo_epi8(u, u);
+    v = _mm_unpacklo_epi8(v, v);
+
+    __m128i r0, g0, b0, r1, g1, b1;
+    yuvToRgb8(_mm_unpacklo_epi8(y, zero), _mm_unpacklo_epi8(u, zero), _mm_unpacklo_epi8(v, zero), r0, g0, b0);
+    yuvToRgb8(_mm_unpackhi_epi8(y, zero), _mm_unpackhi_epi8(u, zero), _mm_unpackhi_epi8(v, zero), r1, g1, b1);
+    storeRGB(dst + i*3, _mm_packus_epi16(r0, r1), _mm_packus_epi16(g0, g1), _mm_packus_epi16(b0, b1), m);
+  }
+
+  const unsigned char *rest[3] = { src[0] + i, src[1] + i/2, src[2] + i/2 };
+  yuv420ToRgb(rest, dst + i*3, width - i, flags);
+}
+
+// 5 or 6 bit channels to 8 bits, repeating the high bits in the low ones
+SSSE3_FN static inline __m128i expand5(__m128i c)
+{
+  return _mm_or_si128(_mm_slli_epi16(c, 3), _mm_srli_epi16(c, 2));
+}
+
+SSSE3_FN static inline void rgb16ToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, bool is565)
+{
+  const __m128i mask5 = _mm_set1_epi16(0x1f), mask6 = _mm_set1_epi16(0x3f);
+  __m128i m[9];
+  loadInterleave(m);
+
+  int i = 0;
+  for (; i+16 <= width; i+=16) {
+    __m128i r[2], g[2], b[2];
+    for (int k=0; k<2; k++) {
+      __m128i p = LOADU(src[0] + i*2 + k*16);
+      b[k] = expand5(_mm_and_si128(p, mask5));
+      if (is565) {
+        r[k] = expand5(_mm_srli_epi16(p, 11));
+        g[k] = _mm_and_si128(_mm_srli_epi16(p, 5), mask6);
+        g[k] = _mm_or_si128(_mm_slli_epi16(g[k], 2), _mm_srli_epi16(g[k], 4));
+      }
+      else {
+        r[k] = expand5(_mm_and_si128(_mm_srli_epi16(p, 10), mask5));
+        g[k] = expand5(_mm_and_si128(_mm_srli_epi16(p, 5), mask5));
+      }
+    }
+    storeRGB(dst + i*3, _mm_packus_epi16(r[0], r[1]), _mm_packus_epi16(g[0], g[1]),
+             _mm_packus_epi16(b[0], b[1]), m);
+  }
+
+  const unsigned char *rest = src[0] + i*2;
+  if (is565)
+    rgb565ToRgb(&rest, dst + i*3, width - i, 0);
+  else
+    rgb555ToRgb(&rest, dst + i*3, width - i, 0);
+}
+
+SSSE3_FN static void rgb565ToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  rgb16ToRgb_ssse3(src, dst, width, true);
+}
+
+SSSE3_FN static void rgb555ToRgb_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  rgb16ToRgb_ssse3(src, dst, width, false);
+}
+
+SSSE3_FN static void yuv420ToUyvy_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  int i = 0;
+  for (; i+16 <= width; i+=16) {
+    __m128i y = LOADU(src[0] + i);
+    __m128i u = _mm_loadl_epi64((const __m128i *)(src[1] + i/2));
+    __m128i v = _mm_loadl_epi64((const __m128i *)(src[2] + i/2));
+    __m128i uv = _mm_unpacklo_epi8(u, v);
+    STOREU(dst + i*2, _mm_unpacklo_epi8(uv, y));
+    STOREU(dst + i*2 + 16, _mm_unpackhi_epi8(uv, y));
+  }
+
+  const unsigned char *rest[3] = { src[0] + i, src[1] + i/2, src[2] + i/2 };
+  yuv420ToUyvy(rest, dst + i*2, width - i, flags);
+}
+
+SSSE3_FN static void yuyvToUyvy_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  int i = 0;
+  for (; i+8 <= width; i+=8) {
+    __m128i p = LOADU(src[0] + i*2);
+    STOREU(dst + i*2, _mm_or_si128(_mm_slli_epi16(p, 8), _mm_srli_epi16(p, 8)));
+  }
+
+  const unsigned char *rest = src[0] + i*2;
+  yuyvToUyvy(&rest, dst + i*2, width - i, flags);
+}
+
+SSSE3_FN static void sbsToS3D_ssse3(const unsigned char **src, unsigned char *dst, int width, int flags)
+{
+  const unsigned char *first = src[0], *second = src[0] + width*3;
+  if (flags & CONV_SWAP_EYES) {
+    const unsigned char *t = first;
+    first = second;
+    second = t;
+  }
+
+  __m128i m[2][3];
+  for (int k=0; k<3; k++) {
+    m[0][k] = LOADU(s3dMask[0][k]);
+    m[1][k] = LOADU(s3dMask[1][k]);
+  }
+
+  static const int offset[3] = { 0, 6, 8 };
+  int i = 0;
+  for (; i+8 <= width; i+=8) {
+    for (int k=0; k<3; k++) {
+      __m128i a = _mm_shuffle_epi8(LOADU(first + i*3 + offset[k]), m[0][k]);
+      __m128i b = _mm_shuffle_epi8(LOADU(second + i*3 + offset[k]), m[1][k]);
+      STOREU(dst + i*6 + k*16, _mm_or_si128(a, b));
+    }
+  }
+
+  // the scalar kernel finds the right eye width pixels after the left one
+  for (; i<width; i++) {
+    memcpy(dst + i*6, first + i*3, 3);
+    memcpy(dst + i*6 + 3, second + i*3, 3);
+  }
+}
+
+#define PICK(fn)  (simd ? fn##_ssse3 : fn)
+#else
+#define PICK(fn)  (fn)
+#endif
+
+// image layouts that are the same in both enums, converted with a plain copy
+static bool sameLayout(sageConvFmt src, sagePixFmt dst)
+{
+  return (src == CONVFMT_RGB && dst == PIXFMT_888) ||
+         (src == CONVFMT_BGR && dst == PIXFMT_888_INV) ||
+         (src == CONVFMT_RGBA && dst == PIXFMT_8888) ||
+         (src == CONVFMT_BGRA && dst == PIXFMT_8888_INV) ||
+         (src == CONVFMT_UYVY && dst == PIXFMT_YUV) ||
+         (src == CONVFMT_565 && dst == PIXFMT_565);
+}
+
+// kernels that don't go through RGB
+static convRowFn directKernel(sageConvFmt src, sagePixFmt dst, bool simd)
+{
+  if (src == CONVFMT_YUV420 && dst == PIXFMT_YUV)
+    return PICK(yuv420ToUyvy);
+  if (src == CONVFMT_YUYV && dst == PIXFMT_YUV)
+    return PICK(yuyvToUyvy);
+  if (src == CONVFMT_RGB_SBS && dst == PIXFMT_RGBS3D)
+    return PICK(sbsToS3D);
+
+  return NULL;
+}
+
+// first half of the other conversions. NULL and isRgb set : already RGB
+static convRowFn toRgbKernel(sageConvFmt src, bool simd, bool &isRgb)
+{
+  isRgb = false;
+
+  switch(src) {
+  case CONVFMT_RGB:    isRgb = true; return NULL;
+  case CONVFMT_BGR:    return PICK(swapRB);
+  case CONVFMT_RGBA:   return PICK(rgbaToRgb);
+  case CONVFMT_BGRA:   return PICK(bgraToRgb);
+  case CONVFMT_UYVY:   return PICK(uyvyToRgb);
+  case CONVFMT_YUYV:   return PICK(yuyvToRgb);
+  case CONVFMT_YUV420: return PICK(yuv420ToRgb);
+  case CONVFMT_565:    return PICK(rgb565ToRgb);
+  case CONVFMT_555:    return PICK(rgb555ToRgb);
+  default:             return NULL;
+  }
+}
+
+// second half. NULL and isRgb set : the destination is RGB
+static convRowFn fromRgbKernel(sagePixFmt dst, bool simd, bool &isRgb)
+{
+  isRgb = false;
+
+  switch(dst) {
+  case PIXFMT_888:      isRgb = true; return NULL;
+  case PIXFMT_888_INV:  return PICK(swapRB);
+  case PIXFMT_8888:     return PICK(rgbToRgba);
+  case PIXFMT_8888_INV: return PICK(rgbToBgra);
+  case PIXFMT_565:      return rgbTo565;
+  case PIXFMT_565_INV:  return rgbTo565Inv;
+  case PIXFMT_555:      return rgbTo5551;
+  case PIXFMT_555_INV:  return rgbTo5551Inv;
+  case PIXFMT_YUV:      return rgbToUyvy;
+  default:              return NULL;
+  }
+}
+
+int sageConvertImage(const void *src, sageConvFmt srcFmt, void *dst, sagePixFmt dstFmt,
+                     int width, int height, bool flip, int flags)
+{
+  if (!src || !dst || width <= 0 || height <= 0 || srcFmt < 0 || srcFmt >= CONVFMT_MAX) {
+    SAGE_PRINTLOG("sageConvertImage : invalid arguments\n");
+    return -1;
+  }
+
+  bool simd = useSIMD();
+  bool copy = sameLayout(srcFmt, dstFmt);
+  convRowFn direct = NULL, toRgb = NULL, fromRgb = NULL;
+
+  if (!copy)
+    direct = directKernel(srcFmt, dstFmt, simd);
+
+  if (!copy && !direct) {
+    bool srcRgb = false, dstRgb = false;
+    if (srcFmt != CONVFMT_RGB_SBS) {
+      toRgb = toRgbKernel(srcFmt, simd, srcRgb);
+      fromRgb = fromRgbKernel(dstFmt, simd, dstRgb);
+    }
+
+    if ((!toRgb && !srcRgb) || (!fromRgb && !dstRgb)) {
+      SAGE_PRINTLOG("sageConvertImage : can't convert %s into pixel format %d\n",
+                    sageConvFmtName(srcFmt), dstFmt);
+      return -1;
+    }
+  }
+
+  // RGB row between the two halves of a conversion
+  unsigned char *rgbRow = NULL;
+  if (toRgb && fromRgb)
+    rgbRow = new unsigned char[width*3];
+
+  const unsigned char *base = (const unsigned char *)src;
+  int srcPitch = sageConvertSize(srcFmt, width, 1);
+  int dstPitch = width * getPixelSize(dstFmt);
+
+  // chroma planes of YUV420 are half size in both directions
+  int cw = (width+1)/2;
+  const unsigned char *uPlane = base + width*height;
+  const unsigned char *vPlane = uPlane + cw*((height+1)/2);
+  if (srcFmt == CONVFMT_YUV420)
+    srcPitch = width;
+
+  for (int y=0; y<height; y++) {
+    const unsigned char *row[3] = { base + y*srcPitch, NULL, NULL };
+    if (srcFmt == CONVFMT_YUV420) {
+      row[1] = uPlane + (y/2)*cw;
+      row[2] = vPlane + (y/2)*cw;
+    }
+
+    unsigned char *out = (unsigned char *)dst + (flip ? height-1-y : y) * dstPitch;
+
+    if (copy)
+      memcpy(out, row[0], dstPitch);
+    else if (direct)
+      direct(row, out, width, flags);
+    else if (!fromRgb)
+      toRgb(row, out, width, flags);
+    else if (!toRgb)
+      fromRgb(row, out, width, flags);
+    else {
+      toRgb(row, rgbRow, width, flags);
+      const unsigned char *rgb = rgbRow;
+      fromRgb(&rgb, out, width, flags);
+    }
+  }
+
+  delete [] rgbRow;
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sagePixelConvert.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef _SAGE_PIXEL_CONVERT_H
+#define _SAGE_PIXEL_CONVERT_H
+
+#include "sageBase.h"
+
+/**
+ * pixel layouts an application can hand to SAIL, which converts them into
+ * the pixel format of the stream (sagePixFmt)
+ */
+enum sageConvFmt {
+  CONVFMT_RGB,      // 8 bit R, G, B
+  CONVFMT_BGR,      // 8 bit B, G, R
+  CONVFMT_RGBA,     // 8 bit R, G, B, A
+  CONVFMT_BGRA,     // 8 bit B, G, R, A
+  CONVFMT_UYVY,     // packed 4:2:2, U Y0 V Y1
+  CONVFMT_YUYV,     // packed 4:2:2, Y0 U Y1 V
+  CONVFMT_YUV420,   // planar 4:2:0 (I420), Y plane then U and V planes
+  CONVFMT_565,      // 16 bit, red in the high bits
+  CONVFMT_555,      // 16 bit X1R5G5B5, red in the high bits
+  CONVFMT_RGB_SBS,  // RGB stereo pair side by side, left eye first
+  CONVFMT_MAX
+};
+
+// CONVFMT_RGB_SBS to PIXFMT_RGBS3D : the right half of the source goes first
+#define CONV_SWAP_EYES  1
+
+/**
+ * converts a width x height image in format srcFmt into dst, laid out as
+ * dstFmt. Rows are written bottom up when flip is set (see sailConfig::rowOrd).
+ * width is the width of the destination, so a CONVFMT_RGB_SBS source is
+ * 2*width pixels wide.
+ * Returns -1 if the conversion isn't supported.
+ */
+int sageConvertImage(const void *src, sageConvFmt srcFmt, void *dst, sagePixFmt dstFmt,
+                     int width, int height, bool flip = false, int flags = 0);
+
+/** size in bytes of a width x height image in format fmt */
+int sageConvertSize(sageConvFmt fmt, int width, int height);
+
+const char* sageConvFmtName(sageConvFmt fmt);
+
+/**
+ * enables or disables the SIMD kernels, which are used by default when
+ * the CPU has them. Returns true if SIMD kernels are in use afterwards
+ */
+bool sageConvertSIMD(bool on);
+
+#endif
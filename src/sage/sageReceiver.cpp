@@ -44,10 +44,16 @@
 #include "sageBlockPool.h"
 #include "sageSharedData.h"
 #include "sageEvent.h"
+#include "sageTelemetry.h"
+#include "sageTrace.h"
+#include "sageAffinity.h"
+
+static int telGroups = sageTelemetry::instance().counter("sage_rcv_groups_total", "block groups read from the network");
 
 void* sageReceiver::nwReadThread(void *args)
 {
   sageReceiver *This = (sageReceiver *)args;
+  sageAffinity::instance().bind("receiver");
 
   This->readData();
 
@@ -70,6 +76,7 @@ sagePixelReceiver::sagePixelReceiver(char *msg, rcvSharedData *sh,
   streamIdx = 0;
   configID = 0;
   curFrame = 1;
+  streamDesc = strdup(msg);
 
   connecting = true;
 
@@ -151,6 +158,10 @@ int sagePixelReceiver::readData()
   bool reuseBlockGroup = false;
   bool updated = false;
 
+  // when the first group of the current frame arrived
+  sageTrace &trace = sageTrace::instance();
+  double frameStart = 0.0;
+
   sageBlockGroup *sbg = NULL;
 
   while(!endFlag) {
@@ -180,6 +191,11 @@ int sagePixelReceiver::readData()
         streamList[i].dataReady = false;
 
         if (rcvSize > 0) {
+          sageTelemetry::instance().add(telGroups);
+          recorder.writeGroup(i, sbg);
+          if (frameStart == 0.0)
+            frameStart = trace.now();
+
           //
           // What I received is continuous data of the current frame
           //
@@ -285,6 +301,11 @@ int sagePixelReceiver::readData()
       // then this is new frame. This is how sage differentiate the next frame
       //SAGE_PRINTLOG("sagePixelReceiver::readData() : Receiving Done ! SDM %d PDL %d, curFrame(%d) will be updated to nextFrame(%d)\n", shared->nodeID, instID, curFrame,nextFrame);
 
+      if (frameStart > 0.0) {
+        trace.record(TRACE_RECEIVE, instID, curFrame, frameStart, trace.now());
+        frameStart = 0.0;
+      }
+
       curFrame = nextFrame;
       int pushNum = 0;
       if (updated) {
@@ -306,8 +327,11 @@ int sagePixelReceiver::readData()
         sageBlockGroup *bGrp = streamList[i].bGroup;
 
         if (bGrp && bGrp->getFrameID() == curFrame) {
-          if (bGrp->getFlag() == sageBlockGroup::PIXEL_DATA)
+          if (bGrp->getFlag() == sageBlockGroup::PIXEL_DATA) {
             updated = true;
+            if (frameStart == 0.0)
+              frameStart = trace.now();
+          }
           blockBuf->pushBack(bGrp); // push temporary group to real queue
           //SAGE_PRINTLOG("push back frame %d", bGrp->getFrameID());
           pushNum++;
@@ -335,7 +359,9 @@ sagePixelReceiver::~sagePixelReceiver()
   }
 
   pthread_join(thId, NULL);
+  recorder.close();
 
   delete [] streamList;
+  free(streamDesc);
   SAGE_PRINTLOG("<sagePixelReceiver shutdown>");
 }
@@ -42,6 +42,7 @@
 #define SAGERECEIVER_H_
 
 #include "sage.h"
+#include "sageStreamRecord.h"
 
 #define STREAM_ACTIVE   1
 #define STREAM_INACTIVE 2
@@ -119,6 +120,9 @@ protected:
   fd_set streamFds;
   int maxSockFd;
 
+  char *streamDesc;  /**< init message of the stream, kept for recordings */
+  sageStreamRecorder recorder;
+
   /**
    * Receiving pixel data from an application<BR>
    * Generates EVENT_READ_BLOCK
@@ -137,6 +141,14 @@ public:
    * creates EVENT_APP_CONNECTED. This leads invoking fsClient::sendMessage() with the code DISP_APP_CONNECTED
    */
   int addStream(int senderID);
+
+  /**
+   * writes every block group received from now on to path, see
+   * sageStreamRecorder. Recording starts with the next frame
+   */
+  int startRecording(const char *path) { return recorder.open(path, streamDesc); }
+  void stopRecording() { recorder.close(); }
+
   ~sagePixelReceiver();
 };
 
@@ -0,0 +1,695 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageReplay.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+
+/*
+ * Plays stream recordings (see sageStreamRecord.h) back to a wall, to load
+ * the SDM, sync and network paths the same way without the original
+ * application.
+ *
+ *   sageReplay [-sail] [-fast] [-loop] [-rate fps] recording.sgs [recording.sgs ...]
+ *
+ * The recorded block groups go out over the stream protocol (TCP) as they
+ * were recorded: pixel groups block by block with their group boundaries,
+ * and the control groups that end a frame or follow a reconfiguration at
+ * their place, all at their recorded times. The recordings of all the
+ * nodes that showed the app are played in frame order, and each block goes
+ * to the display nodes that show it in the current window layout. Frame
+ * IDs start at 1 and go on across -loop, the configuration IDs are those of
+ * the window, so the wall can move and resize it during the replay.
+ *
+ * With -sail the recordings are merged frame by frame into a frame buffer
+ * instead and sent through SAIL as a new application; the blocks a frame
+ * doesn't have keep the pixels of the frames before it.
+ *
+ * Frames are sent at their recorded times, or as fast as the wall takes
+ * them with -fast. The SAIL config is sageReplay.conf or SAGE_APP_CONFIG.
+ */
+
+#include "libsage.h"
+#include "sageStreamer.h"
+#include "sageStreamRecord.h"
+#include "sageBlockPartition.h"
+#include "sageBlockPool.h"
+
+struct replayInput {
+  sageStreamReader reader;
+  streamRecordHeader rec;
+  bool done;
+};
+
+static bool nextRecord(replayInput &in)
+{
+  in.done = (in.reader.nextRecord(in.rec) < 0);
+  return !in.done;
+}
+
+// the input with the next record to play, the lowest frame first. -1 at the end
+static int nextInput(replayInput *inputs, int inNum)
+{
+  int next = -1;
+  for (int i=0; i<inNum; i++) {
+    if (inputs[i].done)
+      continue;
+    if (next < 0 || inputs[i].rec.frameID < inputs[next].rec.frameID ||
+        (inputs[i].rec.frameID == inputs[next].rec.frameID && inputs[i].rec.time < inputs[next].rec.time))
+      next = i;
+  }
+
+  return next;
+}
+
+// average frame rate of a recording, from its index
+static double recordedRate(const char *path)
+{
+  char indexPath[SAGE_NAME_LEN+8];
+  snprintf(indexPath, SAGE_NAME_LEN+8, "%s.idx", path);
+
+  FILE *fp = fopen(indexPath, "rb");
+  if (!fp)
+    return 0.0;
+
+  streamIndexEntry first, entry;
+  int num = 0;
+  while (fread(&entry, sizeof(entry), 1, fp) == 1) {
+    if (num == 0)
+      first = entry;
+    num++;
+  }
+  fclose(fp);
+
+  if (num < 2 || entry.time <= first.time)
+    return 0.0;
+
+  return (num-1) * 1000000.0 / (entry.time - first.time);
+}
+
+/**
+ * streams the recorded block groups in place of a sageBlockStreamer. The
+ * stream is registered at the receivers with the recorded description,
+ * SAIL hands over the window configurations and the receiver connections
+ */
+class recordStreamer : public sageStreamer {
+protected:
+  replayInput *inputs;
+  int inNum;
+  bool fast, loop;
+  bool started;
+  sageBlockGroup *nbg;
+
+  int frames, configs, blocks, skipped;
+  long long bytes;
+
+  int applyConfigs();
+  int flushAll();
+  int sendControl();
+  int sendBlocks(replayInput &in);
+  virtual int streamLoop();
+  void setupBlockPool() { if (nbg) nwObj->setupBlockPool(nbg); }
+
+public:
+  recordStreamer(replayInput *in, int num, const char *desc, bool f, bool l);
+
+  int initNetworks(char *data, bool localPort = false);
+  void setNwConfig(sageNwConfig &nc);
+  void shutdown();
+  ~recordStreamer();
+};
+
+recordStreamer::recordStreamer(replayInput *in, int num, const char *desc, bool f, bool l) :
+  inputs(in), inNum(num), fast(f), loop(l), started(false), nbg(NULL),
+  frames(0), configs(0), blocks(0), skipped(0), bytes(0)
+{
+  nwObj = NULL;
+  partition = NULL;
+
+  // the receiver init message the recording starts with
+  int async = 1;
+  char *msgPt = sage::tokenSeek((char *)desc, 1);
+  if (msgPt)
+    sscanf(msgPt, "%d %d %*d %d %d %*d %d %d %d %d %d %d", &config.streamType, &config.frameRate,
+           &config.groupSize, &config.blockSize, (int *)&config.pixFmt, &config.blockX, &config.blockY,
+           &config.totalWidth, &config.totalHeight, &async);
+
+  config.asyncUpdate = (async != 0);
+  config.nodeNum = 1;
+  config.protocol = SAGE_TCP;
+  blockSize = config.blockSize;
+  interval = 1000000.0/MAX(config.frameRate, 1);
+}
+
+int recordStreamer::initNetworks(char *data, bool localPort)
+{
+  if (sageStreamer::initNetworks(data, localPort) < 0)
+    return -1;
+
+  started = true;
+  return 0;
+}
+
+void recordStreamer::setNwConfig(sageNwConfig &nc)
+{
+  nwCfg = nc;
+
+  partition = new sageBlockPartition(config.blockX, config.blockY, config.totalWidth, config.totalHeight);
+  partition->initBlockTable();
+
+  nwCfg.blockSize = blockSize;
+  nwCfg.groupSize = config.groupSize;
+
+  // room for two groups, one is sent while the next one is read
+  nbg = new sageBlockGroup(blockSize, 2*MAX(config.groupSize, blockSize), GRP_MEM_ALLOC | GRP_CIRCULAR);
+}
+
+// takes the window configurations queued by SAIL, waits for the first one
+int recordStreamer::applyConfigs()
+{
+  // the mutex is held from the constructor until the first configuration comes
+  if (firstConfiguration) {
+    while (streamerOn && pthread_mutex_trylock(reconfigMutex) != 0)
+      sage::usleep(10000);
+    if (!streamerOn)
+      return -1;
+  }
+  else
+    pthread_mutex_lock(reconfigMutex);
+
+  while (msgQueue.size() > 0) {
+    char *msgStr = msgQueue.front();
+    reconfigureStreams(msgStr);
+    msgQueue.pop_front();
+    delete [] msgStr;
+    firstConfiguration = false;
+  }
+  pthread_mutex_unlock(reconfigMutex);
+
+  return 0;
+}
+
+int recordStreamer::flushAll()
+{
+  for (int j=0; j<rcvNodeNum; j++) {
+    int dataSize = nwObj->flush(params[j].rcvID, configID);
+    if (dataSize < 0) {
+      SAGE_PRINTLOG("recordStreamer::flushAll : fail to send pixel block");
+      return -1;
+    }
+    totalBandWidth += dataSize;
+  }
+
+  return 0;
+}
+
+// a control group ends the frame at every receiver
+int recordStreamer::sendControl()
+{
+  for (int j=0; j<rcvNodeNum; j++) {
+    int dataSize = nwObj->sendControl(params[j].rcvID, frameID, configID);
+    if (dataSize < 0) {
+      SAGE_PRINTLOG("recordStreamer::sendControl : fail to send control block");
+      return -1;
+    }
+    totalBandWidth += dataSize;
+  }
+
+  return 0;
+}
+
+// sends the blocks of a pixel record to the receivers showing them, as one group
+int recordStreamer::sendBlocks(replayInput &in)
+{
+  for (int b=0; b<in.rec.blockNum; b++) {
+    if (nbg->isEmpty() && flushAll() < 0)
+      return -1;
+
+    // the block stays in the pool until it is sent
+    sagePixelBlock *block = nbg->front();
+    if (!block) {
+      SAGE_PRINTLOG("recordStreamer::sendBlocks : pixel block is NULL");
+      return -1;
+    }
+
+    int len = in.reader.nextBlock(block->getBuffer(), blockSize);
+    if (len < BLOCK_HEADER_SIZE)
+      break;
+
+    // blocks of another size than the registered one would break the group
+    int recSize = 0;
+    if (sscanf(block->getBuffer(), "%d", &recSize) != 1 || recSize != blockSize) {
+      skipped++;
+      continue;
+    }
+    block->updateBlockConfig();
+
+    pixelBlockMap *map = partition->getBlockMap(block->getID());
+    if (!map)
+      continue;
+    nbg->next();
+
+    block->setRefCnt(map->count);
+    block->setFrameID(frameID);
+    block->updateBufferHeader();
+
+    while (map) {
+      params[map->infoID].active = true;
+      int dataSize = nwObj->sendGrp(params[map->infoID].rcvID, block, configID);
+      if (dataSize < 0) {
+        SAGE_PRINTLOG("recordStreamer::sendBlocks : fail to send pixel block");
+        return -1;
+      }
+      totalBandWidth += dataSize;
+      map = map->next;
+    }
+
+    blocks++;
+    bytes += len;
+  }
+
+  // keep the group boundaries of the recording
+  return flushAll();
+}
+
+int recordStreamer::streamLoop()
+{
+  if (applyConfigs() < 0) {
+    streamerOn = false;
+    return 0;
+  }
+
+  int firstFrame = SAGE_INT_MAX, frameBase = 1;
+  for (int i=0; i<inNum; i++)
+    if (!inputs[i].done)
+      firstFrame = MIN(firstFrame, inputs[i].rec.frameID);
+
+  int controlFrame = 0;
+  double firstTime = -1.0, startTime = 0.0;
+  double statTime = sage::getTime();
+  int statFrames = 0;
+
+  while (streamerOn) {
+    int next = nextInput(inputs, inNum);
+
+    if (next < 0) {
+      if (!loop)
+        break;
+
+      // go on with the frame after the last one
+      for (int i=0; i<inNum; i++) {
+        inputs[i].reader.rewind();
+        nextRecord(inputs[i]);
+      }
+      firstFrame = SAGE_INT_MAX;
+      for (int i=0; i<inNum; i++)
+        if (!inputs[i].done)
+          firstFrame = MIN(firstFrame, inputs[i].rec.frameID);
+      if (firstFrame == SAGE_INT_MAX)
+        break;
+      frameBase = frameID + 1;
+      firstTime = -1.0;
+      continue;
+    }
+
+    replayInput &in = inputs[next];
+
+    // the window may have moved, between frames
+    int frame = in.rec.frameID - firstFrame + frameBase;
+    if (frame != frameID) {
+      frameID = frame;
+      if (applyConfigs() < 0)
+        break;
+    }
+
+    // wait for the record's time since the first one
+    if (firstTime < 0.0) {
+      firstTime = in.rec.time;
+      startTime = sage::getTime();
+    }
+    else if (!fast) {
+      double wait = (in.rec.time - firstTime) - (sage::getTime() - startTime);
+      if (wait > 0.0)
+        sage::usleep((unsigned long)wait);
+    }
+
+    if (in.rec.flag == sageBlockGroup::PIXEL_DATA) {
+      if (sendBlocks(in) < 0)
+        break;
+    }
+    // each recording has the frame's control group, the receivers need one
+    else if (frameID != controlFrame) {
+      if (sendControl() < 0)
+        break;
+      controlFrame = frameID;
+      configs++;
+      frames++;
+      statFrames++;
+      frameCounter++;
+    }
+
+    nextRecord(in);
+
+    double now = sage::getTime();
+    if (now - statTime > 5000000.0) {
+      SAGE_PRINTLOG("sageReplay> %.1f fps, %d frames, %d blocks, %.1f MB, %d control groups",
+                    statFrames*1000000.0/(now - statTime), frames, blocks, bytes/1048576.0, configs);
+      statTime = now;
+      statFrames = 0;
+    }
+  }
+
+  if (skipped > 0)
+    SAGE_PRINTLOG("sageReplay> %d blocks of another size than %d bytes were left out", skipped, blockSize);
+  SAGE_PRINTLOG("sageReplay> done: %d frames, %d blocks, %.1f MB, %d control groups",
+                frames, blocks, bytes/1048576.0, configs);
+
+  streamerOn = false;
+
+  return 0;
+}
+
+void recordStreamer::shutdown()
+{
+  streamerOn = false;
+
+  // no thread before SAIL connected the receivers
+  if (started) {
+    pthread_join(thId, NULL);
+    started = false;
+  }
+}
+
+recordStreamer::~recordStreamer()
+{
+  if (nwObj)
+    delete nwObj;
+
+  if (nbg)
+    delete nbg;
+
+  if (partition)
+    delete partition;
+}
+
+static int replayStreams(replayInput *inputs, int inNum, bool fast, bool loop, double rate)
+{
+  const char *desc = inputs[0].reader.getDesc();
+  recordStreamer *streamer = new recordStreamer(inputs, inNum, desc, fast, loop);
+
+  sagePixFmt pixFmt;
+  int blockX, blockY, imgWidth, imgHeight;
+  inputs[0].reader.getStreamInfo(pixFmt, blockX, blockY, imgWidth, imgHeight);
+
+  int frameRate = (rate > 0.0) ? (int)ceil(rate) : 60;
+  char *msgPt = sage::tokenSeek((char *)desc, 2);
+  if (rate <= 0.0 && msgPt)
+    sscanf(msgPt, "%d", &frameRate);
+
+  // the sail object owns the streamer from here on
+  sail *sageInf = createSAIL("sageReplay", imgWidth, imgHeight, pixFmt, NULL, BOTTOM_TO_TOP,
+                             frameRate, NULL, streamer);
+
+  while (streamer->isStreamerOn()) {
+    processMessages(sageInf, NULL, NULL, NULL);
+    sage::usleep(10000);
+  }
+
+  deleteSAIL(sageInf);
+
+  return 0;
+}
+
+static int replayFrames(replayInput *inputs, int inNum, const char *path, bool fast, bool loop, double rate)
+{
+  sagePixFmt pixFmt;
+  int blockX, blockY, imgWidth, imgHeight;
+  inputs[0].reader.getStreamInfo(pixFmt, blockX, blockY, imgWidth, imgHeight);
+
+  // the sender paces itself at the configured rate, keep it above the recording
+  if (rate <= 0.0) {
+    rate = fast ? 1000.0 : recordedRate(path);
+    if (rate <= 0.0)
+      rate = 60.0;
+    else if (!fast)
+      rate *= 1.25;
+  }
+
+  // blocks are placed the way sageBlockFrame::extractPixelBlock cut them
+  float comp = 1.0;
+  if (pixFmt == PIXFMT_DXT || pixFmt == PIXFMT_DXT5 || pixFmt == PIXFMT_DXT5YCOCG)
+    comp = 4.0;
+  int pixelSize = (int)ceil(getPixelSize(pixFmt)/comp);
+  int memWidth = imgWidth*pixelSize;
+  int frameSize = memWidth*(int)ceil(imgHeight/comp);
+
+  unsigned char *frame = (unsigned char *)malloc(frameSize);
+  memset(frame, 0, frameSize);
+  sageBlockPartition partition(blockX, blockY, imgWidth, imgHeight);
+
+  int blockBufSize = BLOCK_HEADER_SIZE + blockX*blockY*getPixelSize(pixFmt);
+  char *block = (char *)malloc(blockBufSize);
+  std::vector<char> leftEye, rightEye;   // a stereo block decoded from a residual
+
+  sail *sageInf = createSAIL("sageReplay", imgWidth, imgHeight, pixFmt, NULL, BOTTOM_TO_TOP, (int)ceil(rate));
+
+  int frames = 0, configs = 0, blocks = 0;
+  long long bytes = 0;
+  double firstTime = -1.0, startTime = sage::getTime();
+  double statTime = startTime;
+  int statFrames = 0;
+
+  while (1) {
+    // the next frame is the lowest one any recording is at
+    int frameID = SAGE_INT_MAX;
+    for (int i=0; i<inNum; i++)
+      if (!inputs[i].done)
+        frameID = MIN(frameID, inputs[i].rec.frameID);
+
+    if (frameID == SAGE_INT_MAX) {
+      if (!loop)
+        break;
+
+      for (int i=0; i<inNum; i++) {
+        inputs[i].reader.rewind();
+        nextRecord(inputs[i]);
+      }
+      firstTime = -1.0;
+      continue;
+    }
+
+    double frameTime = -1.0;
+    bool pixels = false;
+
+    for (int i=0; i<inNum; i++) {
+      replayInput &in = inputs[i];
+
+      while (!in.done && in.rec.frameID == frameID) {
+        if (frameTime < 0.0 || in.rec.time < frameTime)
+          frameTime = in.rec.time;
+
+        if (in.rec.flag != sageBlockGroup::PIXEL_DATA)
+          configs++;
+
+        for (int b=0; b<in.rec.blockNum; b++) {
+          int len = in.reader.nextBlock(block, blockBufSize);
+          if (len < BLOCK_HEADER_SIZE)
+            break;
+
+          int bufSize, flag, x, y, w, h, frameNum, blockID;
+          double pts;
+          int plane = SAGE_PLANE_ALL, payload = 0;
+          if (sscanf(block, "%d %d %d %d %d %d %d %d %lf %d %d", &bufSize, &flag, &x, &y, &w, &h,
+                     &frameNum, &blockID, &pts, &plane, &payload) < 8)
+            continue;
+
+          sagePixelBlock stdBlock;
+          partition.getBlock(blockID, stdBlock);
+          x += stdBlock.x;
+          y += stdBlock.y;
+
+          // the eyes of a stereo block sent apart have half the pixel size
+          bool eye = (plane != SAGE_PLANE_ALL && pixFmt == PIXFMT_RGBS3D);
+          int rows = (int)ceil(h/comp);
+          int rowBytes = eye ? w*pixelSize/2 : w*pixelSize;
+          int yPos = (int)ceil(y/comp);
+          bool residual = (eye && plane == SAGE_PLANE_RESIDUAL);
+          if (x < 0 || x+w > imgWidth || yPos < 0 || (yPos+rows)*memWidth > frameSize ||
+              BLOCK_HEADER_SIZE + (residual ? payload : rows*rowBytes) > len)
+            continue;
+
+          char *src = block + BLOCK_HEADER_SIZE;
+          unsigned char *dst = frame + yPos*memWidth + x*pixelSize;
+
+          // a right eye sent as a residual is rebuilt from the left eye in the frame
+          if (residual) {
+            leftEye.resize(rows*rowBytes);
+            rightEye.resize(rows*rowBytes);
+            for (int r=0; r<rows; r++) {
+              for (int p=0; p<w; p++)
+                memcpy(&leftEye[r*rowBytes + p*3], dst + r*memWidth + p*6, 3);
+            }
+            if (!sageDecodeEyeResidual(src, payload, &leftEye[0], rowBytes, &rightEye[0], rowBytes, w, rows))
+              continue;
+            src = &rightEye[0];
+            plane = SAGE_PLANE_RIGHT;
+          }
+          for (int r=0; r<rows; r++) {
+            if (!eye)
+              memcpy(dst, src, rowBytes);
+            else {
+              for (int p=0; p<w; p++) {
+                if (plane != SAGE_PLANE_RIGHT)
+                  memcpy(dst + p*6, src + p*3, 3);
+                if (plane != SAGE_PLANE_LEFT)
+                  memcpy(dst + p*6 + 3, src + p*3, 3);
+              }
+            }
+            src += rowBytes;
+            dst += memWidth;
+          }
+
+          blocks++;
+          bytes += len;
+          pixels = true;
+        }
+
+        nextRecord(in);
+      }
+    }
+
+    if (!pixels)
+      continue;
+
+    // wait for the frame's time since the first one
+    if (firstTime < 0.0) {
+      firstTime = frameTime;
+      startTime = sage::getTime();
+    }
+    else if (!fast) {
+      double wait = (frameTime - firstTime) - (sage::getTime() - startTime);
+      if (wait > 0.0)
+        sage::usleep((unsigned long)wait);
+    }
+
+    swapWithBuffer(sageInf, frame);
+    processMessages(sageInf, NULL, NULL, NULL);
+
+    frames++;
+    statFrames++;
+
+    double now = sage::getTime();
+    if (now - statTime > 5000000.0) {
+      SAGE_PRINTLOG("sageReplay> %.1f fps, %d frames, %d blocks, %.1f MB, %d config updates",
+                    statFrames*1000000.0/(now - statTime), frames, blocks, bytes/1048576.0, configs);
+      statTime = now;
+      statFrames = 0;
+    }
+  }
+
+  SAGE_PRINTLOG("sageReplay> done: %d frames, %d blocks, %.1f MB, %d config updates",
+                frames, blocks, bytes/1048576.0, configs);
+
+  deleteSAIL(sageInf);
+  free(frame);
+  free(block);
+
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  bool sailMode = false, fast = false, loop = false;
+  double rate = 0.0;
+  std::vector<char*> paths;
+
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i], "-sail") == 0)
+      sailMode = true;
+    else if (strcmp(argv[i], "-fast") == 0)
+      fast = true;
+    else if (strcmp(argv[i], "-loop") == 0)
+      loop = true;
+    else if (strcmp(argv[i], "-rate") == 0 && i+1 < argc)
+      rate = atof(argv[++i]);
+    else
+      paths.push_back(argv[i]);
+  }
+
+  if (paths.empty()) {
+    fprintf(stderr, "usage: %s [-sail] [-fast] [-loop] [-rate fps] recording.sgs [recording.sgs ...]\n", argv[0]);
+    return -1;
+  }
+
+  int inNum = paths.size();
+  replayInput *inputs = new replayInput[inNum];
+  sagePixFmt pixFmt;
+  int blockX, blockY, imgWidth, imgHeight;
+
+  for (int i=0; i<inNum; i++) {
+    if (inputs[i].reader.open(paths[i]) < 0)
+      return -1;
+
+    sagePixFmt fmt;
+    int bx, by, w, h;
+    if (inputs[i].reader.getStreamInfo(fmt, bx, by, w, h) < 0) {
+      fprintf(stderr, "%s: no stream description\n", paths[i]);
+      return -1;
+    }
+
+    if (i == 0) {
+      pixFmt = fmt;
+      blockX = bx;
+      blockY = by;
+      imgWidth = w;
+      imgHeight = h;
+    }
+    else if (fmt != pixFmt || bx != blockX || by != blockY || w != imgWidth || h != imgHeight) {
+      fprintf(stderr, "%s: recorded from another stream than %s\n", paths[i], paths[0]);
+      return -1;
+    }
+
+    nextRecord(inputs[i]);
+  }
+
+  int ret;
+  if (sailMode)
+    ret = replayFrames(inputs, inNum, paths[0], fast, loop, rate);
+  else
+    ret = replayStreams(inputs, inNum, fast, loop, rate);
+
+  delete [] inputs;
+
+  return ret;
+}
@@ -0,0 +1,211 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageResourcePool.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageResourcePool.h"
+#include "sageDisplay.h"
+#include "sageBlockPool.h"
+#include "sageSharedData.h"
+#include "sageAffinity.h"
+
+sageResourcePool::sageResourcePool(dispSharedData *sh, int size) : shared(sh), maxIdle(size),
+                                                                   monHits(0), monMisses(0), bufHits(0), bufMisses(0)
+{
+  if (maxIdle < 0)
+    maxIdle = 0;
+}
+
+int sageResourcePool::idleMontages(int tileIdx, sagePixFmt pfmt)
+{
+  int num = 0;
+  for (int i=0; i<montages.size(); i++) {
+    if (montages[i]->tileIdx == tileIdx && montages[i]->sageTex->getPixelType() == pfmt)
+      num++;
+  }
+
+  return num;
+}
+
+void sageResourcePool::prewarm(sagePixFmt pfmt, int num)
+{
+  if (num > maxIdle)
+    num = maxIdle;
+
+  int tileNum = shared->displayObj->getTileNum();
+  for (int i=0; i<tileNum; i++) {
+    sageRect &tileRect = shared->displayObj->getTileRect(i);
+
+    for (int j=idleMontages(i, pfmt); j<num; j++) {
+      sageMontage *mon = new sageMontage(shared->context, pfmt);
+      if (!mon->sageTex) {
+        SAGE_PRINTLOG("sageResourcePool::prewarm : unsupported pixel format %d", pfmt);
+        delete mon;
+        return;
+      }
+
+      mon->tileIdx = i;
+      mon->reserveTexture(tileRect.width, tileRect.height);
+      montages.push_back(mon);
+    }
+  }
+
+  SAGE_PRINTLOG("[%d] sageResourcePool : %d montages of format %d ready on each of %d tiles",
+                shared->nodeID, num, pfmt, tileNum);
+}
+
+sageMontage* sageResourcePool::getMontage(int tileIdx, sagePixFmt pfmt, int width, int height)
+{
+  int best = -1, largest = -1;
+  long bestArea = 0, largestArea = 0;
+
+  for (int i=0; i<montages.size(); i++) {
+    sageTexture *tex = montages[i]->sageTex;
+    if (montages[i]->tileIdx != tileIdx || tex->getPixelType() != pfmt)
+      continue;
+
+    long area = (long)tex->getWidth() * tex->getHeight();
+    if (tex->getWidth() >= width && tex->getHeight() >= height) {
+      if (best < 0 || area < bestArea)
+        best = i, bestArea = area;
+    }
+
+    if (largest < 0 || area > largestArea)
+      largest = i, largestArea = area;
+  }
+
+  // a montage too small still saves the object, renewTexture() grows it
+  if (best < 0)
+    best = largest;
+
+  sageMontage *mon = NULL;
+  if (best >= 0) {
+    mon = montages[best];
+    montages.erase(montages.begin() + best);
+    mon->reset();
+    monHits++;
+  }
+  else {
+    mon = new sageMontage(shared->context, pfmt);
+    mon->tileIdx = tileIdx;
+    monMisses++;
+  }
+
+  return mon;
+}
+
+void sageResourcePool::putMontage(sageMontage *mon)
+{
+  if (!mon)
+    return;
+
+  if (!mon->sageTex || mon->sageTex->getWidth() == 0 ||
+      idleMontages(mon->tileIdx, mon->sageTex->getPixelType()) >= maxIdle) {
+    mon->deleteTexture();
+    delete mon;
+    return;
+  }
+
+  montages.push_back(mon);
+}
+
+sageBlockBuf* sageResourcePool::getBlockBuf(int bufSize, int grpSize, int blkSize)
+{
+  int best = -1;
+  for (int i=0; i<blockBufs.size(); i++) {
+    sageBlockBuf *buf = blockBufs[i];
+    if (buf->getGroupSize() != grpSize || buf->getBlockSize() != blkSize)
+      continue;
+
+    if (buf->getBufSize() < bufSize || buf->getBufSize() > bufSize*2)
+      continue;
+
+    if (best < 0 || buf->getBufSize() < blockBufs[best]->getBufSize())
+      best = i;
+  }
+
+  if (best >= 0) {
+    sageBlockBuf *buf = blockBufs[best];
+    blockBufs.erase(blockBufs.begin() + best);
+    bufHits++;
+    return buf;
+  }
+
+  bufMisses++;
+
+  // the receiving thread fills the blocks
+  affinityPlacement placement("receiver");
+  return new sageBlockBuf(bufSize, grpSize, blkSize, BUF_MEM_ALLOC | BUF_CTRL_GROUP);
+}
+
+void sageResourcePool::putBlockBuf(sageBlockBuf *buf)
+{
+  if (!buf)
+    return;
+
+  if (!buf->recycle() || maxIdle == 0) {
+    delete buf;
+    return;
+  }
+
+  // the oldest buffer makes room for the new one
+  if (blockBufs.size() >= maxIdle) {
+    delete blockBufs.front();
+    blockBufs.erase(blockBufs.begin());
+  }
+
+  blockBufs.push_back(buf);
+}
+
+void sageResourcePool::getPoolInfo(char *info)
+{
+  sprintf(info, "montages : %d idle, %d reused, %d created , block buffers : %d idle, %d reused, %d created",
+          (int)montages.size(), monHits, monMisses, (int)blockBufs.size(), bufHits, bufMisses);
+}
+
+sageResourcePool::~sageResourcePool()
+{
+  for (int i=0; i<montages.size(); i++) {
+    montages[i]->deleteTexture();
+    delete montages[i];
+  }
+  montages.clear();
+
+  for (int i=0; i<blockBufs.size(); i++)
+    delete blockBufs[i];
+  blockBufs.clear();
+}
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageResourcePool.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_RESOURCE_POOL_H
+#define SAGE_RESOURCE_POOL_H
+
+#include "sageBase.h"
+
+class dispSharedData;
+class sageMontage;
+class sageBlockBuf;
+
+// idle montages (per tile and pixel format) and block buffers kept by default
+#define RES_POOL_DEFAULT_SIZE 4
+
+/**
+ * Montages (with their texture and PBOs) and block buffers left by
+ * applications that quit, kept for the next applications. Opening a window
+ * then doesn't have to allocate GPU memory or a frame of block groups, which
+ * is most of the time spent between an app registering and its first frame.
+ * Montages can be created ahead of time with prewarm(). The pool belongs to
+ * the display thread and isn't locked.
+ */
+class sageResourcePool {
+private:
+  dispSharedData *shared;
+  int maxIdle;
+
+  std::vector<sageMontage *> montages;
+  std::vector<sageBlockBuf *> blockBufs;
+
+  int monHits, monMisses;
+  int bufHits, bufMisses;
+
+  int idleMontages(int tileIdx, sagePixFmt pfmt);
+
+public:
+  sageResourcePool(dispSharedData *sh, int size = RES_POOL_DEFAULT_SIZE);
+
+  /**
+   * creates num montages of format pfmt for every tile, with textures as big
+   * as the tile
+   */
+  void prewarm(sagePixFmt pfmt, int num);
+
+  /**
+   * the montage whose texture fits a width x height block layout with the
+   * least waste, or a new one. The montage is reset to its initial state
+   */
+  sageMontage* getMontage(int tileIdx, sagePixFmt pfmt, int width, int height);
+  void putMontage(sageMontage *mon);
+
+  /**
+   * a block buffer for bufSize bytes (up to twice as big) or a new one
+   */
+  sageBlockBuf* getBlockBuf(int bufSize, int grpSize, int blkSize);
+  void putBlockBuf(sageBlockBuf *buf);
+
+  void getPoolInfo(char *info);
+
+  ~sageResourcePool();
+};
+
+#endif
@@ -0,0 +1,331 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageS3DPlaneTest.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+/*
+ * Streams PIXFMT_RGBS3D frames in eye planes (see
+ * sageBlockStreamer::streamS3DPlanes) to a fake network module that keeps
+ * the eyes of each block the way the receiving texture does, and checks
+ * them against the frames. Half of the blocks are off the screen, and
+ * most frames are static so nearly all eyes are left out. Each sent block
+ * goes back to the send pool like the TCP module returns it, so a block
+ * that is neither sent nor returned drains the pool and stalls the test.
+ * The right eyes are the left ones shifted, and come as residuals. A group
+ * with short blocks also goes through a socket pair.
+ *
+ *   sageS3DPlaneTest [frames]
+ */
+
+#include "sageStreamer.h"
+#include "sageFrame.h"
+#include "sageBlockPartition.h"
+#include "sageBlockPool.h"
+#include <sys/socket.h>
+
+#define TEST_WIDTH  256
+#define TEST_HEIGHT 128
+#define TEST_BLOCK  32
+
+// the eyes of the visible blocks, by block ID, as a receiver has them
+class eyeWall : public streamProtocol {
+public:
+  sageBlockPool *pool;
+  std::vector<char> eyes[2];
+  int blocks, residuals, damaged;
+  long long sent;
+
+  eyeWall() : pool(NULL), blocks(0), residuals(0), damaged(0), sent(0)
+  {
+    eyes[0].assign(TEST_WIDTH*TEST_HEIGHT*3, 0);
+    eyes[1].assign(TEST_WIDTH*TEST_HEIGHT*3, 0);
+  }
+
+  char *blockEye(int eye, int id) { return &eyes[eye][id*TEST_BLOCK*TEST_BLOCK*3]; }
+
+  void setupBlockPool(sageBlockPool *p, int id = -1) { pool = p; }
+  void setFrameSize(int id, int size) {}
+  void resetFrameSize(int id) {}
+  void setFrameRate(double rate, int id = -1) {}
+  int checkConnections(char *msg = NULL, sageApiOption op = 0) { return -1; }
+  int connect(char *ip, char *msg = NULL) { return -1; }
+  int send(int id, sageBlock *sb, sageApiOption op) { return -1; }
+  int sendpixelonly(int id, sageBlockFrame *sb) { return -1; }
+  int recv(int id, sageBlock *sb, sageApiOption op) { return -1; }
+  int sendControl(int id, int frameID, int configID) { return BLOCK_HEADER_SIZE; }
+  int recvGrp(int id, sageBlockGroup *sbg) { return -1; }
+  int flush(int id, int configID) { return 0; }
+  int getRcvSockFd(int id) { return -1; }
+  int close() { return 0; }
+
+  int sendGrp(int id, sagePixelBlock *sb, int configID)
+  {
+    // read the block back from its header, like the receiver
+    int bytes = sb->getPayloadSize() > 0 ? sb->getPayloadSize() : sb->width*sb->height*3;
+    sagePixelBlock block(BLOCK_HEADER_SIZE + TEST_BLOCK*TEST_BLOCK*3);
+    memcpy(block.getBuffer(), sb->getBuffer(), BLOCK_HEADER_SIZE + bytes);
+    block.updateBlockConfig();
+
+    int w = block.width, h = block.height;
+    int plane = block.getPlane();
+    char *pixels = block.getPixelBuffer();
+    if (plane == SAGE_PLANE_LEFT || plane == SAGE_PLANE_BOTH)
+      memcpy(blockEye(0, block.getID()), pixels, w*h*3);
+    if (plane == SAGE_PLANE_RIGHT || plane == SAGE_PLANE_BOTH)
+      memcpy(blockEye(1, block.getID()), pixels, w*h*3);
+    if (plane == SAGE_PLANE_RESIDUAL) {
+      if (!sageDecodeEyeResidual(pixels, block.getPayloadSize(), blockEye(0, block.getID()), w*3,
+                                 blockEye(1, block.getID()), w*3, w, h))
+        damaged++;
+      residuals++;
+    }
+    blocks++;
+    sent += BLOCK_HEADER_SIZE + bytes;
+
+    if (sb->dereference() == 0)
+      pool->pushBack(sb);
+
+    return BLOCK_HEADER_SIZE + bytes;
+  }
+};
+
+class planeStreamer : public sageBlockStreamer {
+public:
+  planeStreamer(streamerConfig &conf, eyeWall *wall) : sageBlockStreamer(conf, 6)
+  {
+    nwObj = wall;
+    setNwConfig(nwCfg);
+    setupBlockPool();
+
+    rcvNodeNum = 1;
+    params = new streamParam[1];
+    params[0].rcvID = 0;
+    params[0].nodeID = 0;
+    params[0].active = false;
+
+    // the left half of the frame is on the screen
+    sageRect window(0, 0, TEST_WIDTH/2, TEST_HEIGHT);
+    partition->setStreamInfo(0, window);
+    streamNum = 1;
+  }
+
+  bool planes() { return s3dPlanes; }
+  int poolBlocks() { return doubleBuf->bufSize()/blockSize; }
+  sageBlockFrame *frame() { return (sageBlockFrame *)doubleBuf->getBuffer(0); }
+  int stream() { return streamPixelData(frame()); }
+};
+
+// left eye noise, the right eye is the left one shifted by disparity with
+// a few pixels off
+static void drawFrame(char *pixels, int seed, int disparity)
+{
+  srand(seed);
+  for (int y=0; y<TEST_HEIGHT; y++) {
+    for (int x=0; x<TEST_WIDTH; x++) {
+      char *p = pixels + (y*TEST_WIDTH + x)*6;
+      p[0] = rand() & 0xff;
+      p[1] = rand() & 0xff;
+      p[2] = rand() & 0xff;
+    }
+    for (int x=0; x<TEST_WIDTH; x++) {
+      int sx = MIN(TEST_WIDTH-1, MAX(0, x + disparity));
+      char *p = pixels + (y*TEST_WIDTH + x)*6;
+      char *s = pixels + (y*TEST_WIDTH + sx)*6;
+      p[3] = s[0];
+      p[4] = s[1];
+      p[5] = s[2];
+      if (rand() % 50 == 0)
+        p[4] ^= 1;
+    }
+  }
+}
+
+// number of visible blocks whose eyes differ from the frame
+static int checkWall(eyeWall &wall, char *pixels)
+{
+  int bad = 0;
+  int cols = TEST_WIDTH/TEST_BLOCK;
+
+  for (int id=0; id<TEST_WIDTH*TEST_HEIGHT/(TEST_BLOCK*TEST_BLOCK); id++) {
+    int bx = id%cols*TEST_BLOCK, by = id/cols*TEST_BLOCK;
+    if (bx >= TEST_WIDTH/2)
+      continue;
+
+    bool same = true;
+    for (int eye=0; eye<2; eye++) {
+      char *got = wall.blockEye(eye, id);
+      for (int y=0; y<TEST_BLOCK; y++) {
+        for (int x=0; x<TEST_BLOCK; x++) {
+          char *p = pixels + ((by+y)*TEST_WIDTH + bx+x)*6 + eye*3;
+          if (memcmp(got, p, 3) != 0)
+            same = false;
+          got += 3;
+        }
+      }
+    }
+
+    if (!same)
+      bad++;
+  }
+
+  return bad;
+}
+
+// sends a group of short and whole blocks over a socket pair the way the
+// TCP module does, and returns the number of blocks that came out different
+static int checkPackedGroup()
+{
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0)
+    return -1;
+
+  int blockSize = BLOCK_HEADER_SIZE + TEST_BLOCK*TEST_BLOCK*3;
+  sageBlockGroup sender(blockSize, 4*blockSize, GRP_USE_IOV);
+  sageBlockGroup receiver(blockSize, 4*blockSize, GRP_MEM_ALLOC | GRP_USE_IOV);
+
+  int payload[3] = { 100, 0, 7 };
+  sagePixelBlock *blocks[3];
+  for (int i=0; i<3; i++) {
+    blocks[i] = new sagePixelBlock(blockSize);
+    blocks[i]->x = blocks[i]->y = 0;
+    blocks[i]->width = blocks[i]->height = TEST_BLOCK;
+    blocks[i]->setID(i);
+    blocks[i]->setPlane(payload[i] ? SAGE_PLANE_RESIDUAL : SAGE_PLANE_LEFT);
+    blocks[i]->setPayloadSize(payload[i]);
+    for (int j=0; j<blockSize-BLOCK_HEADER_SIZE; j++)
+      blocks[i]->getPixelBuffer()[j] = (char)(i*31 + j);
+    blocks[i]->updateBufferHeader();
+    sender.pushBack(blocks[i]);
+  }
+
+  sender.genIOV();
+  sender.setFrameID(5);
+  sender.setConfigID(1);
+  int sent = sender.sendData(fds[0]);
+  int read = receiver.readData(fds[1]);
+  receiver.updateConfig();
+
+  int bad = 0;
+  if (sent != read || sent != GROUP_HEADER_SIZE + 3*BLOCK_HEADER_SIZE + 107 + blockSize-BLOCK_HEADER_SIZE)
+    bad++;
+  for (int i=0; i<3 && !bad; i++) {
+    sagePixelBlock *got = receiver[i];
+    int len = payload[i] ? payload[i] : blockSize-BLOCK_HEADER_SIZE;
+    if (got->getID() != i || got->getPayloadSize() != payload[i] || got->getFrameID() != blocks[i]->getFrameID() ||
+        memcmp(got->getPixelBuffer(), blocks[i]->getPixelBuffer(), len) != 0)
+      bad++;
+  }
+
+  for (int i=0; i<3; i++)
+    delete blocks[i];
+  ::close(fds[0]);
+  ::close(fds[1]);
+
+  return bad;
+}
+
+int main(int argc, char **argv)
+{
+  int frames = (argc > 1) ? atoi(argv[1]) : 0;
+
+  streamerConfig conf;
+  conf.pixFmt = PIXFMT_RGBS3D;
+  conf.protocol = SAGE_TCP;
+  conf.resX = conf.totalWidth = TEST_WIDTH;
+  conf.resY = conf.totalHeight = TEST_HEIGHT;
+  conf.imageMap = sageRect(0, 0, TEST_WIDTH, TEST_HEIGHT);
+  conf.blockX = conf.blockY = TEST_BLOCK;
+  conf.rowOrd = BOTTOM_TO_TOP;
+  conf.s3dPlanes = true;
+  conf.swexp = false;
+  conf.asyncUpdate = false;
+
+  eyeWall *wall = new eyeWall;
+  planeStreamer streamer(conf, wall);
+  if (!streamer.planes()) {
+    printf("FAIL the stream isn't sent in planes\n");
+    return -1;
+  }
+
+  // enough static frames to go through the pool a few times
+  int pool = streamer.poolBlocks();
+  if (frames <= 0)
+    frames = 4*pool;
+  printf("%d blocks in the send pool, streaming %d frames\n", pool, frames);
+
+  char *pixels = streamer.frame()->getPixelBuffer();
+  int failed = 0;
+
+  for (int i=0; i<frames; i++) {
+    // a new picture now and then, static frames otherwise
+    if (i % 16 == 0)
+      drawFrame(pixels, i, (i/16) % 5);
+
+    wall->blocks = 0;
+    if (streamer.stream() < 0) {
+      printf("FAIL frame %d couldn't be streamed\n", i);
+      failed++;
+      break;
+    }
+
+    int bad = checkWall(*wall, pixels);
+    if (bad > 0) {
+      printf("FAIL frame %d : %d blocks differ\n", i, bad);
+      failed++;
+    }
+    if (i % 16 != 0 && wall->blocks != 1) {
+      printf("FAIL static frame %d sent %d blocks\n", i, wall->blocks);
+      failed++;
+    }
+  }
+
+  printf("%lld bytes sent, %d right eyes as residuals\n", wall->sent, wall->residuals);
+  if (wall->residuals == 0 || wall->damaged > 0) {
+    printf("FAIL %d residuals, %d of them damaged\n", wall->residuals, wall->damaged);
+    failed++;
+  }
+
+  if (checkPackedGroup() != 0) {
+    printf("FAIL a packed group came out different\n");
+    failed++;
+  }
+
+  if (!failed)
+    printf("PASS\n");
+
+  return failed ? -1 : 0;
+}
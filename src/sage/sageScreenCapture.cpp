@@ -0,0 +1,402 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageScreenCapture.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#if defined(GLSL_YUV) || defined(SAGE_S3D)
+#if !defined(WIN32)
+#define GLEW_STATIC 1
+#endif
+#include <GL/glew.h>
+#else
+#if defined(__APPLE__)
+#include <OpenGL/gl.h>
+#include <OpenGL/glext.h>
+#else
+#include <GL/gl.h>
+#include <GL/glext.h>
+#endif
+#endif
+
+#include "sageScreenCapture.h"
+#include "sageClock.h"
+#include "sageTelemetry.h"
+#include "image.h"
+
+#if defined(WIN32)
+#include <direct.h>
+#endif
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telCaptured = telemetry.counter("sage_sdm_capture_tiles_total", "tile images written by screenshots and recordings");
+static int telDropped = telemetry.counter("sage_sdm_capture_dropped_total", "recorded tiles dropped because the writers fell behind");
+static int telEncode = telemetry.histogram("sage_sdm_capture_encode_us", "time to flip, encode and write a tile image, in microsecs");
+
+static void makeDir(const char *path)
+{
+#if defined(WIN32)
+  _mkdir(path);
+#else
+  mkdir(path, 0755);
+#endif
+}
+
+sageScreenCapture::sageScreenCapture(int tiles, int w, int h) : tileWidth(w), tileHeight(h),
+  buffersMade(false), running(true), recording(false), recordInterval(0.0), lastRecord(0.0),
+  recordFrame(0), recordStamp(0.0)
+{
+  slotNum = tiles * CAPTURE_RING_SIZE;
+  slots = new captureSlot[slotNum];
+  for (int i=0; i<slotNum; i++) {
+    slots[i].pbo = 0;
+    slots[i].state = SLOT_FREE;
+  }
+
+  recordDir[0] = '\0';
+  for (int i=0; i<MAX_TILES_PER_NODE; i++)
+    tileChanged[i] = true;
+
+  pthread_mutex_init(&lock, NULL);
+  pthread_cond_init(&jobCond, NULL);
+
+  for (int i=0; i<CAPTURE_WORKERS; i++) {
+    if (pthread_create(&workers[i], NULL, workerThread, (void*)this) != 0) {
+      SAGE_PRINTLOG("sageScreenCapture : can't create a worker thread");
+      workers[i] = 0;
+    }
+  }
+}
+
+sageScreenCapture::~sageScreenCapture()
+{
+  // the workers write out what is queued before leaving
+  pthread_mutex_lock(&lock);
+  running = false;
+  pthread_cond_broadcast(&jobCond);
+  pthread_mutex_unlock(&lock);
+
+  for (int i=0; i<CAPTURE_WORKERS; i++)
+    if (workers[i])
+      pthread_join(workers[i], NULL);
+
+  // deleting a mapped buffer unmaps it
+  for (int i=0; i<slotNum; i++)
+    if (slots[i].pbo)
+      glDeleteBuffersARB(1, &slots[i].pbo);
+
+  delete [] slots;
+
+  pthread_mutex_destroy(&lock);
+  pthread_cond_destroy(&jobCond);
+}
+
+void sageScreenCapture::makeBuffers()
+{
+  for (int i=0; i<slotNum; i++) {
+    glGenBuffersARB(1, &slots[i].pbo);
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, slots[i].pbo);
+    glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB, tileWidth*tileHeight*3, 0, GL_STREAM_READ_ARB);
+  }
+  glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+
+  buffersMade = true;
+}
+
+int sageScreenCapture::freeSlot()
+{
+  for (int i=0; i<slotNum; i++)
+    if (slots[i].state == SLOT_FREE)
+      return i;
+
+  return -1;
+}
+
+void sageScreenCapture::post(captureJob &job)
+{
+  pthread_mutex_lock(&lock);
+  jobs.push_back(job);
+  pthread_cond_signal(&jobCond);
+  pthread_mutex_unlock(&lock);
+}
+
+int sageScreenCapture::readTile(captureKind kind, int x, int y, const char *dir, const char *name)
+{
+  if (!buffersMade)
+    makeBuffers();
+
+  captureJob job;
+  job.kind = kind;
+  job.width = tileWidth;
+  job.height = tileHeight;
+  job.src = NULL;
+  job.pixels = NULL;
+  job.slot = -1;
+  job.frame = recordFrame;
+  job.stamp = (kind == CAPTURE_RECORDING) ? recordStamp : sageClock::instance().now();
+  strncpy(job.dir, dir, SAGE_NAME_LEN-1);
+  job.dir[SAGE_NAME_LEN-1] = '\0';
+  strncpy(job.name, name, SAGE_NAME_LEN-1);
+  job.name[SAGE_NAME_LEN-1] = '\0';
+
+  // we do RGB readback, so alignment should be 1, not 4 (default)
+  int align;
+  glGetIntegerv(GL_PACK_ALIGNMENT, &align);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadBuffer(GL_BACK);
+
+  pthread_mutex_lock(&lock);
+  int idx = freeSlot();
+  pthread_mutex_unlock(&lock);
+
+  if (idx >= 0) {
+    // returns at once, the copy is done by the GPU
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, slots[idx].pbo);
+    glReadPixels(x, y, tileWidth, tileHeight, GL_RGB, GL_UNSIGNED_BYTE, 0);
+    glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+
+    job.slot = idx;
+    slots[idx].job = job;
+    slots[idx].refreshes = 0;
+    slots[idx].readTime = sage::getTime();
+    slots[idx].state = SLOT_READING;
+  }
+  else if (kind == CAPTURE_SCREENSHOT) {
+    // the ring is full of earlier screenshots, a screenshot isn't dropped
+    job.pixels = (unsigned char *)malloc(tileWidth*tileHeight*3);
+    glReadPixels(x, y, tileWidth, tileHeight, GL_RGB, GL_UNSIGNED_BYTE, job.pixels);
+    post(job);
+  }
+
+  glPixelStorei(GL_PACK_ALIGNMENT, align);
+
+  if (idx < 0 && kind == CAPTURE_RECORDING) {
+    telemetry.add(telDropped);
+    return -1;
+  }
+
+  return 0;
+}
+
+void sageScreenCapture::poll()
+{
+  if (!buffersMade)
+    return;
+
+  double now = sage::getTime();
+
+  for (int i=0; i<slotNum; i++) {
+    captureSlot &slot = slots[i];
+
+    pthread_mutex_lock(&lock);
+    slotState state = slot.state;
+    pthread_mutex_unlock(&lock);
+
+    if (state == SLOT_READING) {
+      slot.refreshes++;
+      if (slot.refreshes < CAPTURE_MAP_DELAY && now - slot.readTime < CAPTURE_MAP_TIMEOUT)
+        continue;
+
+      // the worker reads the mapped buffer, it is unmapped once copied
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, slot.pbo);
+      slot.job.src = (unsigned char *)glMapBufferARB(GL_PIXEL_PACK_BUFFER_ARB, GL_READ_ONLY_ARB);
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+
+      if (!slot.job.src) {
+        SAGE_PRINTLOG("sageScreenCapture : can't map the pixel buffer, %s dropped", slot.job.name);
+        slot.state = SLOT_FREE;
+        continue;
+      }
+
+      slot.state = SLOT_MAPPED;
+      post(slot.job);
+    }
+    else if (state == SLOT_COPIED) {
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, slot.pbo);
+      glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+
+      pthread_mutex_lock(&lock);
+      slot.state = SLOT_FREE;
+      pthread_mutex_unlock(&lock);
+    }
+  }
+}
+
+void* sageScreenCapture::workerThread(void *args)
+{
+  sageScreenCapture *This = (sageScreenCapture *)args;
+  This->workerLoop();
+
+  pthread_exit(NULL);
+  return NULL;
+}
+
+void sageScreenCapture::workerLoop()
+{
+  while (1) {
+    pthread_mutex_lock(&lock);
+    while (running && jobs.empty())
+      pthread_cond_wait(&jobCond, &lock);
+
+    if (jobs.empty()) {
+      pthread_mutex_unlock(&lock);
+      break;
+    }
+
+    captureJob job = jobs.front();
+    jobs.pop_front();
+    pthread_mutex_unlock(&lock);
+
+    encode(job);
+  }
+}
+
+void sageScreenCapture::encode(captureJob &job)
+{
+  double start = sage::getTime();
+  int rowSize = job.width*3;
+  unsigned char *image = (unsigned char *)malloc(rowSize*job.height);
+
+  // GL rows go bottom up, the image top down
+  unsigned char *src = job.src ? job.src : job.pixels;
+  for (int r=0; r<job.height; r++)
+    memcpy(image + r*rowSize, src + (job.height-1-r)*rowSize, rowSize);
+
+  if (job.slot >= 0) {
+    // the display thread can unmap the buffer now
+    pthread_mutex_lock(&lock);
+    slots[job.slot].state = SLOT_COPIED;
+    pthread_mutex_unlock(&lock);
+  }
+  if (job.pixels)
+    free(job.pixels);
+
+  // written under a temporary name, readers only ever see complete images
+  char path[SAGE_NAME_LEN*2+2], tmpPath[SAGE_NAME_LEN*2+3];
+  if (job.kind == CAPTURE_RECORDING)
+    makeDir(job.dir);
+  sprintf(path, "%s/%s", job.dir, job.name);
+  sprintf(tmpPath, "%s/.%s", job.dir, job.name);
+
+  image_write(tmpPath, job.width, job.height, 3, 1, image);
+  free(image);
+
+  if (rename(tmpPath, path) != 0) {
+    SAGE_PRINTLOG("sageScreenCapture : can't write %s", path);
+    return;
+  }
+
+  if (job.kind == CAPTURE_RECORDING) {
+    char indexPath[SAGE_NAME_LEN+8];
+    sprintf(indexPath, "%s/index", job.dir);
+
+    pthread_mutex_lock(&lock);
+    FILE *fp = fopen(indexPath, "a");
+    if (fp) {
+      fprintf(fp, "%ld %.0f %s\n", job.frame, job.stamp, job.name);
+      fclose(fp);
+    }
+    pthread_mutex_unlock(&lock);
+  }
+
+  telemetry.add(telCaptured);
+  telemetry.observe(telEncode, (long long)(sage::getTime() - start));
+}
+
+void sageScreenCapture::setRecording(char *data)
+{
+  char dir[SAGE_NAME_LEN];
+  int interval = CAPTURE_RECORD_INTERVAL;
+
+  // the width of %s follows the size of dir
+  char format[32];
+  sprintf(format, "%%%ds %%d", SAGE_NAME_LEN-1);
+
+  dir[0] = '\0';
+  if (data)
+    sscanf(data, format, dir, &interval);
+
+  if (dir[0] == '\0' || strcmp(dir, "stop") == 0) {
+    if (recording)
+      SAGE_PRINTLOG("sageScreenCapture : recording stopped after %ld frames", recordFrame);
+    recording = false;
+    return;
+  }
+
+  makeDir(dir);
+  strcpy(recordDir, dir);
+  recordInterval = MAX(interval, 1) * 1000.0;
+  lastRecord = 0.0;
+  recordFrame = 0;
+
+  // the first frame has every tile
+  for (int i=0; i<MAX_TILES_PER_NODE; i++)
+    tileChanged[i] = true;
+
+  recording = true;
+  SAGE_PRINTLOG("sageScreenCapture : recording to %s every %d ms", recordDir, interval);
+}
+
+bool sageScreenCapture::recordDue()
+{
+  if (!recording)
+    return false;
+
+  double now = sage::getTime();
+  if (now - lastRecord < recordInterval)
+    return false;
+
+  lastRecord = now;
+  recordFrame++;
+  recordStamp = sageClock::instance().now();
+
+  return true;
+}
+
+void sageScreenCapture::recordTile(int idx, int x, int y, int tileX, int tileY)
+{
+  if (!tileChanged[idx])
+    return;
+
+  char dir[SAGE_NAME_LEN], name[SAGE_NAME_LEN];
+  snprintf(dir, SAGE_NAME_LEN, "%s/tile-%d-%d", recordDir, tileX, tileY);
+  snprintf(name, SAGE_NAME_LEN, "frame-%08ld.jpg", recordFrame);
+
+  // a dropped tile stays changed and goes into the next frame
+  if (readTile(CAPTURE_RECORDING, x, y, dir, name) == 0)
+    tileChanged[idx] = false;
+}
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageScreenCapture.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_SCREEN_CAPTURE_H
+#define SAGE_SCREEN_CAPTURE_H
+
+#include "sageBase.h"
+#include <deque>
+
+// readbacks in flight per tile
+#define CAPTURE_RING_SIZE      3
+
+// a readback is mapped after that many refreshes...
+#define CAPTURE_MAP_DELAY      2
+
+// ...or after that many microsecs, whichever comes first
+#define CAPTURE_MAP_TIMEOUT    100000.0
+
+// threads flipping and encoding the tile images
+#define CAPTURE_WORKERS        2
+
+// default time between two recorded frames, in millisecs
+#define CAPTURE_RECORD_INTERVAL 1000
+
+enum captureKind { CAPTURE_SCREENSHOT, CAPTURE_RECORDING };
+
+/**
+ * a tile image on its way to disk
+ */
+struct captureJob {
+  captureKind kind;
+  int width, height;
+  unsigned char *src;     // mapped pixel buffer, bottom row first
+  unsigned char *pixels;  // copy read without a pixel buffer, bottom row first
+  int slot;               // pixel buffer to give back, -1 if none
+  long frame;             // recorded frame number
+  double stamp;           // cluster time of the frame, in microsecs
+  char dir[SAGE_NAME_LEN];
+  char name[SAGE_NAME_LEN];
+};
+
+/**
+ * Reads tiles back from the frame buffer without stalling the display
+ * thread: glReadPixels goes into a ring of pixel buffer objects and a
+ * buffer is only mapped a couple of refreshes later, when the GPU is done
+ * with it. Flipping and JPEG encoding happen on a pool of worker threads.
+ *
+ * On top of the one-shot screenshots, a recording mode writes the tiles
+ * that changed every interval to dir/tile-X-Y/, with an index of the
+ * frame numbers and their cluster time stamps; a tile missing from a frame
+ * didn't change. Recorded tiles are dropped rather than waited for when
+ * the workers fall behind.
+ *
+ * Everything but the workers runs on the display thread, with the GL
+ * context current.
+ */
+class sageScreenCapture {
+private:
+  enum slotState { SLOT_FREE, SLOT_READING, SLOT_MAPPED, SLOT_COPIED };
+
+  struct captureSlot {
+    unsigned int pbo;   // GL buffer name
+    slotState state;
+    int refreshes;      // refreshes since the readback
+    double readTime;
+    captureJob job;
+  };
+
+  int tileWidth, tileHeight;
+  captureSlot *slots;
+  int slotNum;
+  bool buffersMade;
+
+  std::deque<captureJob> jobs;
+  pthread_t workers[CAPTURE_WORKERS];
+  bool running;
+  pthread_mutex_t lock;
+  pthread_cond_t  jobCond;
+
+  // recording
+  bool recording;
+  char recordDir[SAGE_NAME_LEN];
+  double recordInterval;
+  double lastRecord;
+  long recordFrame;
+  double recordStamp;
+  bool tileChanged[MAX_TILES_PER_NODE];
+
+  static void* workerThread(void *args);
+  void workerLoop();
+  void encode(captureJob &job);
+  void makeBuffers();
+  int freeSlot();
+  void post(captureJob &job);
+
+public:
+  sageScreenCapture(int tiles, int w, int h);
+  ~sageScreenCapture();
+
+  /**
+   * starts reading the tile at (x,y) of the back buffer. The image is
+   * written to dir/name (format by extension) once read. Returns -1 if a
+   * recorded tile had to be dropped
+   */
+  int readTile(captureKind kind, int x, int y, const char *dir, const char *name);
+
+  /**
+   * maps the readbacks that are done and hands them to the workers, gives
+   * the copied buffers back. Called once per display update
+   */
+  void poll();
+
+  // "dir [interval in ms]" starts recording, "stop" or an empty string stops it
+  void setRecording(char *data);
+
+  inline bool isRecording() { return recording; }
+  // the contents of tile idx changed, it goes into the next recorded frame
+  inline void tileDamaged(int idx) { tileChanged[idx] = true; }
+
+  /**
+   * true if a recording is on and its interval has passed. The frame
+   * number and time stamp move on, the tiles are then given to recordTile()
+   */
+  bool recordDue();
+
+  /**
+   * records tile idx, shown as tile (tileX,tileY) of the wall and found at
+   * (x,y) of the window, if it changed since it was last recorded
+   */
+  void recordTile(int idx, int x, int y, int tileX, int tileY);
+};
+
+#endif
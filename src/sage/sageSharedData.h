@@ -53,6 +53,7 @@ class sageEventQueue;
 class displayContext;
 class streamProtocol;
 class messageInterface;
+class sageResourcePool;
 
 /**
  * class rcvSharedData
@@ -96,8 +97,10 @@ class dispSharedData : public rcvSharedData {
 public:
   displayContext *context;
   sageDisplay   *displayObj; /**< created in the sageDisplayManager::init() */
+  sageResourcePool *resPool; /**< montages and block buffers reused by PDLs */
+  double avDelay; /**< microsecs from capture to presentation of timestamped frames, 0 shows frames when complete */
 
-  dispSharedData() : displayObj(NULL), context(NULL) {}
+  dispSharedData() : displayObj(NULL), context(NULL), resPool(NULL), avDelay(0.0) {}
   ~dispSharedData();
 };
 
@@ -0,0 +1,313 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageStreamRecord.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageStreamRecord.h"
+#include "sageBlock.h"
+#include "sageBlockPool.h"
+#include "sageClock.h"
+
+// bytes of a block that carry data: the header and the pixel rows, or the
+// payload if the block was sent shorter
+static int blockDataSize(sagePixFmt fmt, sagePixelBlock *block)
+{
+  if (block->getPayloadSize() > 0)
+    return MIN(BLOCK_HEADER_SIZE + block->getPayloadSize(), block->getBufSize());
+
+  float comp = 1.0;
+  if (fmt == PIXFMT_DXT || fmt == PIXFMT_DXT5 || fmt == PIXFMT_DXT5YCOCG)
+    comp = 4.0;
+
+  int pixelSize = (int)ceil(getPixelSize(fmt)/comp);
+  int rows = (int)ceil(block->height/comp);
+  int size = BLOCK_HEADER_SIZE + rows*block->width*pixelSize;
+
+  return MIN(size, block->getBufSize());
+}
+
+sageStreamRecorder::sageStreamRecorder() : stream(NULL), index(NULL), streamBuf(NULL),
+  pixFmt(PIXFMT_888), skipFrame(-1), lastFrame(-1), frames(0), bytes(0)
+{
+  pthread_mutex_init(&lock, NULL);
+}
+
+sageStreamRecorder::~sageStreamRecorder()
+{
+  close();
+  pthread_mutex_destroy(&lock);
+}
+
+int sageStreamRecorder::open(const char *path, const char *desc)
+{
+  close();
+
+  char *fmtPt = sage::tokenSeek((char *)desc, 7);
+  if (!fmtPt || sscanf(fmtPt, "%d", (int *)&pixFmt) != 1) {
+    SAGE_PRINTLOG("sageStreamRecorder::open : invalid stream description");
+    return -1;
+  }
+
+  char indexPath[SAGE_NAME_LEN+8];
+  snprintf(indexPath, SAGE_NAME_LEN+8, "%s.idx", path);
+
+  FILE *fp = fopen(path, "wb");
+  FILE *ip = fopen(indexPath, "wb");
+  if (!fp || !ip) {
+    SAGE_PRINTLOG("sageStreamRecorder::open : can't create %s", path);
+    if (fp) fclose(fp);
+    if (ip) fclose(ip);
+    return -1;
+  }
+
+  char *buf = (char *)malloc(STREAM_RECORD_BUF_SIZE);
+  setvbuf(fp, buf, _IOFBF, STREAM_RECORD_BUF_SIZE);
+
+  int head[3];
+  head[0] = STREAM_RECORD_MAGIC;
+  head[1] = STREAM_RECORD_VERSION;
+  head[2] = strlen(desc)+1;
+  fwrite(head, sizeof(int), 3, fp);
+  fwrite(desc, 1, head[2], fp);
+
+  pthread_mutex_lock(&lock);
+  stream = fp;
+  index = ip;
+  streamBuf = buf;
+  skipFrame = -1;
+  lastFrame = -1;
+  frames = 0;
+  bytes = 0;
+  pthread_mutex_unlock(&lock);
+
+  SAGE_PRINTLOG("sageStreamRecorder : recording to %s", path);
+
+  return 0;
+}
+
+void sageStreamRecorder::close()
+{
+  pthread_mutex_lock(&lock);
+  if (stream) {
+    fclose(stream);
+    fclose(index);
+    free(streamBuf);
+    stream = NULL;
+    index = NULL;
+    streamBuf = NULL;
+    SAGE_PRINTLOG("sageStreamRecorder : %d frames, %lld bytes recorded", frames, bytes);
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+bool sageStreamRecorder::isOpen()
+{
+  pthread_mutex_lock(&lock);
+  bool open = (stream != NULL);
+  pthread_mutex_unlock(&lock);
+
+  return open;
+}
+
+void sageStreamRecorder::writeGroup(int sender, sageBlockGroup *grp)
+{
+  pthread_mutex_lock(&lock);
+
+  if (!stream) {
+    pthread_mutex_unlock(&lock);
+    return;
+  }
+
+  // start at a frame boundary, the rest of the current frame is skipped
+  int frameID = grp->getFrameID();
+  if (skipFrame < 0)
+    skipFrame = frameID;
+  if (frameID <= skipFrame) {
+    pthread_mutex_unlock(&lock);
+    return;
+  }
+
+  streamRecordHeader rec;
+  rec.sender = sender;
+  rec.flag = grp->getFlag();
+  rec.frameID = frameID;
+  rec.configID = grp->getConfigID();
+  rec.blockNum = 0;
+  rec.dataSize = 0;
+  rec.time = sageClock::instance().now();
+
+  if (rec.flag == sageBlockGroup::PIXEL_DATA) {
+    rec.blockNum = grp->getBlockNum();
+    for (int i=0; i<rec.blockNum; i++)
+      rec.dataSize += sizeof(int) + blockDataSize(pixFmt, (*grp)[i]);
+  }
+
+  if (frameID > lastFrame) {
+    streamIndexEntry entry;
+    entry.frameID = frameID;
+    entry.configID = rec.configID;
+    entry.offset = ftell(stream);
+    entry.time = rec.time;
+    fwrite(&entry, sizeof(entry), 1, index);
+
+    lastFrame = frameID;
+    frames++;
+  }
+
+  fwrite(&rec, sizeof(rec), 1, stream);
+  for (int i=0; i<rec.blockNum; i++) {
+    sagePixelBlock *block = (*grp)[i];
+    int len = blockDataSize(pixFmt, block);
+    fwrite(&len, sizeof(int), 1, stream);
+    fwrite(block->getBuffer(), 1, len, stream);
+  }
+  bytes += sizeof(rec) + rec.dataSize;
+
+  pthread_mutex_unlock(&lock);
+}
+
+sageStreamReader::sageStreamReader() : stream(NULL), desc(NULL), dataStart(0), blocksLeft(0)
+{
+}
+
+sageStreamReader::~sageStreamReader()
+{
+  close();
+}
+
+int sageStreamReader::open(const char *path)
+{
+  close();
+
+  stream = fopen(path, "rb");
+  if (!stream) {
+    SAGE_PRINTLOG("sageStreamReader::open : can't open %s", path);
+    return -1;
+  }
+
+  int head[3];
+  if (fread(head, sizeof(int), 3, stream) != 3 || head[0] != STREAM_RECORD_MAGIC ||
+      head[1] != STREAM_RECORD_VERSION || head[2] <= 0) {
+    SAGE_PRINTLOG("sageStreamReader::open : %s isn't a stream recording", path);
+    close();
+    return -1;
+  }
+
+  desc = (char *)malloc(head[2]);
+  if (fread(desc, 1, head[2], stream) != (size_t)head[2]) {
+    SAGE_PRINTLOG("sageStreamReader::open : %s is truncated", path);
+    close();
+    return -1;
+  }
+  desc[head[2]-1] = '\0';
+
+  dataStart = ftell(stream);
+  blocksLeft = 0;
+
+  return 0;
+}
+
+void sageStreamReader::close()
+{
+  if (stream)
+    fclose(stream);
+  if (desc)
+    free(desc);
+
+  stream = NULL;
+  desc = NULL;
+}
+
+int sageStreamReader::getStreamInfo(sagePixFmt &fmt, int &blockX, int &blockY, int &imgWidth, int &imgHeight)
+{
+  if (!desc)
+    return -1;
+
+  char *msgPt = sage::tokenSeek(desc, 7);
+  if (!msgPt || sscanf(msgPt, "%d %d %d %d %d", (int *)&fmt, &blockX, &blockY,
+                       &imgWidth, &imgHeight) != 5)
+    return -1;
+
+  return 0;
+}
+
+int sageStreamReader::nextRecord(streamRecordHeader &rec)
+{
+  if (!stream)
+    return -1;
+
+  // skip what is left of the previous record
+  while (blocksLeft > 0) {
+    int len;
+    if (fread(&len, sizeof(int), 1, stream) != 1 || fseek(stream, len, SEEK_CUR) != 0)
+      return -1;
+    blocksLeft--;
+  }
+
+  // a recording cut short ends with a partial record
+  if (fread(&rec, sizeof(rec), 1, stream) != 1)
+    return -1;
+
+  blocksLeft = rec.blockNum;
+
+  return 0;
+}
+
+int sageStreamReader::nextBlock(char *buf, int bufSize)
+{
+  if (!stream || blocksLeft <= 0)
+    return -1;
+
+  int len;
+  if (fread(&len, sizeof(int), 1, stream) != 1 || len > bufSize)
+    return -1;
+
+  if (fread(buf, 1, len, stream) != (size_t)len)
+    return -1;
+
+  blocksLeft--;
+
+  return len;
+}
+
+void sageStreamReader::rewind()
+{
+  if (stream) {
+    fseek(stream, dataStart, SEEK_SET);
+    blocksLeft = 0;
+  }
+}
@@ -0,0 +1,143 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageStreamRecord.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_STREAM_RECORD_H
+#define SAGE_STREAM_RECORD_H
+
+#include "misc.h"
+
+class sageBlockGroup;
+
+#define STREAM_RECORD_MAGIC    0x53475354   // "SGST"
+#define STREAM_RECORD_VERSION  1
+
+// stdio buffer of a recording, so the receiver thread rarely hits the disk
+#define STREAM_RECORD_BUF_SIZE (4*1024*1024)
+
+/**
+ * A stream recording is a file starting with
+ *   int magic, int version, int descLen, char desc[descLen]
+ * where desc is the receiver init message of the stream (pixel format,
+ * block and image size, see pixelDownloader::init), followed by one
+ * record per block group as it came from the network. Each block of a
+ * record is stored as an int length and the block itself (text header and
+ * pixel rows), without the padding up to the block size.
+ *
+ * Next to it, path.idx holds one streamIndexEntry per frame. All numbers
+ * are in host order.
+ */
+struct streamRecordHeader {
+  int sender;     // index of the sender stream at the receiver
+  int flag;       // sageBlockGroup::PIXEL_DATA or CONFIG_UPDATE
+  int frameID;
+  int configID;
+  int blockNum;
+  int dataSize;   // bytes of the blocks following the header
+  double time;    // cluster clock when the group arrived, in microsecs
+};
+
+struct streamIndexEntry {
+  int frameID;
+  int configID;
+  long long offset;  // of the frame's first record
+  double time;
+};
+
+/**
+ * writes the block groups received by a sagePixelReceiver to a recording.
+ * Groups are written from the receiving thread, open and close may be
+ * called from any other
+ */
+class sageStreamRecorder {
+private:
+  FILE *stream, *index;
+  char *streamBuf;
+  pthread_mutex_t lock;
+  sagePixFmt pixFmt;
+  int skipFrame;     // frame that was under way when the recording started
+  int lastFrame;
+  int frames;
+  long long bytes;
+
+public:
+  sageStreamRecorder();
+  ~sageStreamRecorder();
+
+  /** starts a recording of the stream described by desc, the receiver init message */
+  int open(const char *path, const char *desc);
+  void close();
+  bool isOpen();
+
+  /** appends a group read from sender stream i, from the next whole frame on */
+  void writeGroup(int sender, sageBlockGroup *grp);
+};
+
+/**
+ * reads a recording back, record by record
+ */
+class sageStreamReader {
+private:
+  FILE *stream;
+  char *desc;
+  long dataStart;    // offset of the first record
+  int blocksLeft;
+
+public:
+  sageStreamReader();
+  ~sageStreamReader();
+
+  int open(const char *path);
+  void close();
+
+  inline const char* getDesc() { return desc; }
+
+  /** the receiver init message fields a sender needs. Returns -1 if malformed */
+  int getStreamInfo(sagePixFmt &fmt, int &blockX, int &blockY, int &imgWidth, int &imgHeight);
+
+  /** reads the header of the next record. Returns -1 at the end of the recording */
+  int nextRecord(streamRecordHeader &rec);
+
+  /** reads the next block of the current record into buf, returns its length or -1 */
+  int nextBlock(char *buf, int bufSize);
+
+  /** goes back to the first record */
+  void rewind();
+};
+
+#endif
@@ -42,9 +42,14 @@
 #include "sageFrame.h"
 #include "streamInfo.h"
 #include "sageBlockPartition.h"
+#include "sageTelemetry.h"
+#include "sageAffinity.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telPacing = telemetry.histogram("sage_sail_pacing_jitter_us", "how late the streamer sends a frame after its deadline at the app frame rate, in microsecs");
 
 sageStreamer::sageStreamer() : params(NULL), streamerOn(true), configID(0),
-                               totalBandWidth(0), frameID(1), firstConfiguration(true), timeError(0.0)
+                               totalBandWidth(0), frameID(1), firstConfiguration(true)
 {
   //std::cerr << "init config ID " << configID << std::endl;
   msgQueue.clear();
@@ -133,6 +138,7 @@ int sageStreamer::initNetworks(char *data, bool localPort)
   setupBlockPool();
   nwObj->setFrameRate((double)config.frameRate);
   streamTimer.reset();
+  pacer.reset();
 
   if (pthread_create(&thId, 0, nwThread, (void*)this) != 0) {
     SAGE_PRINTLOG("sageBlockStreamer : can't create nwThread");
@@ -284,27 +290,15 @@ int sageStreamer::reconfigureStreams(char *msgStr)
 
 void sageStreamer::checkInterval()
 {
-  double curTime = streamTimer.getTimeUS();
-  double maxErr = interval*MAX_INTERVAL_ERROR;
-  double err = curTime - (interval - timeError);
-
-  while (err < -maxErr) {
-    sage::usleep(SYNC_TIMEOUT);
-    curTime = streamTimer.getTimeUS();
-    err = curTime - (interval - timeError);
-  }
-
-  if (timeError > maxErr)
-    timeError = 0.0;
-  else
-    timeError = err;
-
-  streamTimer.reset();
+  // setFrameRate() may have changed the interval
+  pacer.setInterval(interval);
+  telemetry.observe(telPacing, (long long)pacer.wait());
 }
 
 void* sageStreamer::nwThread(void *args)
 {
   sageStreamer *This = (sageStreamer *)args;
+  sageAffinity::instance().bind("network");
   This->streamLoop();
 
   pthread_exit(NULL);
@@ -47,6 +47,7 @@
 #include "sageDoubleBuf.h"
 #include "sageAudioCircBuf.h"
 #include "sageSync.h"
+#include "sageClock.h"
 #include "streamInfo.h"
 #include "sageTcpModule.h"
 #include "sageUdpModule.h"
@@ -98,7 +99,7 @@ protected:
   sageTimer streamTimer;
   sageCounter frameCounter;
   double interval;
-  double timeError;
+  sagePacer pacer;   // paces single node apps at the frame rate
 
   pthread_t thId;
 
@@ -174,6 +175,20 @@ protected:
   float compX, compY, compFactor;
   sageBlockGroup *nbg;
 
+  // sender sync of parallel apps
+  int syncedFrame;                                   // newest frame released by the sync master
+  std::deque< std::pair<int, double> > syncUpdates;  // frames reported to the sync master, and when
+  std::deque< std::pair<int, char *> > syncConfigs;  // stream configurations, and the frame they start with
+
+  /**
+   * reports frameID to the sync master and waits until the nodes may stream
+   * it. With config.syncPipeline > 0 a node goes on with the next frames
+   * while the sync master still collects this one, and the configurations
+   * take effect syncPipeline frames after the sync frame they came with
+   */
+  int syncParallel();
+  int readSync();
+
   /**
    * keeps calling streamPixelData() with one part of the doubleBuf
    */
@@ -188,6 +203,25 @@ protected:
    */
   int streamPixelData(sageBlockFrame *buf);
 
+  // stereo streams sent in planes (config.s3dPlanes)
+  bool s3dPlanes;
+  int s3dConfigID, s3dKeyFrame;      // configuration and frame of the last complete stereo frame
+  std::vector<char *> eyeRef[2];     // the left and right pixels of each block the receivers have
+  std::vector<bool> rcvFed;          // receivers that got a block of the current frame
+  std::vector<char> eyeCode;         // a right eye coded against the left one
+
+  char* eyeBuffer(int eye, int blockID);
+
+  /**
+   * sends the left and right eye of each block as blocks of their own.
+   * Eyes the receivers already have (S3D_CODE_DELTA) and right eyes that are
+   * the same as the left (S3D_CODE_PREDICT) are left out, but each receiver
+   * gets at least one block of every frame so that it finishes the frame.
+   * With S3D_CODE_PREDICT the other right eyes are sent as their difference
+   * to the left eye when that is shorter, see sageEncodeEyeResidual()
+   */
+  int streamS3DPlanes(sageBlockFrame *buf);
+
 public:
   sageBlockStreamer(streamerConfig &conf, int pixSize);
 
@@ -214,6 +248,7 @@ protected:
   sageTimer frameTimer;
   double accInterval;
   bool firstFrame;
+  unsigned int droppedFrames;  // frames skipped because this streamer fell behind
 
   //   int sailClient; // to send message to sail
   bridgeSharedData *shared;
@@ -242,6 +277,7 @@ class sageAudioStreamer : public sageStreamer {
 protected:
   sageAudioCircBuf* buffer;
   int bytesPerSample;
+  double nextPTS; /**< timestamp of the next block, 0 until a stamped block is sent */
 
   virtual int streamLoop();
   virtual int reconfigureStreams(char *msgStr);
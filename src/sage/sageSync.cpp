@@ -41,6 +41,12 @@
 
 #include "sageSync.h"
 #include "sageBuf.h"
+#include "sageClock.h"
+#include "sageTelemetry.h"
+#include "sageAffinity.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int telPacing = telemetry.histogram("sage_sync_pacing_jitter_us", "how late the sync master sends a sync signal after its deadline at the group frame rate, in microsecs");
 
 #if defined(WIN32)
 #define MSG_WAITALL  0x8
@@ -82,15 +88,14 @@ int syncGroup::setFrameRate(float frameRate)
 
 bool syncGroup::checkInterval()
 {
-  double curTime = timer.getTimeUS();
-  double maxErr = interval*MAX_INTERVAL_ERROR;
-  double err = curTime - (interval - timeError);
-  if (err > -maxErr) {
-    if (timeError > maxErr)
-      timeError = 0.0;
-    else
-      timeError = err;
-    timer.reset();
+  pacer.setInterval(interval);
+
+  double late;
+  if (pacer.isDue(interval*MAX_INTERVAL_ERROR, &late)) {
+    telemetry.observe(telPacing, (long long)late);
+    // ASAP groups go when their nodes are ready, a late release must not
+    // let the next ones follow back to back
+    pacer.holdOff();
     waitingInterval = false;
     return true;
   }
@@ -175,6 +180,23 @@ int syncGroup::processUpdate(char *data)
     break;
   }
 
+  case SAGE_UPDATE_PIPELINE: {
+    // a slave may report the next frames before the others reported this
+    // one, so the updates are counted per frame
+    if (frameNum > curFrame) {
+      int &updates = frameUpdates[frameNum];
+      updates++;
+
+      if (updates >= slaveNum*hardness) {
+        curFrame = frameNum;
+        frameUpdates.erase(frameUpdates.begin(), frameUpdates.upper_bound(frameNum));
+        return NORMAL_SYNC;
+      }
+    }
+
+    break;
+  }
+
   case SAGE_UPDATE_AUDIO: {
     //sungwon
     //SAGE_PRINTLOG("syncGroup::processUpdate(SAGE_UPDATE_AUDIO) : for group %d, frameNum %d, updateParam %d, updateType %d \n", groupID, frameNum, updateParam, updateType);
@@ -429,6 +451,7 @@ void* sageSyncBBServer :: syncServerThread(void *args)
 {
   sageSyncBBServer *This;
   This = (sageSyncBBServer *)args;
+  sageAffinity::instance().bind("sync");
 
   int tempSockFd;
   int tempBarrierSockFd;
@@ -502,6 +525,7 @@ void* sageSyncBBServer::syncBarrierServerThread(void *args)
   SAGE_PRINTLOG("sageSyncBBServer::syncBarrierServerThread() : started.");
 
   sageSyncBBServer *This = (sageSyncBBServer *)args;
+  sageAffinity::instance().bind("sync");
 
   int tempBarrierSockFd;
   int addrLen;
@@ -621,6 +645,7 @@ int sageSyncBBServer::startManagerThread(int totalRcvNum, int refreshInterval, i
 void* sageSyncBBServer::mainLoopThread(void *args)
 {
   sageSyncBBServer *This = (sageSyncBBServer *)args;
+  sageAffinity::instance().bind("sync");
 
   /**
    * speed of syncMaster
@@ -876,7 +901,8 @@ void* sageSyncBBServer::mainLoopThread(void *args)
     // for each application
     // it memset with zeros, then SDM::processSync will read wrong value
     // if it's unsigned type, then it will become UINT_MAX, ULONG_MAX, or ULLONG_MAX
-    intMsg_byteLen = sizeof(int) + (sizeof(int) * numUpdatedApps * 2); // sizeof(int) byte is for MSG_PEEK at the SDM
+    // the length (for MSG_PEEK at the SDM), the master clock, then (appID, frame) pairs
+    intMsg_byteLen = sizeof(int) * (SYNC_MSG_HEADER + numUpdatedApps * 2);
     intMsg = (int *)malloc(intMsg_byteLen);
     memset(intMsg, -1, intMsg_byteLen);
     intMsg[0] = intMsg_byteLen;
@@ -894,8 +920,8 @@ void* sageSyncBBServer::mainLoopThread(void *args)
         if ( (*it).second ) {
           isReadyToSwapMonMap[ appID ] = false; // reset
 
-          intMsg[2*intMsgIndex + 1] = appID;
-          intMsg[2*intMsgIndex + 2] = syncFrameMap[appID];
+          intMsg[2*intMsgIndex + SYNC_MSG_HEADER] = appID;
+          intMsg[2*intMsgIndex + SYNC_MSG_HEADER+1] = syncFrameMap[appID];
           intMsgIndex++;
         }
         if ( intMsgIndex >= numUpdatedApps ) {
@@ -907,7 +933,7 @@ void* sageSyncBBServer::mainLoopThread(void *args)
 #ifdef DEBUG_SYNC
     SAGE_PRINTLOG("\tUpdatedApps : ");
     for ( int i=0; i<numUpdatedApps; i++ ) {
-      SAGE_PRINTLOG("(%d,%d) ", intMsg[2*i], intMsg[2*i+1]);
+      SAGE_PRINTLOG("(%d,%d) ", intMsg[2*i+SYNC_MSG_HEADER], intMsg[2*i+SYNC_MSG_HEADER+1]);
     }
     SAGE_PRINTLOG("\n");
 #endif
@@ -931,6 +957,12 @@ void* sageSyncBBServer::mainLoopThread(void *args)
     }
     /** temporary delat_compensation for 1st phase only */
 
+    // the display nodes align their frame traces to this clock
+    struct timeval masterT;
+    gettimeofday(&masterT, NULL);
+    intMsg[1] = masterT.tv_sec;
+    intMsg[2] = masterT.tv_usec;
+
     // Broadcast -> will trigger EVENT_SYNC_MESSAGE on all node
 #ifdef PROFILING_SYNCMASTER
     // node%d:pdl%d:frame%d:ITEM:%d:%d
@@ -1235,6 +1267,7 @@ void* sageSyncServer :: syncServerThread(void *args)
 {
   sageSyncServer *This;
   This = (sageSyncServer *)args;
+  sageAffinity::instance().bind("sync");
 
   int tempSockFd;
   int addrLen;
@@ -1306,7 +1339,8 @@ int sageSyncServer::sendSync(syncGroup *grp, int cmd)
 
   if (data)
     dataLen = strlen(data) + 1;
-  sprintf(msg, "%d %d %d %d", grp->id, grp->curFrame, dataLen, cmd);
+  // the master clock goes last, clients that don't know it ignore it
+  sprintf(msg, "%d %d %d %d %.0f", grp->id, grp->curFrame, dataLen, cmd, sageClock::instance().now());
 
   //std::cout << "send sync " << msg << std::endl;
 
@@ -1407,10 +1441,16 @@ void* sageSyncServer::managerConstantThread(void *args)
 {
   syncGroup *grp = (syncGroup *)args;
   sageSyncServer *This = (sageSyncServer *)grp->syncServer;
+  sageAffinity::instance().bind("sync");
+
+  // the interval may change while the group runs
+  sagePacer &pacer = grp->pacer;
+  pacer.reset();
 
   while (!grp->syncEnd) {
+    pacer.setInterval(grp->interval);
+    telemetry.observe(telPacing, (long long)pacer.wait());
     This->sendSync(grp);
-    sage::usleep((int)floor(grp->interval+0.5));
   }
 
   pthread_exit(NULL);
@@ -1421,6 +1461,7 @@ void* sageSyncServer::managerThread(void *args)
 {
   sageSyncServer *This;
   This = (sageSyncServer *)args;
+  sageAffinity::instance().bind("sync");
 
   while (!This->syncEnd)   {
     This->manageUpdate();
@@ -1865,6 +1906,7 @@ void* sageSyncClient::syncClientThread(void* args)
   //SAGE_PRINTLOG("sageSyncClient::syncClientThread started\n");
 
   sageSyncClient *This = (sageSyncClient *)args;
+  sageAffinity::instance().bind("sync");
 
   while (!This->syncEnd) {
     if (This->readSyncMsg() < 0)
@@ -1950,6 +1992,16 @@ int sageSyncClient::recvRefreshBarrier(bool nonblock) {
 
 
 
+// feeds the master clock at the end of a sageSyncServer message to sageClock
+static void sampleMasterClock(char *msg)
+{
+  double masterTime;
+  if (sscanf(msg, "%*d %*d %*d %*d %lf", &masterTime) == 1) {
+    sageClock &clock = sageClock::instance();
+    clock.addSample(masterTime, clock.local());
+  }
+}
+
 int sageSyncClient::readSyncMsg()
 {
   int dataSize = SAGE_SYNC_MSG_LEN;
@@ -1970,6 +2022,7 @@ int sageSyncClient::readSyncMsg()
 
   int frameNum, dataLen;
   sscanf(msg, "%d %d %d", &groupID, &frameNum, &dataLen);
+  sampleMasterClock(msg);
 
   if (groupID >= 0) {
     syncMsgStruct *syncMsg;
@@ -2043,6 +2096,7 @@ int sageSyncClient::waitForSyncData(char* &data)
   }
 
   sscanf(msg, "%d %d %d", &groupID, &frameNum, &dataLen);
+  sampleMasterClock(msg);
 
   if (dataLen > 0) {
     data = new char[dataLen];
@@ -2052,6 +2106,19 @@ int sageSyncClient::waitForSyncData(char* &data)
   return frameNum;
 }
 
+bool sageSyncClient::isSyncReady()
+{
+  fd_set readFds;
+  FD_ZERO(&readFds);
+  FD_SET(clientSockFd, &readFds);
+
+  struct timeval timeOut;
+  timeOut.tv_sec = 0;
+  timeOut.tv_usec = 0;
+
+  return (select(clientSockFd+1, &readFds, NULL, NULL, &timeOut) > 0);
+}
+
 int sageSyncClient::waitForSyncPeek() {
   int size = 0;
   int status = ::recv(clientSockFd, (char *)&size, sizeof(int), MSG_PEEK);
@@ -2085,6 +2152,9 @@ int sageSyncClient::waitForSync(char* msg, int len)
     return -1;
   }
 
+  if ( syncLevel == -1 )
+    sampleMasterClock(msg);
+
   return 0;
 }
 
@@ -45,6 +45,7 @@
 #define _SAGESYNC_H
 
 #include "sageBase.h"
+#include "sageClock.h"
 #include <list>
 #include <map>
 #include <bitset>
@@ -53,10 +54,15 @@
 #define MAX_SYNC_GROUP     100
 #define SYNC_MSG_BUF_LEN   64
 
+// ints in front of the (appID, frame) pairs of sageSyncBBServer messages :
+// the message length and the master clock (sec, usec)
+#define SYNC_MSG_HEADER    3
+
 #define SAGE_UPDATE_SETUP    1
 #define SAGE_UPDATE_FOLLOW   2
 #define SAGE_UPDATE_FRAME    3
 #define SAGE_UPDATE_AUDIO    4
+#define SAGE_UPDATE_PIPELINE 5  /**< like FOLLOW, but updates of several frames may be in flight */
 
 #define SAGE_CONSTANT_SYNC   1
 #define SAGE_ASAP_SYNC_HARD  2
@@ -136,7 +142,7 @@ protected:
    */
   double interval;
 
-  double timeError;
+  sagePacer pacer; /**< deadlines of the sync signals at the interval */
   bool syncEnd;
 
   /**
@@ -152,13 +158,15 @@ protected:
   bool waitingInterval; /**< whether syncGroup is waiting to reach the interval */
   bool waitForKeyFrame;
 
+  std::map<int, int> frameUpdates; /**< SAGE_UPDATE_PIPELINE : updates received per frame */
+
 public:
   /**
    * Constructor.
    */
   syncGroup() : id(0), noOfUpdates(0), curFrame(0), slaveNum(0), syncEnd(false), interval(0.0),
                 policy(SAGE_ASAP_SYNC_SOFT), videoFrame(0), audioFrame(-1), keyFrame(100), holdSync(false),
-                timeError(0.0), waitingInterval(false), waitForKeyFrame(false), skipFrame(0), audioSyncCnt(0)
+                waitingInterval(false), waitForKeyFrame(false), skipFrame(0), audioSyncCnt(0)
   { syncMsgQueue.clear(); }
 
   int init(int startFrame, int _policy_, int groupID, int frameRate = 1, int sNum = 1); /**< syncGroup::init() */
@@ -553,6 +561,11 @@ public:
    */
   int waitForSyncData(char* &data);
 
+  /**
+   * true if a sync message has arrived and waitForSyncData() won't block
+   */
+  bool isSyncReady();
+
 
   /**
    * ch
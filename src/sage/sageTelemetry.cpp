@@ -0,0 +1,276 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageTelemetry.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageTelemetry.h"
+#include "misc.h"
+
+sageTelemetry::sageTelemetry() : metricNum(0), slotNum(0), exporting(false),
+                                 interval(TELEMETRY_DEFAULT_INTERVAL)
+{
+  pthread_key_create(&shardKey, releaseShard);
+  pthread_mutex_init(&lock, NULL);
+  memset(retired.slots, 0, sizeof(retired.slots));
+  exportPath[0] = '\0';
+  labels[0] = '\0';
+}
+
+sageTelemetry& sageTelemetry::instance()
+{
+  static sageTelemetry telemetry;
+  return telemetry;
+}
+
+int sageTelemetry::addMetric(const char *name, const char *help, sageMetricType type, int slots)
+{
+  pthread_mutex_lock(&lock);
+
+  for (int i=0; i<metricNum; i++) {
+    if (strcmp(metrics[i].name, name) == 0) {
+      pthread_mutex_unlock(&lock);
+      return (metrics[i].type == type) ? i : -1;
+    }
+  }
+
+  if (metricNum >= TELEMETRY_MAX_METRICS || slotNum + slots > TELEMETRY_MAX_SLOTS) {
+    pthread_mutex_unlock(&lock);
+    SAGE_PRINTLOG("sageTelemetry : no room for metric %s", name);
+    return -1;
+  }
+
+  sageMetric &m = metrics[metricNum];
+  strncpy(m.name, name, SAGE_NAME_LEN-1);
+  m.name[SAGE_NAME_LEN-1] = '\0';
+  strncpy(m.help, help, SAGE_NAME_LEN-1);
+  m.help[SAGE_NAME_LEN-1] = '\0';
+  m.type = type;
+  m.slot = slotNum;
+  m.perThread = false;
+  slotNum += slots;
+
+  int id = metricNum++;
+  pthread_mutex_unlock(&lock);
+
+  return id;
+}
+
+int sageTelemetry::counter(const char *name, const char *help)
+{
+  return addMetric(name, help, METRIC_COUNTER, 1);
+}
+
+int sageTelemetry::gauge(const char *name, const char *help)
+{
+  return addMetric(name, help, METRIC_GAUGE, 1);
+}
+
+int sageTelemetry::histogram(const char *name, const char *help)
+{
+  // the buckets, the sum and the count
+  return addMetric(name, help, METRIC_HISTOGRAM, TELEMETRY_BUCKETS+2);
+}
+
+telemetryShard* sageTelemetry::newShard()
+{
+  telemetryShard *s = new telemetryShard;
+  memset(s->slots, 0, sizeof(s->slots));
+
+  pthread_mutex_lock(&lock);
+  shards.push_back(s);
+  pthread_mutex_unlock(&lock);
+
+  pthread_setspecific(shardKey, s);
+
+  return s;
+}
+
+void sageTelemetry::releaseShard(void *shard)
+{
+  telemetryShard *s = (telemetryShard *)shard;
+  sageTelemetry &t = instance();
+
+  pthread_mutex_lock(&t.lock);
+
+  // counters and histograms stay part of the totals, set() gauges go with the thread
+  for (int i=0; i<t.metricNum; i++) {
+    sageMetric &m = t.metrics[i];
+    if (m.type == METRIC_GAUGE && m.perThread)
+      continue;
+
+    int slots = (m.type == METRIC_HISTOGRAM) ? TELEMETRY_BUCKETS+2 : 1;
+    for (int j=m.slot; j<m.slot+slots; j++)
+      t.retired.slots[j] += s->slots[j];
+  }
+
+  for (int i=0; i<t.shards.size(); i++) {
+    if (t.shards[i] == s) {
+      t.shards.erase(t.shards.begin() + i);
+      break;
+    }
+  }
+  pthread_mutex_unlock(&t.lock);
+
+  delete s;
+}
+
+long long sageTelemetry::value(int id)
+{
+  if (id < 0 || id >= metricNum)
+    return 0;
+
+  int slot = metrics[id].slot;
+  if (metrics[id].type == METRIC_HISTOGRAM)
+    slot += TELEMETRY_BUCKETS+1;
+
+  pthread_mutex_lock(&lock);
+  long long sum = retired.slots[slot];
+  for (int i=0; i<shards.size(); i++)
+    sum += shards[i]->slots[slot];
+  pthread_mutex_unlock(&lock);
+
+  return sum;
+}
+
+void sageTelemetry::format(std::string &out)
+{
+  static const char *typeNames[] = { "counter", "gauge", "histogram" };
+
+  long long sums[TELEMETRY_MAX_SLOTS];
+
+  pthread_mutex_lock(&lock);
+  int num = metricNum;
+  int slots = slotNum;
+  memcpy(sums, retired.slots, sizeof(sums));
+  for (int i=0; i<shards.size(); i++) {
+    long long *s = shards[i]->slots;
+    for (int j=0; j<slots; j++)
+      sums[j] += s[j];
+  }
+  pthread_mutex_unlock(&lock);
+
+  // labels go in front of "le" for the histogram buckets
+  char sep[2] = { labels[0] ? ',' : '\0', '\0' };
+
+  char line[TOKEN_LEN];
+  for (int i=0; i<num; i++) {
+    sageMetric &m = metrics[i];
+    sprintf(line, "# HELP %s %s\n# TYPE %s %s\n", m.name, m.help, m.name, typeNames[m.type]);
+    out += line;
+
+    if (m.type != METRIC_HISTOGRAM) {
+      sprintf(line, "%s{%s} %lld\n", m.name, labels, sums[m.slot]);
+      out += line;
+      continue;
+    }
+
+    long long cumulative = 0;
+    for (int b=0; b<TELEMETRY_BUCKETS; b++) {
+      cumulative += sums[m.slot + b];
+      if (b < TELEMETRY_BUCKETS-1)
+        sprintf(line, "%s_bucket{%s%sle=\"%lld\"} %lld\n", m.name, labels, sep, 1LL << b, cumulative);
+      else
+        sprintf(line, "%s_bucket{%s%sle=\"+Inf\"} %lld\n", m.name, labels, sep, cumulative);
+      out += line;
+    }
+
+    sprintf(line, "%s_sum{%s} %lld\n%s_count{%s} %lld\n", m.name, labels, sums[m.slot + TELEMETRY_BUCKETS],
+            m.name, labels, sums[m.slot + TELEMETRY_BUCKETS+1]);
+    out += line;
+  }
+}
+
+int sageTelemetry::startExport(const char *name, const char *l)
+{
+  char *dir = getenv("SAGE_TELEMETRY_DIR");
+  if (!dir || !dir[0])
+    return 0;
+
+  pthread_mutex_lock(&lock);
+  if (exporting) {
+    pthread_mutex_unlock(&lock);
+    return 0;
+  }
+  exporting = true;
+
+  snprintf(exportPath, sizeof(exportPath), "%s/%s.prom", dir, name);
+  strncpy(labels, l, SAGE_NAME_LEN-1);
+  labels[SAGE_NAME_LEN-1] = '\0';
+
+  char *sec = getenv("SAGE_TELEMETRY_INTERVAL");
+  if (sec && atoi(sec) > 0)
+    interval = atoi(sec);
+  pthread_mutex_unlock(&lock);
+
+  pthread_t thId;
+  if (pthread_create(&thId, 0, exportThread, (void*)this) != 0) {
+    SAGE_PRINTLOG("sageTelemetry : can't create export thread");
+    return -1;
+  }
+  pthread_detach(thId);
+
+  SAGE_PRINTLOG("sageTelemetry : writing metrics to %s every %d seconds", exportPath, interval);
+
+  return 0;
+}
+
+void* sageTelemetry::exportThread(void *args)
+{
+  sageTelemetry *This = (sageTelemetry *)args;
+
+  char tmpPath[TOKEN_LEN+8];
+  sprintf(tmpPath, "%s.tmp", This->exportPath);
+
+  while (1) {
+    sage::sleep(This->interval);
+
+    std::string text;
+    This->format(text);
+
+    // the collector never sees a half written file
+    FILE *fp = fopen(tmpPath, "w");
+    if (!fp) {
+      SAGE_PRINTLOG("sageTelemetry : can't write %s", tmpPath);
+      continue;
+    }
+    fwrite(text.data(), 1, text.size(), fp);
+    fclose(fp);
+    rename(tmpPath, This->exportPath);
+  }
+
+  return NULL;
+}
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageTelemetry.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_TELEMETRY_H
+#define SAGE_TELEMETRY_H
+
+#include "sageBase.h"
+#include "misc.h"
+#include <string>
+
+#define TELEMETRY_MAX_METRICS 128
+#define TELEMETRY_MAX_SLOTS   2048
+
+// histogram buckets hold values <= 1, 2, 4, ... 2^22 and the rest (+Inf)
+#define TELEMETRY_BUCKETS     24
+
+// seconds between two exports when SAGE_TELEMETRY_INTERVAL isn't set
+#define TELEMETRY_DEFAULT_INTERVAL 10
+
+enum sageMetricType { METRIC_COUNTER, METRIC_GAUGE, METRIC_HISTOGRAM };
+
+struct sageMetric {
+  char name[SAGE_NAME_LEN];
+  char help[SAGE_NAME_LEN];
+  sageMetricType type;
+  int slot; // first slot of the metric in a shard
+  bool perThread; // a gauge threads set() to their own value
+};
+
+// the values a thread recorded, nobody else writes them
+struct telemetryShard {
+  long long slots[TELEMETRY_MAX_SLOTS];
+};
+
+/**
+ * Counters, gauges and histograms of one process. Every thread records into
+ * its own shard without locks or atomics, so recording costs an add or two
+ * and the metrics can stay on at full load. The exporter sums the shards.
+ * When a thread ends its shard is dropped: its counters and histograms are
+ * folded into the totals of the ended threads, so those sums never go down.
+ * So are the gauges moved with add(), which other threads may move back.
+ * The gauges set() by the thread go with it, nobody updates them anymore.
+ *
+ * Metrics are registered once by name, registering a name again gives the
+ * same id. Gauges are summed over the threads that set them (e.g. the queue
+ * depths of all receivers). If SAGE_TELEMETRY_DIR is set, startExport() writes
+ * the metrics there in the Prometheus text format, for the textfile collector
+ * of the node exporter.
+ */
+class sageTelemetry {
+private:
+  sageMetric metrics[TELEMETRY_MAX_METRICS];
+  int metricNum;
+  int slotNum;
+
+  std::vector<telemetryShard *> shards;
+  telemetryShard retired; // counters and histograms of the ended threads
+  pthread_key_t shardKey;
+  pthread_mutex_t lock;
+
+  bool exporting;
+  int interval;
+  char exportPath[TOKEN_LEN];
+  char labels[SAGE_NAME_LEN];
+
+  sageTelemetry();
+
+  int addMetric(const char *name, const char *help, sageMetricType type, int slots);
+  telemetryShard* newShard();
+  static void releaseShard(void *shard);
+  static void* exportThread(void *args);
+
+  inline telemetryShard* shard() {
+    telemetryShard *s = (telemetryShard *)pthread_getspecific(shardKey);
+    return s ? s : newShard();
+  }
+
+public:
+  static sageTelemetry& instance();
+
+  /** these return the id of the metric, -1 if there is no room left */
+  int counter(const char *name, const char *help);
+  int gauge(const char *name, const char *help);
+  int histogram(const char *name, const char *help);
+
+  inline void add(int id, long long v = 1) {
+    if (id >= 0)
+      shard()->slots[metrics[id].slot] += v;
+  }
+
+  inline void set(int id, long long v) {
+    if (id < 0)
+      return;
+
+    if (!metrics[id].perThread)
+      metrics[id].perThread = true;
+    shard()->slots[metrics[id].slot] = v;
+  }
+
+  inline void observe(int id, long long v) {
+    if (id < 0)
+      return;
+
+    long long *h = shard()->slots + metrics[id].slot;
+    int b = 0;
+    while (b < TELEMETRY_BUCKETS-1 && v > (1LL << b))
+      b++;
+    h[b]++;
+    h[TELEMETRY_BUCKETS] += v;
+    h[TELEMETRY_BUCKETS+1]++;
+  }
+
+  /** the sum of a counter or gauge, or the count of a histogram */
+  long long value(int id);
+
+  /** appends all the metrics to out, in the Prometheus text format */
+  void format(std::string &out);
+
+  /**
+   * starts writing the metrics to $SAGE_TELEMETRY_DIR/<name>.prom every
+   * $SAGE_TELEMETRY_INTERVAL seconds. labels are put on every sample, e.g.
+   * proc="sdm",node="2". Does nothing if the variable isn't set or the
+   * export already runs
+   */
+  int startExport(const char *name, const char *labels);
+};
+
+/**
+ * observes the microseconds from its construction to its destruction into a
+ * histogram, for functions with many returns
+ */
+class telemetryTimer {
+private:
+  int id;
+  double start;
+
+public:
+  telemetryTimer(int metric) : id(metric), start(sage::getTime()) {}
+  ~telemetryTimer() { sageTelemetry::instance().observe(id, (long long)(sage::getTime() - start)); }
+};
+
+#endif
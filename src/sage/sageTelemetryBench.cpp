@@ -0,0 +1,123 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageTelemetryBench.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+/*
+ * Times the telemetry updates done on the streaming paths, from several
+ * threads at once, and the cost of formatting a report.
+ *
+ *   sageTelemetryBench [threads [updates]]
+ */
+
+#include "sageTelemetry.h"
+
+static sageTelemetry &telemetry = sageTelemetry::instance();
+static int benchCounter = telemetry.counter("bench_updates_total", "counter updates");
+static int benchHist = telemetry.histogram("bench_value_us", "histogram updates");
+
+static int updates = 10000000;
+
+static void* updateThread(void *args)
+{
+  double *nsPerUpdate = (double *)args;
+
+  sageTimer timer;
+  for (int i=0; i<updates; i++) {
+    telemetry.add(benchCounter);
+    telemetry.observe(benchHist, i & 0xffff);
+  }
+
+  // two updates per iteration
+  *nsPerUpdate = timer.getTimeUS() * 1000.0 / updates / 2;
+
+  return NULL;
+}
+
+int main(int argc, char **argv)
+{
+  int threads = 4;
+
+  if (argc >= 2)
+    threads = atoi(argv[1]);
+  if (argc >= 3)
+    updates = atoi(argv[2]);
+
+  if (threads <= 0 || updates <= 0) {
+    fprintf(stderr, "usage: %s [threads [updates]]\n", argv[0]);
+    return -1;
+  }
+
+  pthread_t *thId = new pthread_t[threads];
+  double *nsPerUpdate = new double[threads];
+
+  for (int i=0; i<threads; i++)
+    pthread_create(&thId[i], 0, updateThread, (void*)&nsPerUpdate[i]);
+
+  double worst = 0.0;
+  for (int i=0; i<threads; i++) {
+    pthread_join(thId[i], NULL);
+    worst = MAX(worst, nsPerUpdate[i]);
+  }
+
+  int failed = 0;
+  long long expected = (long long)threads * updates;
+  if (telemetry.value(benchCounter) != expected) {
+    printf("counter is %lld, expected %lld\n", telemetry.value(benchCounter), expected);
+    failed++;
+  }
+
+  sageTimer timer;
+  std::string report;
+  for (int i=0; i<100; i++) {
+    report.clear();
+    telemetry.format(report);
+  }
+  double formatUs = timer.getTimeUS() / 100.0;
+
+  // a display thread does a few updates per block group, count 100 a frame
+  double frameUs = 1000000.0 / 60;
+  printf("%d threads, %.1f ns per update (worst thread)\n", threads, worst);
+  printf("report of %d bytes formatted in %.1f us\n", (int)report.size(), formatUs);
+  printf("100 updates per 60Hz frame cost %.4f%% of the frame\n",
+         worst * 100 / 1000.0 / frameUs * 100);
+
+  delete [] thId;
+  delete [] nsPerUpdate;
+
+  return failed ? -1 : 0;
+}
@@ -206,6 +206,54 @@ void sageTexture::uploadTexture()
 }
 
 
+void sageTexture::reserve(int w, int h)
+{
+  texInfo.x = texInfo.y = 0;
+  texInfo.width = w;
+  texInfo.height = h;
+  renewTexture();
+}
+
+bool sageTexture::blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride)
+{
+  return false;
+}
+
+void sageTexture::loadPixelBlocks(sageBlockCopy *copies, int num)
+{
+  int offset, rowBytes, rows, stride;
+
+  if (num < 1)
+    return;
+
+  // blocks that go to GL directly or are converted are loaded one by one
+  if (!usePBO || !blockRows(copies[0].x, copies[0].y, copies[0].block->width,
+                            copies[0].block->height, offset, rowBytes, rows, stride)) {
+    for (int i=0; i<num; i++) {
+      sagePixelBlock *block = copies[i].block;
+      int bx = block->x, by = block->y;
+      block->x = copies[i].x;
+      block->y = copies[i].y;
+      loadPixelBlock(block);
+      block->x = bx;
+      block->y = by;
+    }
+    return;
+  }
+
+  std::vector<sageRowLayout> layouts(num);
+  double bytes = 0.0;
+  for (int i=0; i<num; i++) {
+    sageRowLayout &l = layouts[i];
+    blockRows(copies[i].x, copies[i].y, copies[i].block->width, copies[i].block->height,
+              l.offset, l.rowBytes, l.rows, l.stride);
+    bytes += (double)l.rowBytes * l.rows;
+  }
+
+  // a batch larger than the caches would only push the rest out of them
+  sageCopyBlocks((char *)texture, copies, &layouts[0], num, bytes >= SAGE_STREAM_COPY_MIN);
+}
+
 void sageTexture::deleteTexture()
 {
   if (texHandle >= 0) {
@@ -791,19 +839,21 @@ sageTextureS3DRGB::renewTexture()
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
+bool sageTextureRGB::blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride)
+{
+  offset   = (int)(y*texWidth*bpp + x*bpp);
+  rowBytes = (int)(w*bpp);
+  rows     = h;
+  stride   = (int)(texWidth*bpp);
+  return true;
+}
+
 void sageTextureRGB::copyIntoTexture(int _x, int _y, int _width, int _height, char *_block)
 {
-  GLubyte *destptr;
-  char    *srcptr;
-  int      i;
+  int offset, rowBytes, rows, stride;
 
-  destptr = texture + (int)(_y*texWidth*bpp + _x*bpp);
-  srcptr  = _block;
-  for (i=0;i<_height;i++) {
-    memcpy(destptr , srcptr, (int)(_width*bpp));
-    destptr += int(texWidth*bpp);
-    srcptr  += int(_width*bpp);
-  }
+  blockRows(_x, _y, _width, _height, offset, rowBytes, rows, stride);
+  sageCopyRows((char *)texture + offset, stride, _block, rowBytes, rows, false);
 }
 
 
@@ -822,45 +872,52 @@ inline int format_row_stride56(int width)
   return stride;
 }
 
-void sageTextureDXT::copyIntoTexture(int _x, int _y, int _width, int _height, char *_block)
+// a row of a DXT block is a row of 4x4 pixel tiles
+bool sageTextureDXT::blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride)
 {
-  GLubyte *destptr;
-  char    *srcptr;
-  int      i;
-
-  int srcRowStride, destRowStride;
   if (pixelType == PIXFMT_DXT) {
-    srcRowStride  = format_row_stride(_width);
-    destRowStride = format_row_stride(texWidth);
+    rowBytes = format_row_stride(w);
+    stride   = format_row_stride(texWidth);
   } else {
-    srcRowStride  = format_row_stride56(_width);
-    destRowStride = format_row_stride56(texWidth);
+    rowBytes = format_row_stride56(w);
+    stride   = format_row_stride56(texWidth);
   }
 
-  destptr = texture + (int)(_y*destRowStride/4 + 4*_x*bpp);
-  srcptr  = _block;
-  for (i=0;i<_height/4;i++) {
-    memcpy(destptr , srcptr, srcRowStride);
-    destptr += destRowStride;
-    srcptr  += srcRowStride;
-  }
+  offset = (int)(y*stride/4 + 4*x*bpp);
+  rows   = h/4;
+  return true;
 }
 
+void sageTextureDXT::copyIntoTexture(int _x, int _y, int _width, int _height, char *_block)
+{
+  int offset, rowBytes, rows, stride;
+
+  blockRows(_x, _y, _width, _height, offset, rowBytes, rows, stride);
+  sageCopyRows((char *)texture + offset, stride, _block, rowBytes, rows, false);
+}
+
+
+// only the Mac loads YUV blocks through the CPU memory buffer as they are
+bool sageTextureYUV::blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride)
+{
+  offset   = (int)(y*texWidth*bpp + x*bpp);
+  rowBytes = (int)(w*bpp);
+  rows     = h;
+  stride   = (int)(texWidth*bpp);
+#if defined(__APPLE__)
+  return true;
+#else
+  return false;
+#endif
+}
 
 // To be checked!!!
 void sageTextureYUV::copyIntoTexture(int _x, int _y, int _width, int _height, char *_block)
 {
-  GLubyte *destptr;
-  char    *srcptr;
-  int      i;
+  int offset, rowBytes, rows, stride;
 
-  destptr = texture + (int)(_y*texWidth*bpp + _x*bpp);
-  srcptr  = _block;
-  for (i=0;i<_height;i++) {
-    memcpy(destptr , srcptr, (int)(_width*bpp));
-    destptr += int(texWidth*bpp);
-    srcptr  += int(_width*bpp);
-  }
+  blockRows(_x, _y, _width, _height, offset, rowBytes, rows, stride);
+  sageCopyRows((char *)texture + offset, stride, _block, rowBytes, rows, false);
 }
 
 
@@ -893,6 +950,21 @@ void sageTextureS3DRGB::copyIntoTexture(int _x, int _y, int _width, int _height,
   }
 }
 
+void sageTextureS3DRGB::copyIntoPlane(GLubyte *plane, int _x, int _y, int _width, int _height, char *_block)
+{
+  GLubyte *destptr;
+  char    *srcptr;
+  int      i;
+
+  destptr = plane + (int)(_y*texWidth*bpp + _x*bpp);
+  srcptr  = _block;
+  for (i=0;i<_height;i++) {
+    memcpy(destptr, srcptr, (int)(_width*bpp));
+    destptr += int(texWidth*bpp);
+    srcptr  += int(_width*bpp);
+  }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -1154,6 +1226,59 @@ void sageTextureDXT::loadPixelBlock(sagePixelBlock *block)
 // default implementation: TO CHECK
 void sageTextureS3DRGB::loadPixelBlock(sagePixelBlock *block)
 {
+  int plane = block->getPlane();
+
+  // eyes sent apart go to their own texture, SAGE_PLANE_BOTH to both
+  if (plane != SAGE_PLANE_ALL) {
+    bool left = (plane == SAGE_PLANE_LEFT || plane == SAGE_PLANE_BOTH);
+    bool right = (plane == SAGE_PLANE_RIGHT || plane == SAGE_PLANE_BOTH || plane == SAGE_PLANE_RESIDUAL);
+    char *pixels = block->getPixelBuffer();
+    int stride = (int)(texWidth*bpp);
+
+    // a residual is decoded against the left eye of the block, so texture
+    // keeps the left eye also when the blocks go to GL directly
+    if (left)
+      copyIntoPlane(texture, block->x, block->y, block->width, block->height, pixels);
+
+    if (plane == SAGE_PLANE_RESIDUAL) {
+      GLubyte *leftEye = texture + (int)(block->y*stride + block->x*bpp);
+      bool decoded;
+      if (usePBO) {
+        GLubyte *rightEye = textureR + (int)(block->y*stride + block->x*bpp);
+        decoded = sageDecodeEyeResidual(pixels, block->getPayloadSize(), (char *)leftEye, stride,
+                                        (char *)rightEye, stride, block->width, block->height);
+      }
+      else {
+        residual.resize(block->width*block->height*3);
+        decoded = sageDecodeEyeResidual(pixels, block->getPayloadSize(), (char *)leftEye, stride,
+                                        &residual[0], block->width*3, block->width, block->height);
+        pixels = &residual[0];
+      }
+      if (!decoded) {
+        SAGE_PRINTLOG("sageTextureS3DRGB::loadPixelBlock : damaged right eye of block %d", block->getID());
+        return;
+      }
+    }
+    else if (right && usePBO)
+      copyIntoPlane(textureR, block->x, block->y, block->width, block->height, pixels);
+
+    if (!usePBO) {
+      if (left) {
+        glBindTexture(target, texHandle);
+        glTexSubImage2D(target, 0, block->x, block->y, block->width, block->height,
+                        pInfo.pixelFormat, pInfo.pixelDataType, pixels);
+        pixel_bytes += block->width * block->height * pInfo.bytesPerPixel;
+      }
+      if (right) {
+        glBindTexture(target, texRHandle);
+        glTexSubImage2D(target, 0, block->x, block->y, block->width, block->height,
+                        pInfo.pixelFormat, pInfo.pixelDataType, pixels);
+        pixel_bytes += block->width * block->height * pInfo.bytesPerPixel;
+      }
+    }
+    return;
+  }
+
   if (usePBO) {
     copyIntoTexture(block->x, block->y, block->width, block->height, block->getPixelBuffer());
   } else {
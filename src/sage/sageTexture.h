@@ -74,6 +74,7 @@
 #include "sageDraw.h"
 #include "sagePixelType.h"
 #include "sageSharedData.h"
+#include "sageBlockCopy.h"
 
 
 int GLprintError(const char *file, int line);
@@ -101,6 +102,8 @@ public:
   // Copy a block of pixels into the CPU memory buffer
   virtual void copyIntoTexture(int _x, int _y, int _width, int _height, char *_block) = 0;
   virtual void loadPixelBlock(sagePixelBlock *block) = 0;
+  // Load blocks sorted with sageBlockCopyOrder, side by side ones are copied together
+  virtual void loadPixelBlocks(sageBlockCopy *copies, int num);
   virtual void draw(float depth, int alpha, int tempAlpha,
                     float left, float right, float bottom, float top) = 0;
   virtual void renewTexture() = 0;
@@ -112,6 +115,12 @@ public:
   void deleteTexture();
   int  needsUpload() { return usePBO;}
 
+  // allocate the texture for a w x h block layout before init() is called
+  void reserve(int w, int h);
+  inline int getWidth()  { return texWidth; }
+  inline int getHeight() { return texHeight; }
+  inline sagePixFmt getPixelType() { return pixelType; }
+
 protected:
   int         texWidth, texHeight;
   sagePixFmt  pixelType;
@@ -132,6 +141,13 @@ protected:
   double   bpp;
   sagePixelType pInfo;
 
+  /**
+   * where the rows of a w x h block at x, y go in the CPU memory buffer :
+   * the offset of its first row, the bytes and number of its rows and the
+   * distance between the rows of the buffer. Returns false if the block
+   * isn't copied into the buffer as it is
+   */
+  virtual bool blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride);
 };
 
 class sageTextureRGB : public sageTexture
@@ -145,6 +161,9 @@ public:
   virtual void loadPixelBlock(sagePixelBlock *block);
   virtual void draw(float depth, int alpha, int tempAlpha,
                     float left, float right, float bottom, float top);
+
+protected:
+  virtual bool blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride);
 };
 
 class sageTextureYUV : public sageTexture
@@ -161,6 +180,9 @@ public:
   virtual void loadPixelBlock(sagePixelBlock *block);
   virtual void draw(float depth, int alpha, int tempAlpha,
                     float left, float right, float bottom, float top);
+
+protected:
+  virtual bool blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride);
 };
 
 
@@ -178,6 +200,9 @@ public:
   virtual void loadPixelBlock(sagePixelBlock *block);
   virtual void draw(float depth, int alpha, int tempAlpha,
                     float left, float right, float bottom, float top);
+
+protected:
+  virtual bool blockRows(int x, int y, int w, int h, int &offset, int &rowBytes, int &rows, int &stride);
 };
 
 
@@ -187,6 +212,10 @@ protected:
   GLuint     texRHandle;
   GLubyte*   textureR;
   GLuint     pboIdsR[2];
+  std::vector<char> residual;   // a decoded right eye on its way to GL
+
+  // copies a block of one eye, 3 bytes per pixel, into texture or textureR
+  void copyIntoPlane(GLubyte *plane, int _x, int _y, int _width, int _height, char *_block);
 
 public:
   static GLhandleARB programHandleS3DRGB;
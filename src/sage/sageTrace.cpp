@@ -0,0 +1,209 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageTrace.cpp
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#include "sageTrace.h"
+#include "misc.h"
+
+static const char *stageNames[TRACE_STAGE_NUM] = {
+  "render", "send", "receive", "fetch", "sync", "draw", "barrier", "swap"
+};
+
+sageTrace::sageTrace() : enabled(false), interval(TRACE_DEFAULT_INTERVAL), pid(0)
+{
+  pthread_key_create(&ringKey, releaseRing);
+  pthread_mutex_init(&lock, NULL);
+  exportPath[0] = '\0';
+  name[0] = '\0';
+}
+
+sageTrace& sageTrace::instance()
+{
+  static sageTrace trace;
+  return trace;
+}
+
+traceRing* sageTrace::newRing()
+{
+  traceRing *r = NULL;
+
+  pthread_mutex_lock(&lock);
+  for (int i=0; i<rings.size(); i++) {
+    if (!rings[i]->inUse) {
+      r = rings[i];
+      break;
+    }
+  }
+
+  if (!r) {
+    r = new traceRing;
+    r->head = 0;
+    r->tid = rings.size();
+    rings.push_back(r);
+  }
+  r->inUse = true;
+  pthread_mutex_unlock(&lock);
+
+  pthread_setspecific(ringKey, r);
+
+  return r;
+}
+
+void sageTrace::releaseRing(void *ring)
+{
+  // the events stay until the next thread overwrites them
+  sageTrace &t = instance();
+  pthread_mutex_lock(&t.lock);
+  ((traceRing *)ring)->inUse = false;
+  pthread_mutex_unlock(&t.lock);
+}
+
+void sageTrace::format(std::string &out)
+{
+  double offset = sageClock::instance().getOffset();
+
+  char line[TOKEN_LEN];
+  sprintf(line, "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"%s\"}}",
+          pid, name);
+  out += line;
+
+  std::vector<traceEvent> events;
+  std::vector<int> tids;
+
+  pthread_mutex_lock(&lock);
+  for (int i=0; i<rings.size(); i++) {
+    traceRing *r = rings[i];
+
+    unsigned long head = r->head;
+    TRACE_FENCE();
+    unsigned long first = (head > TRACE_RING_SIZE) ? head - TRACE_RING_SIZE : 0;
+    int copied = events.size();
+    for (unsigned long j=first; j<head; j++)
+      events.push_back(r->events[j & (TRACE_RING_SIZE-1)]);
+    TRACE_FENCE();
+
+    // the thread kept recording while the events were copied, the oldest
+    // ones may be overwritten, and the slot after head may be half written
+    unsigned long newHead = r->head;
+    unsigned long valid = (newHead >= TRACE_RING_SIZE) ? newHead - TRACE_RING_SIZE + 1 : 0;
+    if (valid > first)
+      events.erase(events.begin() + copied, events.begin() + copied + MIN(valid - first, head - first));
+
+    tids.resize(events.size(), r->tid);
+  }
+  pthread_mutex_unlock(&lock);
+
+  for (int i=0; i<events.size(); i++) {
+    traceEvent &e = events[i];
+    if (e.stage < 0 || e.stage >= TRACE_STAGE_NUM)
+      continue;
+
+    sprintf(line, ",\n{\"name\":\"%s\",\"cat\":\"sage\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+            "\"ts\":%.0f,\"dur\":%.0f,\"args\":{\"app\":%d,\"frame\":%d}}",
+            stageNames[e.stage], pid, tids[i], e.start + offset, e.end - e.start, e.appID, e.frameID);
+    out += line;
+  }
+
+  out += "\n]\n";
+}
+
+int sageTrace::start(const char *n)
+{
+  char *dir = getenv("SAGE_TRACE_DIR");
+  if (!dir || !dir[0])
+    return 0;
+
+  pthread_mutex_lock(&lock);
+  if (enabled) {
+    pthread_mutex_unlock(&lock);
+    return 0;
+  }
+
+  snprintf(exportPath, sizeof(exportPath), "%s/%s.trace.json", dir, n);
+  strncpy(name, n, SAGE_NAME_LEN-1);
+  name[SAGE_NAME_LEN-1] = '\0';
+
+  // the processes of all the nodes go in one trace, the name tells them apart
+  pid = 0;
+  for (const char *c = name; *c; c++)
+    pid = (pid * 31 + *c) & 0xfffffff;
+
+  char *sec = getenv("SAGE_TRACE_INTERVAL");
+  if (sec && atoi(sec) > 0)
+    interval = atoi(sec);
+
+  enabled = true;
+  pthread_mutex_unlock(&lock);
+
+  pthread_t thId;
+  if (pthread_create(&thId, 0, exportThread, (void*)this) != 0) {
+    SAGE_PRINTLOG("sageTrace : can't create export thread");
+    return -1;
+  }
+  pthread_detach(thId);
+
+  SAGE_PRINTLOG("sageTrace : writing frame traces to %s every %d seconds", exportPath, interval);
+
+  return 0;
+}
+
+void* sageTrace::exportThread(void *args)
+{
+  sageTrace *This = (sageTrace *)args;
+
+  char tmpPath[TOKEN_LEN+8];
+  sprintf(tmpPath, "%s.tmp", This->exportPath);
+
+  while (1) {
+    sage::sleep(This->interval);
+
+    std::string text;
+    This->format(text);
+
+    FILE *fp = fopen(tmpPath, "w");
+    if (!fp) {
+      SAGE_PRINTLOG("sageTrace : can't write %s", tmpPath);
+      continue;
+    }
+    fwrite(text.data(), 1, text.size(), fp);
+    fclose(fp);
+    rename(tmpPath, This->exportPath);
+  }
+
+  return NULL;
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * SAGE - Scalable Adaptive Graphics Environment
+ *
+ * Module: sageTrace.h
+ *
+ * Copyright (C) 2004 Electronic Visualization Laboratory,
+ * University of Illinois at Chicago
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following disclaimer
+ *    in the documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the University of Illinois at Chicago nor
+ *    the names of its contributors may be used to endorse or promote
+ *    products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Direct questions, comments etc about SAGE to bijeong@evl.uic.edu or
+ * http://www.evl.uic.edu/cavern/forum/
+ *
+ *****************************************************************************/
+
+#ifndef SAGE_TRACE_H
+#define SAGE_TRACE_H
+
+#include "sageBase.h"
+#include "misc.h"
+#include "sageClock.h"
+#include <string>
+
+// events kept per thread, must be a power of two
+#define TRACE_RING_SIZE 8192
+
+// seconds between two exports when SAGE_TRACE_INTERVAL isn't set
+#define TRACE_DEFAULT_INTERVAL 5
+
+// orders the event writes before the head update, for the exporter
+#if defined(WIN32)
+#define TRACE_FENCE() MemoryBarrier()
+#else
+#define TRACE_FENCE() __sync_synchronize()
+#endif
+
+/**
+ * stages of a frame, in pipeline order. Display stages (draw, barrier, swap)
+ * are per screen refresh, they are recorded with app -1 and the refresh count
+ * as frame
+ */
+enum sageTraceStage {
+  TRACE_RENDER,   // SAIL waits for the app to hand over the frame
+  TRACE_SEND,     // SAIL cuts the frame into blocks and sends them
+  TRACE_RECEIVE,  // SDM receives the blocks of the frame
+  TRACE_FETCH,    // SDM copies the blocks into the montages
+  TRACE_SYNC,     // the frame waits for the other nodes
+  TRACE_DRAW,     // SDM uploads and draws the damaged tiles
+  TRACE_BARRIER,  // SDM waits in the swap buffer barrier
+  TRACE_SWAP,     // SDM swaps the buffers
+  TRACE_STAGE_NUM
+};
+
+struct traceEvent {
+  double start;   // local clock, in microsecs
+  double end;
+  int stage;
+  int appID;
+  int frameID;
+};
+
+// the events of one thread, nobody else writes them
+struct traceRing {
+  traceEvent events[TRACE_RING_SIZE];
+  volatile unsigned long head;  // events recorded so far
+  int tid;
+  bool inUse;
+};
+
+/**
+ * Per frame trace of one process, keyed by (app, frame). Every thread
+ * records into its own ring without locks and the oldest events are
+ * overwritten, so the last few seconds are always there when the wall
+ * stutters. Tracing is off unless SAGE_TRACE_DIR is set when start() is
+ * called, then recording costs a clock read and a few stores.
+ *
+ * Events are exported on the cluster clock (see sageClock), so the traces
+ * of all display nodes line up. The export is in the Chrome trace JSON format, sageTraceReport.py
+ * merges the files and reports the critical path of each frame.
+ */
+class sageTrace {
+private:
+  bool enabled;
+
+  std::vector<traceRing *> rings;
+  pthread_key_t ringKey;
+  pthread_mutex_t lock;
+
+  int interval;
+  int pid;
+  char exportPath[TOKEN_LEN];
+  char name[SAGE_NAME_LEN];
+
+  sageTrace();
+
+  traceRing* newRing();
+  static void releaseRing(void *ring);
+  static void* exportThread(void *args);
+
+  inline traceRing* ring() {
+    traceRing *r = (traceRing *)pthread_getspecific(ringKey);
+    return r ? r : newRing();
+  }
+
+public:
+  static sageTrace& instance();
+
+  inline bool isOn() { return enabled; }
+
+  /** wall clock time in microsecs */
+  inline double now() { return sageClock::instance().local(); }
+
+  inline void record(int stage, int appID, int frameID, double start, double end) {
+    if (!enabled)
+      return;
+
+    traceRing *r = ring();
+    traceEvent &e = r->events[r->head & (TRACE_RING_SIZE-1)];
+    e.start = start;
+    e.end = end;
+    e.stage = stage;
+    e.appID = appID;
+    e.frameID = frameID;
+    TRACE_FENCE();
+    r->head++;
+  }
+
+  /** appends the recorded events to out, in the Chrome trace JSON format */
+  void format(std::string &out);
+
+  /**
+   * turns tracing on and writes the events to $SAGE_TRACE_DIR/<name>.trace.json
+   * every $SAGE_TRACE_INTERVAL seconds. Does nothing if the variable isn't set
+   * or tracing is already on
+   */
+  int start(const char *name);
+};
+
+/**
+ * records a stage from its construction to its destruction, for functions
+ * with many returns. The frame is read at the end, when it is known
+ */
+class traceScope {
+private:
+  int stage, appID;
+  const int &frameID;
+  double start;
+
+public:
+  traceScope(int s, int app, const int &frame) : stage(s), appID(app), frameID(frame) {
+    start = sageTrace::instance().isOn() ? sageTrace::instance().now() : 0.0;
+  }
+  ~traceScope() {
+    sageTrace &trace = sageTrace::instance();
+    if (start > 0.0)
+      trace.record(stage, appID, frameID, start, trace.now());
+  }
+};
+
+#endif
@@ -44,6 +44,7 @@
 #include "sageBlock.h"
 #include "sageBlockPool.h"
 #include "sageFrame.h"
+#include "sageAffinity.h"
 
 streamFlowData::streamFlowData(int wSize, sageBlockBuf *buf) : winIdx(0), frameRate(1),
                                                                frameSize(0), sentPackets(0), returnPlace(NULL), curGrp(NULL), packetSum(0),
@@ -789,6 +790,7 @@ int sageUdpModule::sendLoop()
 void* sageUdpModule::sendingThread(void *args)
 {
   sageUdpModule *This = (sageUdpModule *)args;
+  sageAffinity::instance().bind("udpsend");
   This->sendLoop();
 
   pthread_exit(NULL);
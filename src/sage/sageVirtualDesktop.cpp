@@ -43,7 +43,8 @@
 #include "fsManager.h"
 #include "fsCore.h"
 
-sageVirtualDesktop::sageVirtualDesktop(fsManager *f, int id)
+sageVirtualDesktop::sageVirtualDesktop(fsManager *f, int id) : gridCols(0), gridRows(0),
+                                                                 cellWidth(1), cellHeight(1), markStamp(0)
 {
   fsm = f;
   displayID = id;
@@ -105,6 +106,18 @@ int sageVirtualDesktop::sendToAll(int code, char *data)
   return 0;
 }
 
+int sageVirtualDesktop::sendToNode(int nodeId, int code, char *data)
+{
+  int clientID = getRcvId(nodeId);
+  if (clientID < 0)
+    return -1;
+
+  if (data)
+    return fsm->sendMessage(clientID, code, data);
+  else
+    return fsm->sendMessage(clientID, code);
+}
+
 int sageVirtualDesktop::launchReceivers(char *fsIP, int port, int syncPort, bool globalSync, int syncBarrierPort, int refreshInterval, int syncMasterPollingInterval, int syncLevel)
 {
   char *sageDir = getenv("SAGE_DIRECTORY");
@@ -159,6 +172,10 @@ int sageVirtualDesktop::getRcvInfo(int nodeID, char *info)
     strcat(info, tileInfo);
   }
 
+  // the entries of the node come last and override the global ones
+  strcat(info, affinity);
+  strcat(info, disp->affinity);
+
   //std::cout << "recv " << nodeID << " : " << info << std::endl;
 
   return 0;
@@ -175,28 +192,85 @@ int sageVirtualDesktop::getLocalPort(int nodeID)
   return disp->port;
 }
 
-int sageVirtualDesktop::generateStreamInfo(streamGroup &sGrp, std::vector<int> &rcvList, int offset)
+void sageVirtualDesktop::cellRange(int x, int y, int w, int h, int &c0, int &r0, int &c1, int &r1)
+{
+  // windows and tiles may reach past the desktop, they go to the border cells
+  c0 = MIN(MAX(x / cellWidth, 0), gridCols-1);
+  r0 = MIN(MAX(y / cellHeight, 0), gridRows-1);
+  c1 = MIN(MAX((x + MAX(w, 1) - 1) / cellWidth, 0), gridCols-1);
+  r1 = MIN(MAX((y + MAX(h, 1) - 1) / cellHeight, 0), gridRows-1);
+}
+
+void sageVirtualDesktop::buildTileGrid()
 {
+  gridCols = MAX(dimX, 1);
+  gridRows = MAX(dimY, 1);
+  cellWidth = MAX((width + gridCols - 1) / gridCols, 1);
+  cellHeight = MAX((height + gridRows - 1) / gridRows, 1);
+
+  tileGrid.clear();
+  tileGrid.resize(gridCols * gridRows);
+
   for (int i=0; i<tileList.size(); i++) {
+    int c0, r0, c1, r1;
+    cellRange(tileList[i]->x, tileList[i]->y, tileList[i]->width, tileList[i]->height, c0, r0, c1, r1);
+
+    for (int r=r0; r<=r1; r++)
+      for (int c=c0; c<=c1; c++)
+        tileGrid[r*gridCols + c].push_back(i);
+  }
+
+  tileMark.assign(tileList.size(), 0);
+  nodeMark.assign(displayCluster.size(), 0);
+  markStamp = 0;
+}
+
+int sageVirtualDesktop::generateStreamInfo(streamGroup &sGrp, std::vector<int> &rcvList, int offset)
+{
+  if (tileGrid.empty())
+    buildTileGrid();
+
+  sageRect appWindow = (sageRect &)sGrp;
+
+  // a fresh stamp marks the tiles and nodes seen by this query
+  markStamp++;
+  for (int i=0; i<rcvList.size(); i++)
+    nodeMark[rcvList[i]] = markStamp;
+
+  int c0, r0, c1, r1;
+  cellRange(appWindow.x, appWindow.y, appWindow.width, appWindow.height, c0, r0, c1, r1);
+
+  // tiles are tested in index order, streams keep the order of the full scan
+  std::vector<int> candidates;
+  for (int r=r0; r<=r1; r++) {
+    for (int c=c0; c<=c1; c++) {
+      std::vector<int> &cell = tileGrid[r*gridCols + c];
+      for (int k=0; k<cell.size(); k++) {
+        if (tileMark[cell[k]] != markStamp) {
+          tileMark[cell[k]] = markStamp;
+          candidates.push_back(cell[k]);
+        }
+      }
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  for (int k=0; k<candidates.size(); k++) {
+    tileInfo *tile = tileList[candidates[k]];
     streamInfo newStream;
 
     // set the stream image area to the overlap of a tile area and
     // an area mapped to a sender
-    sageRect appWindow = (sageRect &)sGrp;
-    if (appWindow.isOverLap(*(sageRect *)tileList[i], (sageRect &)newStream)) {
-      newStream.receiverID = tileList[i]->nodeID + offset;
+    if (appWindow.isOverLap(*(sageRect *)tile, (sageRect &)newStream)) {
+      newStream.receiverID = tile->nodeID + offset;
       //newStream.tileID = i;
 
       sGrp.addStream(newStream);
-      int cnt = 0;
-#ifdef __SUNPRO_CC
-      std::count(rcvList.begin(), rcvList.end(), tileList[i]->nodeID, cnt);
-#else
-      cnt = std::count(rcvList.begin(), rcvList.end(), tileList[i]->nodeID);
-#endif
 
-      if (cnt == 0)
-        rcvList.push_back(tileList[i]->nodeID);
+      if (nodeMark[tile->nodeID] != markStamp) {
+        nodeMark[tile->nodeID] = markStamp;
+        rcvList.push_back(tile->nodeID);
+      }
     }
   }
 
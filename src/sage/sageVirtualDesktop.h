@@ -49,7 +49,20 @@ class streamGroup;
 class fsManager;
 class appInExec;
 
+/**
+ * tiles are bucketed into a uniform grid of about one cell per tile, so
+ * a window is only tested against the tiles of the cells it covers
+ */
 class sageVirtualDesktop : public virtualDesktop {
+private:
+  std::vector< std::vector<int> > tileGrid;  // tile indices per grid cell
+  int gridCols, gridRows, cellWidth, cellHeight;
+  std::vector<int> tileMark, nodeMark;       // dedup stamps per query
+  int markStamp;
+
+  void buildTileGrid();
+  void cellRange(int x, int y, int w, int h, int &c0, int &r0, int &c1, int &r1);
+
 public:
   std::vector<int> tileNodeList;   // nodeIDs of display nodes
   std::vector<int> clientList;      // clientIDs of display nodes
@@ -95,6 +108,11 @@ public:
   std::vector<int> getAudioRcvClientList() { return audioClientList; }
   int changeBGColor(int red, int green, int blue);
   int sendToAll(int code, char *data);
+
+  /**
+   * sends a message to the receiver of a single display node
+   */
+  int sendToNode(int nodeId, int code, char *data);
   int convertYaxis(int y) { return height - y; }
   bool checkLayout(appInExec* app);
   void checkNeighbors(appInExec *app, int edge);
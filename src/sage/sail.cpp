@@ -54,6 +54,9 @@
 #include "sageDoubleBuf.h"
 #include "sageStreamer.h"
 #include "sageBlock.h"
+#include "sageTelemetry.h"
+#include "sageTrace.h"
+#include "sageClock.h"
 
 #ifdef SAGE_AUDIO
 #include "sageAudioCircBuf.h"
@@ -141,7 +144,7 @@ sage_gcd ( int a, int b )
 }
 
 
-int sail::init(sailConfig &conf)
+int sail::init(sailConfig &conf, sageStreamer *streamer)
 {
   config = conf;
 
@@ -399,7 +402,12 @@ int sail::init(sailConfig &conf)
 
   appMsgQueue.clear();
 
-  if (config.rendering) {
+  if (config.rendering && streamer) {
+    // a streamer with its own source of blocks, there are no frames to swap
+    pixelStreamer = streamer;
+    doubleBuf = NULL;
+  }
+  else if (config.rendering) {
     pixelStreamer = new sageBlockStreamer((streamerConfig &)config, pInfo.bytesPerPixel);
 
     doubleBuf = pixelStreamer->getDoubleBuffer();
@@ -460,6 +468,12 @@ int sail::init(sailConfig &conf)
   }
 #endif
 
+  char expName[SAGE_NAME_LEN], expLabels[SAGE_NAME_LEN];
+  snprintf(expName, SAGE_NAME_LEN, "sail-%s-%d-%d", config.appName, config.appID, config.rank);
+  snprintf(expLabels, SAGE_NAME_LEN, "proc=\"sail\",app=\"%s\",rank=\"%d\"", config.appName, config.rank);
+  sageTelemetry::instance().startExport(expName, expLabels);
+  sageTrace::instance().start(expName);
+
   //pthread_t thId;
 
   if (pthread_create(&msgThreadID, 0, msgThread, (void*)this) != 0) {
@@ -550,8 +564,16 @@ int sail::swapBuffer(int mode)
   }
   //}
 
+  // the frame is presented relative to when the app handed it over, the
+  // audio pushed with it is stamped on the same clock
+  doubleBuf->getFrontBuffer()->setPTS(sageClock::instance().now());
   doubleBuf->swapBuffer();
 
+  // the streamer is done with the frame now in front. If it came from
+  // streamBuffer(), hand the memory back to the app and use our own again
+  if (!config.asyncUpdate)
+    doubleBuf->getFrontBuffer()->detachBuffer();
+
 #ifdef SAGE_AUDIO
   if(audioModule)
   {
@@ -562,6 +584,51 @@ int sail::swapBuffer(int mode)
   return 0;
 }
 
+int sail::streamBuffer(void *appBuf, int mode)
+{
+  if (!config.rendering) {
+    SAGE_PRINTLOG("sail::streamBuffer() : this node is not configured to stream pixels\n");
+    return -1;
+  }
+
+  if (!appBuf) {
+    SAGE_PRINTLOG("sail::streamBuffer() : buffer is NULL\n");
+    return -1;
+  }
+
+  sagePixelData *front = doubleBuf->getFrontBuffer();
+
+  // front and back are the same frame, which is resent whenever the window changes
+  if (config.asyncUpdate) {
+    int size = bufSize;
+    if (config.pixFmt == PIXFMT_DXT || config.pixFmt == PIXFMT_DXT5 || config.pixFmt == PIXFMT_DXT5YCOCG)
+      size = size / 16;
+    memcpy(front->getPixelBuffer(), appBuf, size);
+    return swapBuffer(mode);
+  }
+
+  front->attachBuffer((char *)appBuf);
+  int ret = swapBuffer(mode);
+
+  // if the frame was skipped or not swapped (non-blocking), appBuf is still
+  // in front and is given back right away
+  doubleBuf->getFrontBuffer()->detachBuffer();
+
+  return ret;
+}
+
+int sail::convertBuffer(const void *appBuf, sageConvFmt fmt, int appRowOrd)
+{
+  if (!config.rendering) {
+    SAGE_PRINTLOG("sail::convertBuffer() : this node is not configured to stream pixels\n");
+    return -1;
+  }
+
+  bool flip = (appRowOrd >= 0 && appRowOrd != config.rowOrd);
+
+  return sageConvertImage(appBuf, fmt, getBuffer(), config.pixFmt, config.resX, config.resY, flip);
+}
+
 void* sail::getBuffer()
 {
   //SAGE_PRINTLOG("buffer address %x\n" , doubleBuf->getFrontBuffer()->getPixelBuffer());
@@ -884,7 +951,7 @@ int sail::parseMessage(sageMessage &msg)
 
       pixelStreamer->regeneratePixelBlocks();
 
-      if (doubleBuf->isFirstFrameReady() && config.asyncUpdate)
+      if (doubleBuf && doubleBuf->isFirstFrameReady() && config.asyncUpdate)
         doubleBuf->resendBuffer(1);
     }
 
@@ -902,7 +969,7 @@ int sail::parseMessage(sageMessage &msg)
     }
     else if (config.rendering) {
       pixelStreamer->enqueMsg(msgData);
-      if (doubleBuf->isFirstFrameReady() && config.asyncUpdate) {
+      if (doubleBuf && doubleBuf->isFirstFrameReady() && config.asyncUpdate) {
         //doubleBuf->resendBuffer(2);
 
         // with change in PDL, staticApp doesn't need to send 2 frames
@@ -916,7 +983,7 @@ int sail::parseMessage(sageMessage &msg)
   case SAIL_RESEND_FRAME : {
     //SAGE_PRINTLOG("SAIL::readMessage() : SAIL_RESEND_FRAME");
 
-    if (config.rendering && doubleBuf->isFirstFrameReady() && config.asyncUpdate)
+    if (config.rendering && doubleBuf && doubleBuf->isFirstFrameReady() && config.asyncUpdate)
       doubleBuf->resendBuffer(1);
     break;
   }
@@ -70,6 +70,7 @@
 #endif
 
 #include "sagePixelType.h"
+#include "sagePixelConvert.h"
 
 class appUI;
 class appWidget;
@@ -172,13 +173,14 @@ public:
    * creates pthreads mutex and condition variable.
    * if it runs on the master node then creates sageSyncServer object.
    * followed by sync related code
-   * followed by creation of sageBlockStreamer object
+   * followed by creation of sageBlockStreamer object, or the use of the
+   * given streamer, which the sail object deletes then (see sageReplay)
    * followed by SAGE_AUDIO part
    * finally pthread_create 'msgThread'
    *
    * @return 0 on success, -1 otherwise
    */
-  int init(sailConfig &conf);
+  int init(sailConfig &conf, sageStreamer *streamer = NULL);
   int getWinID() {return winID;}
 
   /**
@@ -192,6 +194,23 @@ public:
   int sendMessage(int code, char *data);
   int parseMessage(sageMessage &msg);
   int swapBuffer(int mode = SAGE_BLOCKING);
+
+  /**
+   * streams a frame straight from appBuf, which has the layout of the buffer
+   * returned by getBuffer(). SAGE keeps using appBuf until the next call to
+   * streamBuffer() or swapBuffer() returns, so the application should
+   * alternate between (at least) two buffers.
+   * With asyncUpdate the frame is copied since it may be resent at any time.
+   */
+  int streamBuffer(void *appBuf, int mode = SAGE_BLOCKING);
+
+  /**
+   * converts appBuf, an image of format fmt (see sagePixelConvert.h), into the
+   * buffer returned by getBuffer() in a single pass. Rows are flipped when
+   * appRowOrd is given and differs from the row order of the stream.
+   * The frame is sent by the next swapBuffer()
+   */
+  int convertBuffer(const void *appBuf, sageConvFmt fmt, int appRowOrd = -1);
 #ifdef SAGE_AUDIO
   /**
    * calls audioAppDataHander->swapBuffer(size, buf);
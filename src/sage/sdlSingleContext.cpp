@@ -55,11 +55,38 @@
 #include "sdlSingleContext.h"
 #include "sageShader.h"
 
+// the GLX extensions that tell what the back buffer holds after a swap
+#if !defined(WIN32) && !defined(__APPLE__)
+#define Font X11Font   // the overlay Font class is already declared
+#include <GL/glx.h>
+#undef Font
+#ifndef GLX_BACK_BUFFER_AGE_EXT
+#define GLX_BACK_BUFFER_AGE_EXT 0x20F4
+#endif
+#ifndef GLX_SWAP_METHOD_OML
+#define GLX_SWAP_METHOD_OML     0x8060
+#define GLX_SWAP_EXCHANGE_OML   0x8061
+#endif
+
+static bool hasGLXExtension(const char *list, const char *name)
+{
+  int len = strlen(name);
+  for (const char *p = list; p && (p = strstr(p, name)) != NULL; p += len) {
+    if ((p == list || p[-1] == ' ') && (p[len] == ' ' || p[len] == '\0'))
+      return true;
+  }
+  return false;
+}
+#endif
+
 
 
 int sdlSingleContext::init(struct sageDisplayConfig &cfg)
 {
   singleContext = true;
+  partialClear = true;
+  ageQuery = false;
+  swapAge = 0;
   configStruct = cfg;
 
 #if defined(WIN32)
@@ -121,6 +148,7 @@ int sdlSingleContext::init(struct sageDisplayConfig &cfg)
 #endif
 
     SAGE_PRINTLOG("sdlSingleContext:init(): Window created");
+    queryBufferAge();
   }
 
   GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
@@ -137,6 +165,15 @@ void sdlSingleContext::clearScreen()
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
+void sdlSingleContext::clearTile(int i, sageRect &tileRect)
+{
+  GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
+  glEnable(GL_SCISSOR_TEST);
+  glScissor(tileRect.x, tileRect.y, tileRect.width, tileRect.height);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  glDisable(GL_SCISSOR_TEST);
+}
+
 void sdlSingleContext::setupViewport(int i, sageRect &tileRect)
 {
   GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
@@ -149,6 +186,56 @@ void sdlSingleContext::refreshScreen()
   SDL_GL_SwapBuffers();
 }
 
+// partial redraws are only safe when we know what the back buffer holds
+void sdlSingleContext::queryBufferAge()
+{
+  ageQuery = false;
+  swapAge = 0;
+
+#if !defined(WIN32) && !defined(__APPLE__)
+  Display *dpy = glXGetCurrentDisplay();
+  if (!dpy)
+    return;
+
+  const char *ext = glXQueryExtensionsString(dpy, DefaultScreen(dpy));
+  if (hasGLXExtension(ext, "GLX_EXT_buffer_age"))
+    ageQuery = true;
+  else if (hasGLXExtension(ext, "GLX_OML_swap_method")) {
+    // exchanged buffers hold the frame before the last one
+    int id = 0, n = 0, method = 0;
+    glXQueryContext(dpy, glXGetCurrentContext(), GLX_FBCONFIG_ID, &id);
+    int attribs[] = { GLX_FBCONFIG_ID, id, None };
+    GLXFBConfig *fbc = glXChooseFBConfig(dpy, DefaultScreen(dpy), attribs, &n);
+    if (fbc) {
+      if (n > 0 && glXGetFBConfigAttrib(dpy, fbc[0], GLX_SWAP_METHOD_OML, &method) == Success &&
+          method == GLX_SWAP_EXCHANGE_OML)
+        swapAge = 2;
+      XFree(fbc);
+    }
+  }
+#endif
+
+  if (ageQuery)
+    SAGE_PRINTLOG("sdlSingleContext: GLX_EXT_buffer_age, redrawing damaged tiles only");
+  else if (swapAge > 0)
+    SAGE_PRINTLOG("sdlSingleContext: GLX_SWAP_EXCHANGE_OML, redrawing damaged tiles only");
+  else
+    SAGE_PRINTLOG("sdlSingleContext: back buffer age unknown, redrawing the whole screen");
+}
+
+int sdlSingleContext::bufferAge()
+{
+#if !defined(WIN32) && !defined(__APPLE__)
+  if (ageQuery) {
+    unsigned int age = 0;
+    glXQueryDrawable(glXGetCurrentDisplay(), glXGetCurrentDrawable(), GLX_BACK_BUFFER_AGE_EXT, &age);
+    return (int)age;
+  }
+#endif
+
+  return swapAge;
+}
+
 void sdlSingleContext::changeBackground(int red, int green, int blue)
 {
   GLprintError(__FILE__, __LINE__);  // Check for OpenGL errors
@@ -71,12 +71,18 @@ class sdlSingleContext : public displayContext {
 protected:
   SDL_Surface *surface;
   int window_width, window_height;
+  bool ageQuery;   // GLX_EXT_buffer_age reports the age of each back buffer
+  int swapAge;     // the age of the back buffer implied by the swap method
+
+  void queryBufferAge();
 
 public:
   int init(struct sageDisplayConfig &cfg);
   void clearScreen();
+  void clearTile(int i, sageRect &tileRect);
   void setupViewport(int i, sageRect &tileRect);
   void refreshScreen();
+  int bufferAge();
   void changeBackground(int red, int green, int blue);
   ~sdlSingleContext();
   void checkEvent();
@@ -81,9 +81,9 @@ int streamGroup::addImageInfo(sageRect &imgRect)
   return 0;
 }
 
-void streamGroup::createRcvMsg(int winID, char *msgStr)
+void streamGroup::createRcvMsg(int winID, int configID, char *msgStr)
 {
-  sprintf(msgStr, "%d %d %d %d %d %d %d", winID, x, y, width, height, rcvNum, (int)orientation);
+  sprintf(msgStr, "%d %d %d %d %d %d %d %d", winID, configID, x, y, width, height, rcvNum, (int)orientation);
 }
 
 void streamGroup::createMessage(sageMessage &msg, int code)
@@ -79,7 +79,7 @@ public:
   int addStream(streamInfo &s);
   int addImageInfo(sageRect &imgRect);
   void createMessage(sageMessage &msg, int code);
-  void createRcvMsg(int winID, char *msgStr);
+  void createRcvMsg(int winID, int configID, char *msgStr);
   void parseMessage(char *str);
 };
 
@@ -50,6 +50,7 @@ displayNode::displayNode() : dimX(0), dimY(0), port(0)
   tiles.clear();
   sprintf(Xdisp, "0.0");
   winX = 0, winY = 0;
+  affinity[0] = '\0';
 }
 
 displayNode::~displayNode()
@@ -117,6 +118,7 @@ virtualDesktop::virtualDesktop() : dimX(0), dimY(0), table(false), audioServer(f
   memset(masterIP, 0, SAGE_IP_LEN);
   masterIP[0] = '\0';
   audioDir[0] = '\0';
+  affinity[0] = '\0';
 }
 
 int virtualDesktop::updateDesktop()
@@ -341,6 +343,17 @@ bool virtualDesktop::parseConfigfile(FILE *fp, bool configBegin)
         return false;
       }
     }
+    else if (strcmp(token, "AFFINITY") == 0) {
+      // before the first display node it applies to all of them
+      char name[TOKEN_LEN], spec[TOKEN_LEN];
+      getToken(fp, name);
+      getToken(fp, spec);
+      char *list = (parseNodeInfo && newNode) ? newNode->affinity : affinity;
+      if (strlen(list) + strlen(name) + strlen(spec) + 2 < SAGE_NAME_LEN)
+        sprintf(list + strlen(list), " %s=%s", name, spec);
+      else
+        SAGE_PRINTLOG("virtualDesktop::parseConfigfile : too many affinity entries");
+    }
     else if (strcmp(token, "DISPLAY_CONNECTIONS") == 0) {
       fileContinue = false;
       break;
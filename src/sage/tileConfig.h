@@ -83,6 +83,7 @@ public:
   int winX, winY;
   int port;
   char Xdisp[XID_LEN];
+  char affinity[SAGE_NAME_LEN];  // " name=spec" thread placements of the node
 
   displayNode();
   ~displayNode();
@@ -133,6 +134,7 @@ public:
   bool table;
   char audioDir[TOKEN_LEN];
   bool audioServer;
+  char affinity[SAGE_NAME_LEN];  // thread placements of all nodes
 
   virtualDesktop();
   bool parseConfigfile(FILE *fp, bool configBegin = false);
@@ -0,0 +1,280 @@
+#!/usr/bin/env python
+
+############################################################################
+#
+# SAGE TRACE REPORT - merges the frame traces of all the SAGE processes
+# and reports where the time of each frame went
+#
+# Copyright (C) 2007 Electronic Visualization Laboratory,
+# University of Illinois at Chicago
+#
+# All rights reserved.
+# 
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 
+#  * Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+#  * Redistributions in binary form must reproduce the above
+#    copyright notice, this list of conditions and the following disclaimer
+#    in the documentation and/or other materials provided with the distribution.
+#  * Neither the name of the University of Illinois at Chicago nor
+#    the names of its contributors may be used to endorse or promote
+#    products derived from this software without specific prior written permission.
+# 
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+# PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+############################################################################
+
+#
+# The processes write $SAGE_TRACE_DIR/<name>.trace.json (Chrome trace
+# format) when SAGE_TRACE_DIR is set. Collect the files of all the nodes
+# in one directory, then
+#
+#   sageTraceReport.py <dir or files> [-w <worst frames to list>] [-o merged.json]
+#
+# The merged file can be loaded in chrome://tracing or ui.perfetto.dev.
+#
+# The display nodes are on the clock of the sync master already. SAIL
+# nodes aren't, they are moved back when their blocks would arrive before
+# they were sent.
+#
+
+from __future__ import print_function
+import json, os, sys, glob
+
+STAGES = ["render", "send", "receive", "fetch", "sync", "draw", "barrier", "swap"]
+
+# the segments a frame's end to end time is cut into, in pipeline order
+SEGMENTS = ["render", "send", "network", "fetch", "sync", "draw", "barrier+swap"]
+
+
+def loadTraces(paths):
+    files = []
+    for p in paths:
+        if os.path.isdir(p):
+            files += glob.glob(os.path.join(p, "*.trace.json"))
+        else:
+            files.append(p)
+
+    names = {}
+    events = []
+    for f in files:
+        try:
+            data = json.load(open(f))
+        except ValueError:
+            print("skipping %s, not a complete trace" % f, file=sys.stderr)
+            continue
+        for e in data:
+            if e.get("ph") == "M" and e.get("name") == "process_name":
+                names[e["pid"]] = e["args"]["name"]
+            elif e.get("ph") == "X" and e.get("name") in STAGES:
+                events.append(e)
+    return names, events
+
+
+def span(spans, key, start, end):
+    # several events of a stage (e.g. fetch) make one span
+    if key in spans:
+        s = spans[key]
+        spans[key] = (min(s[0], start), max(s[1], end))
+    else:
+        spans[key] = (start, end)
+
+
+def alignSail(names, events):
+    # earliest receive of each frame on any display node
+    firstRecv = {}
+    for e in events:
+        if e["name"] == "receive" and names.get(e["pid"], "").startswith("sdm"):
+            key = (e["args"]["app"], e["args"]["frame"])
+            firstRecv[key] = min(firstRecv.get(key, e["ts"]), e["ts"])
+
+    # the smallest send to receive gap of each sail node, it can't be negative
+    gap = {}
+    for e in events:
+        if e["name"] == "send" and names.get(e["pid"], "").startswith("sail"):
+            key = (e["args"]["app"], e["args"]["frame"])
+            if key in firstRecv:
+                d = firstRecv[key] - e["ts"]
+                gap[e["pid"]] = min(gap.get(e["pid"], d), d)
+
+    for pid in gap:
+        if gap[pid] < 0:
+            print("%s moved back by %.0f us" % (names[pid], -gap[pid]))
+    for e in events:
+        if gap.get(e["pid"], 0) < 0:
+            e["ts"] += gap[e["pid"]]
+
+
+def firstAfter(spans, t):
+    # spans are sorted by start
+    for s in spans:
+        if s[0] >= t:
+            return s
+    return None
+
+
+def analyse(names, events):
+    sail = {}      # (app, frame) -> pid -> stage -> span
+    sdm = {}       # (app, frame) -> pid -> stage -> span
+    screen = {}    # pid -> stage -> sorted spans of the screen refreshes
+
+    for e in events:
+        proc = names.get(e["pid"], "")
+        start, end = e["ts"], e["ts"] + e["dur"]
+        app, frame = e["args"]["app"], e["args"]["frame"]
+
+        if app < 0:
+            screen.setdefault(e["pid"], {}).setdefault(e["name"], []).append((start, end))
+        elif proc.startswith("sail"):
+            span(sail.setdefault((app, frame), {}).setdefault(e["pid"], {}), e["name"], start, end)
+        else:
+            span(sdm.setdefault((app, frame), {}).setdefault(e["pid"], {}), e["name"], start, end)
+
+    for pid in screen:
+        for stage in screen[pid]:
+            screen[pid][stage].sort()
+
+    frames = []
+    for key in sdm:
+        nodes = sdm[key]
+
+        # the node that finished fetching last holds up the sync
+        fetched = [(n, s["fetch"][1]) for n, s in nodes.items() if "fetch" in s]
+        if not fetched:
+            continue
+        nf, fetchEnd = max(fetched, key=lambda x: x[1])
+        recvEnd = nodes[nf].get("receive", (fetchEnd, fetchEnd))[1]
+        release = max([s.get("sync", (0, fetchEnd))[1] for s in nodes.values()] + [fetchEnd])
+
+        # the first refresh after the release shows the frame
+        drawEnd, present = {}, {}
+        for n, s in nodes.items():
+            t = s.get("sync", (0, s.get("fetch", (0, release))[1]))[1]
+            refresh = screen.get(n, {})
+            draw = firstAfter(refresh.get("draw", []), t)
+            if not draw:
+                continue
+            drawEnd[n] = draw[1]
+            present[n] = draw[1]
+            for stage in ["barrier", "swap"]:
+                s2 = firstAfter(refresh.get(stage, []), draw[1] - 1)
+                if s2:
+                    present[n] = max(present[n], s2[1])
+        if not present:
+            continue
+        nd = max(drawEnd, key=drawEnd.get)
+        np = max(present, key=present.get)
+
+        f = {"key": key, "seg": {}, "node": {}}
+        begin = recvEnd
+
+        # the sail node that sent its blocks last
+        senders = [(n, s) for n, s in sail.get(key, {}).items() if "send" in s]
+        if senders:
+            ns, s = max(senders, key=lambda x: x[1]["send"][1])
+            sendEnd = s["send"][1]
+            renderStart, renderEnd = s.get("render", (s["send"][0], s["send"][0]))
+            begin = renderStart
+            f["seg"]["render"] = (renderEnd - renderStart, ns)
+            f["seg"]["send"] = (sendEnd - renderEnd, ns)
+            f["seg"]["network"] = (recvEnd - sendEnd, nf)
+        else:
+            begin = nodes[nf].get("receive", (recvEnd, recvEnd))[0]
+            f["seg"]["network"] = (recvEnd - begin, nf)
+
+        f["seg"]["fetch"] = (fetchEnd - recvEnd, nf)
+        f["seg"]["sync"] = (release - fetchEnd, nf)
+        f["seg"]["draw"] = (drawEnd[nd] - release, nd)
+        f["seg"]["barrier+swap"] = (present[np] - drawEnd[nd], np)
+        for seg in f["seg"]:
+            f["seg"][seg] = (max(0, f["seg"][seg][0]), f["seg"][seg][1])
+        f["total"] = present[np] - begin
+        frames.append(f)
+
+    return frames
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values)-1, int(len(values) * p / 100.0))]
+
+
+def report(names, frames, worst):
+    apps = sorted(set([f["key"][0] for f in frames]))
+    for app in apps:
+        af = [f for f in frames if f["key"][0] == app]
+        totals = [f["total"] for f in af]
+        print("\napp %d : %d frames, end to end %.0f us mean, %.0f p50, %.0f p95, %.0f max" %
+              (app, len(af), sum(totals) / len(totals), percentile(totals, 50),
+               percentile(totals, 95), max(totals)))
+        print("  %-14s %10s %6s   %s" % ("segment", "mean us", "share", "critical node (frames)"))
+
+        meanTotal = sum(totals) / len(totals)
+        for seg in SEGMENTS:
+            vals = [f["seg"][seg] for f in af if seg in f["seg"]]
+            if not vals:
+                continue
+            mean = sum([v[0] for v in vals]) / len(vals)
+            count = {}
+            for v in vals:
+                count[v[1]] = count.get(v[1], 0) + 1
+            node = max(count, key=count.get)
+            print("  %-14s %10.0f %5.1f%%   %s (%d)" % (seg, mean, 100.0 * mean / max(meanTotal, 1),
+                                                   names.get(node, node), count[node]))
+
+        af.sort(key=lambda f: -f["total"])
+        print("  worst frames:")
+        for f in af[:worst]:
+            parts = ["%s %.0f@%s" % (seg, f["seg"][seg][0], names.get(f["seg"][seg][1], f["seg"][seg][1]))
+                     for seg in SEGMENTS if seg in f["seg"]]
+            print("    frame %d : %.0f us = %s" % (f["key"][1], f["total"], ", ".join(parts)))
+
+
+def main(argv):
+    paths, worst, merged = [], 5, None
+    i = 0
+    while i < len(argv):
+        if argv[i] == "-w" and i+1 < len(argv):
+            worst = int(argv[i+1])
+            i += 1
+        elif argv[i] == "-o" and i+1 < len(argv):
+            merged = argv[i+1]
+            i += 1
+        else:
+            paths.append(argv[i])
+        i += 1
+
+    if not paths:
+        print("usage: sageTraceReport.py <dir or files> [-w <worst frames>] [-o merged.json]")
+        return -1
+
+    names, events = loadTraces(paths)
+    if not events:
+        print("no trace events found")
+        return -1
+
+    alignSail(names, events)
+
+    if merged:
+        out = [{"name": "process_name", "ph": "M", "pid": pid, "tid": 0, "args": {"name": name}}
+               for pid, name in names.items()]
+        json.dump(out + events, open(merged, "w"))
+
+    report(names, analyse(names, events), worst)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))